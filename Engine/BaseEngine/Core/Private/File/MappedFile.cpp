@@ -0,0 +1,178 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#include <File/MappedFile.hpp>
+
+#if defined(_WIN32) || defined(_WIN64)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif // #ifndef WIN32_LEAN_AND_MEAN
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif // #ifndef NOMINMAX
+#include <windows.h>
+#else // #if defined(_WIN32) || defined(_WIN64)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // #if defined(_WIN32) || defined(_WIN64)
+
+NAMESPACE_BEGIN(BE::Core)
+
+CMappedFile::~CMappedFile()
+{
+    Close();
+}
+
+CMappedFile::CMappedFile(CMappedFile&& other) noexcept
+{
+    MoveFrom(other);
+}
+
+CMappedFile& CMappedFile::operator=(CMappedFile&& other) noexcept
+{
+    if (this != &other)
+    {
+        Close();
+        MoveFrom(other);
+    }
+
+    return *this;
+}
+
+#if defined(_WIN32) || defined(_WIN64)
+
+bool CMappedFile::Open(const std::filesystem::path& path)
+{
+    Close();
+
+    HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    LARGE_INTEGER fileSize{};
+    if (GetFileSizeEx(file, &fileSize) == FALSE)
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    // 空文件无法创建映射
+    if (fileSize.QuadPart == 0)
+    {
+        CloseHandle(file);
+        IsMapped = true;
+        return true;
+    }
+
+    // 映射与视图持有文件的引用，句柄可以立即关闭
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr)
+    {
+        return false;
+    }
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (view == nullptr)
+    {
+        return false;
+    }
+
+    Data = static_cast<const std::byte*>(view);
+    Size = static_cast<size_t>(fileSize.QuadPart);
+    IsMapped = true;
+
+    return true;
+}
+
+void CMappedFile::Close()
+{
+    if (Data != nullptr)
+    {
+        UnmapViewOfFile(Data);
+    }
+
+    Data = nullptr;
+    Size = 0;
+    IsMapped = false;
+}
+
+#else // #if defined(_WIN32) || defined(_WIN64)
+
+bool CMappedFile::Open(const std::filesystem::path& path)
+{
+    Close();
+
+    const int FILE = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (FILE < 0)
+    {
+        return false;
+    }
+
+    struct stat fileStat{};
+    if (::fstat(FILE, &fileStat) != 0)
+    {
+        ::close(FILE);
+        return false;
+    }
+
+    // 长度为0的映射是非法的
+    if (fileStat.st_size == 0)
+    {
+        ::close(FILE);
+        IsMapped = true;
+        return true;
+    }
+
+    // 映射持有文件的引用，描述符可以立即关闭
+    void* view = ::mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, FILE, 0);
+    ::close(FILE);
+    if (view == MAP_FAILED)
+    {
+        return false;
+    }
+
+    Data = static_cast<const std::byte*>(view);
+    Size = static_cast<size_t>(fileStat.st_size);
+    IsMapped = true;
+
+    return true;
+}
+
+void CMappedFile::Close()
+{
+    if (Data != nullptr)
+    {
+        ::munmap(const_cast<std::byte*>(Data), Size);
+    }
+
+    Data = nullptr;
+    Size = 0;
+    IsMapped = false;
+}
+
+#endif // #if defined(_WIN32) || defined(_WIN64)
+
+void CMappedFile::MoveFrom(CMappedFile& other)
+{
+    Data = other.Data;
+    Size = other.Size;
+    IsMapped = other.IsMapped;
+
+    other.Data = nullptr;
+    other.Size = 0;
+    other.IsMapped = false;
+}
+
+NAMESPACE_END() // namespace BE::Core
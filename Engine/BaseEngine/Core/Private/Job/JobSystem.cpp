@@ -0,0 +1,293 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#include <Job/JobSystem.hpp>
+#include <algorithm>
+
+NAMESPACE_BEGIN(BE::Core)
+
+namespace
+{
+
+// 空闲的工作线程在休眠前让出时间片的次数
+constexpr uint32_t WORKER_SPIN_ROUNDS = 64;
+
+// 当前线程所属的任务系统与队列，池外线程为 nullptr
+thread_local const CJobSystem* CurrentJobSystem = nullptr;
+thread_local uint32_t          CurrentWorker = 0;
+
+// 当前线程的任务环，任务在创建它的线程上分配
+thread_local std::unique_ptr<CJobSystem::SJob[]> JobRing;
+thread_local uint32_t                            AllocatedJobCount = 0;
+
+// 当前线程最近提交任务的任务系统，任务环被未完成的任务占满时在其上执行其它任务
+thread_local CJobSystem* QueuingJobSystem = nullptr;
+
+uint32_t GetDefaultWorkerCount()
+{
+    const uint32_t HARDWARE_THREADS = std::thread::hardware_concurrency();
+    return HARDWARE_THREADS > 1 ? HARDWARE_THREADS - 1 : 0;
+}
+
+} // namespace
+
+CJobSystem::CJobSystem() : CJobSystem(GetDefaultWorkerCount())
+{}
+
+CJobSystem::CJobSystem(uint32_t workerCount)
+{
+    Deques.reserve(workerCount);
+    for (uint32_t index = 0; index < workerCount; ++index)
+    {
+        Deques.push_back(std::make_unique<FJobDeque>());
+    }
+
+    Workers.reserve(workerCount);
+    for (uint32_t index = 0; index < workerCount; ++index)
+    {
+        Workers.emplace_back(&CJobSystem::WorkerMain, this, index);
+    }
+}
+
+CJobSystem::~CJobSystem()
+{
+    {
+        const std::lock_guard<std::mutex> LOCK(WakeMutex);
+        IsStopping = true;
+    }
+
+    WakeCondition.notify_all();
+
+    for (auto& worker : Workers)
+    {
+        worker.join();
+    }
+}
+
+CJobSystem& CJobSystem::Get()
+{
+    static CJobSystem inst;
+    return inst;
+}
+
+uint32_t CJobSystem::GetWorkerCount() const
+{
+    return static_cast<uint32_t>(Workers.size());
+}
+
+void CJobSystem::Run(SJob* job)
+{
+    QueuingJobSystem = this;
+
+    // 先增加计数再入队，取走任务的线程减计数时不会下溢；
+    // 先增加计数再检查休眠线程，与工作线程的检查顺序相反，二者至少有一方能看到对方
+    QueuedJobCount.fetch_add(1, std::memory_order_seq_cst);
+
+    if (CurrentJobSystem == this)
+    {
+        // 队列已满时直接执行，不会丢失任务
+        if (!Deques[CurrentWorker]->Push(job))
+        {
+            QueuedJobCount.fetch_sub(1, std::memory_order_relaxed);
+            Execute(job);
+            return;
+        }
+    }
+    else
+    {
+        const std::lock_guard<std::mutex> LOCK(ExternalMutex);
+        ExternalJobs.push_back(job);
+    }
+
+    if (SleepingWorkerCount.load(std::memory_order_seq_cst) > 0)
+    {
+        const std::lock_guard<std::mutex> LOCK(WakeMutex);
+        WakeCondition.notify_one();
+    }
+}
+
+void CJobSystem::Wait(const SJob* job)
+{
+    // 等待期间执行其它任务(不一定是该任务的子任务)，任务内部因此也可以等待新的任务
+    while (job->UnfinishedJobs.load(std::memory_order_acquire) > 0)
+    {
+        if (!RunOneJob())
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void CJobSystem::WorkerMain(uint32_t workerIndex)
+{
+    CurrentJobSystem = this;
+    CurrentWorker = workerIndex;
+
+    uint32_t idleRounds = 0;
+
+    while (true)
+    {
+        if (RunOneJob())
+        {
+            idleRounds = 0;
+            continue;
+        }
+
+        // 短暂空闲时只让出时间片，避免频繁休眠与唤醒
+        if (++idleRounds < WORKER_SPIN_ROUNDS)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        idleRounds = 0;
+
+        std::unique_lock<std::mutex> lock(WakeMutex);
+        SleepingWorkerCount.fetch_add(1, std::memory_order_seq_cst);
+        WakeCondition.wait(lock,
+                           [this] { return IsStopping || QueuedJobCount.load(std::memory_order_seq_cst) > 0; });
+        SleepingWorkerCount.fetch_sub(1, std::memory_order_relaxed);
+
+        if (IsStopping)
+        {
+            return;
+        }
+    }
+}
+
+bool CJobSystem::RunOneJob()
+{
+    const bool     IS_WORKER = CurrentJobSystem == this;
+    const auto     WORKER_COUNT = static_cast<uint32_t>(Deques.size());
+    const uint32_t HOME = IS_WORKER ? CurrentWorker : 0;
+
+    SJob* job = nullptr;
+
+    // 1. 自己的队列：从底部取最新的任务
+    if (IS_WORKER)
+    {
+        job = Deques[HOME]->Pop();
+    }
+
+    // 2. 窃取：从其它队列的顶部取最早的任务
+    for (uint32_t offset = IS_WORKER ? 1 : 0; job == nullptr && offset < WORKER_COUNT; ++offset)
+    {
+        job = Deques[(HOME + offset) % WORKER_COUNT]->Steal();
+    }
+
+    // 3. 池外线程提交的任务
+    if (job == nullptr)
+    {
+        const std::lock_guard<std::mutex> LOCK(ExternalMutex);
+        if (!ExternalJobs.empty())
+        {
+            job = ExternalJobs.front();
+            ExternalJobs.pop_front();
+        }
+    }
+
+    if (job == nullptr)
+    {
+        return false;
+    }
+
+    QueuedJobCount.fetch_sub(1, std::memory_order_relaxed);
+    Execute(job);
+
+    return true;
+}
+
+void CJobSystem::Execute(SJob* job)
+{
+    job->Function(*job);
+    Finish(job);
+}
+
+void CJobSystem::Finish(SJob* job)
+{
+    // 计数归零后任务可能被创建它的线程立即复用，须先读出父任务
+    SJob* parent = job->Parent;
+
+    if (job->UnfinishedJobs.fetch_sub(1, std::memory_order_acq_rel) == 1 && parent != nullptr)
+    {
+        Finish(parent);
+    }
+}
+
+CJobSystem::SJob* CJobSystem::AllocateJob()
+{
+    if (!JobRing)
+    {
+        JobRing = std::make_unique<SJob[]>(MAX_JOBS_PER_THREAD);
+    }
+
+    // 环绕后跳过仍未完成的任务(例如仍在栈上执行的父任务)，整圈都未完成时先执行其它任务，不覆盖未完成的任务
+    for (uint32_t attempt = 1;; ++attempt)
+    {
+        SJob* job = &JobRing[AllocatedJobCount++ & (MAX_JOBS_PER_THREAD - 1)];
+        if (job->UnfinishedJobs.load(std::memory_order_acquire) == 0)
+        {
+            return job;
+        }
+
+        if (attempt % MAX_JOBS_PER_THREAD == 0 && (QueuingJobSystem == nullptr || !QueuingJobSystem->RunOneJob()))
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+bool CJobSystem::IsLocalQueueEmpty()
+{
+    return CurrentJobSystem != this || Deques[CurrentWorker]->IsEmpty();
+}
+
+uint32_t CJobSystem::GetDefaultGrainSize(uint32_t count) const
+{
+    // 每个线程大约分到8段，负载不均时仍有可窃取的任务
+    const auto THREAD_COUNT = static_cast<uint32_t>(Workers.size()) + 1;
+    return std::max(1U, count / (THREAD_COUNT * 8));
+}
+
+void CJobSystem::ParallelForJob(SJob& job)
+{
+    const auto DATA = GetJobData<SParallelForData>(job);
+
+    // 所有拆分出的任务都挂在根任务下，等待根任务即等待整个范围
+    SJob* root = job.Parent != nullptr ? job.Parent : &job;
+
+    uint32_t begin = DATA.Begin;
+    uint32_t end = DATA.End;
+
+    while (end - begin > DATA.GrainSize)
+    {
+        // 自己的队列为空说明此前拆分出的任务已被窃取，继续拆分一半供其它线程窃取
+        if (end - begin >= 2 * DATA.GrainSize && DATA.System->IsLocalQueueEmpty())
+        {
+            const uint32_t MIDDLE = begin + ((end - begin) / 2);
+
+            SParallelForData right = DATA;
+            right.Begin = MIDDLE;
+            right.End = end;
+            DATA.System->Run(CreateJob(&CJobSystem::ParallelForJob, right, root));
+
+            end = MIDDLE;
+            continue;
+        }
+
+        DATA.Invoke(DATA.Body, begin, begin + DATA.GrainSize);
+        begin += DATA.GrainSize;
+    }
+
+    if (begin < end)
+    {
+        DATA.Invoke(DATA.Body, begin, end);
+    }
+}
+
+NAMESPACE_END() // namespace BE::Core
@@ -23,7 +23,14 @@ ITickInterface::~ITickInterface()
 {
     OnRegisterTick.RemoveBinding();
 
-    CTickSystem::Get().UnregisterTick(TickGroup,TickHandle);
+    if (TickInParallel)
+    {
+        CTickSystem::Get().UnregisterParallelTick(TickGroup, this);
+    }
+    else
+    {
+        CTickSystem::Get().UnregisterTick(TickGroup, TickHandle);
+    }
 }
 
 void ITickInterface::OnRegisterTickSuccess(NekiraDelegate::MultiSignalHandle handle)
@@ -36,5 +43,10 @@ ETickGroup ITickInterface::GetTickGroup() const
     return TickGroup;
 }
 
+bool ITickInterface::CanTickInParallel() const
+{
+    return TickInParallel;
+}
+
 
 NAMESPACE_END() // namespace BE::Core
\ No newline at end of file
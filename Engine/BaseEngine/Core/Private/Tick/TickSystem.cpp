@@ -6,8 +6,10 @@
  * For more detail, please refer to the LICENSE file in the root directory of this project.
  */
 
+#include <Job/JobSystem.hpp>
 #include <Tick/TickInterface.hpp>
 #include <Tick/TickSystem.hpp>
+#include <atomic>
 
 NAMESPACE_BEGIN(BE::Core)
 
@@ -25,19 +27,88 @@ void CTickSystem::Initialize()
 
 void CTickSystem::PreRegisterTick(ITickInterface* tickable)
 {
+    const std::lock_guard<std::mutex> LOCK(PreRegisterMutex);
     PreRegisteredTickables.push(tickable);
 }
 
 void CTickSystem::UnregisterTick(ETickGroup tickGroup, const NekiraDelegate::MultiSignalHandle& handle)
 {
-    if (TickGroupMap.contains(tickGroup))
+    TickGroups[static_cast<size_t>(tickGroup)].SerialTicks.RemoveSingle(handle);
+}
+
+void CTickSystem::UnregisterParallelTick(ETickGroup tickGroup, ITickInterface* tickable)
+{
+    const std::lock_guard<std::mutex> LOCK(ParallelTickMutex);
+
+    auto&          tickables = TickGroups[static_cast<size_t>(tickGroup)].ParallelTickables;
+    const uint32_t INDEX = tickable->ParallelTickIndex;
+
+    // 未注册，或是被移动过的对象
+    if (INDEX >= tickables.size() || tickables[INDEX] != tickable)
     {
-        TickGroupMap[tickGroup].RemoveSingle(handle);
+        return;
+    }
+
+    tickable->ParallelTickIndex = INVALID_PARALLEL_TICK_INDEX;
+
+    // Tick 期间其它线程可能正在遍历数组：只清空槽位，Tick 结束后再移除
+    if (IsTicking)
+    {
+        std::atomic_ref<ITickInterface*>(tickables[INDEX]).store(nullptr, std::memory_order_release);
+        HasRemovedTickables = true;
+        return;
+    }
+
+    // 与末尾交换后移除，同组的并行顺序本就不固定
+    tickables[INDEX] = tickables.back();
+    tickables[INDEX]->ParallelTickIndex = INDEX;
+    tickables.pop_back();
+}
+
+void CTickSystem::Tick(float deltaTime)
+{
+    ProcessPreRegisteredTick();
+
+    {
+        const std::lock_guard<std::mutex> LOCK(ParallelTickMutex);
+        IsTicking = true;
+    }
+
+    for (auto& group : TickGroups)
+    {
+        group.SerialTicks.Invoke(deltaTime);
+
+        auto& tickables = group.ParallelTickables;
+        CJobSystem::Get().ParallelFor(static_cast<uint32_t>(tickables.size()), 0,
+                                      [&](uint32_t begin, uint32_t end)
+                                      {
+                                          for (uint32_t index = begin; index < end; ++index)
+                                          {
+                                              // 已在本次 Tick 中注销的对象
+                                              ITickInterface* tickable =
+                                                  std::atomic_ref<ITickInterface*>(tickables[index])
+                                                      .load(std::memory_order_acquire);
+                                              if (tickable != nullptr)
+                                              {
+                                                  tickable->Tick(deltaTime);
+                                              }
+                                          }
+                                      });
+    }
+
+    const std::lock_guard<std::mutex> LOCK(ParallelTickMutex);
+    IsTicking = false;
+
+    if (HasRemovedTickables)
+    {
+        RemoveUnregisteredTickables();
     }
 }
 
 void CTickSystem::ProcessPreRegisteredTick()
 {
+    const std::lock_guard<std::mutex> LOCK(PreRegisterMutex);
+
     // Process pre-registered tickables
     while (!PreRegisteredTickables.empty())
     {
@@ -46,21 +117,49 @@ void CTickSystem::ProcessPreRegisteredTick()
 
         const ETickGroup TICK_GROUP = tickable->GetTickGroup();
 
-        RegisterTick(TICK_GROUP, tickable, &ITickInterface::Tick);
+        if (tickable->CanTickInParallel())
+        {
+            RegisterParallelTick(TICK_GROUP, tickable);
+        }
+        else
+        {
+            RegisterTick(TICK_GROUP, tickable, &ITickInterface::Tick);
+        }
     }
 }
 
 void CTickSystem::RegisterTick(ETickGroup tickGroup, ITickInterface* tickable, void (ITickInterface::*funcPtr)(float))
 {
-    if (!TickGroupMap.contains(tickGroup))
-    {
-        TickGroupMap.insert({tickGroup, TTickSignature()});
-    }
-
-    auto handle = TickGroupMap[tickGroup].BindMemberFunction(tickable, funcPtr);
+    auto handle = TickGroups[static_cast<size_t>(tickGroup)].SerialTicks.BindMemberFunction(tickable, funcPtr);
 
     // Broadcast the registration success
     tickable->OnRegisterTick.Invoke(handle);
 }
 
+void CTickSystem::RegisterParallelTick(ETickGroup tickGroup, ITickInterface* tickable)
+{
+    const std::lock_guard<std::mutex> LOCK(ParallelTickMutex);
+
+    auto& tickables = TickGroups[static_cast<size_t>(tickGroup)].ParallelTickables;
+
+    tickable->ParallelTickIndex = static_cast<uint32_t>(tickables.size());
+    tickables.push_back(tickable);
+}
+
+void CTickSystem::RemoveUnregisteredTickables()
+{
+    for (auto& group : TickGroups)
+    {
+        auto& tickables = group.ParallelTickables;
+        std::erase(tickables, nullptr);
+
+        for (uint32_t index = 0; index < tickables.size(); ++index)
+        {
+            tickables[index]->ParallelTickIndex = index;
+        }
+    }
+
+    HasRemovedTickables = false;
+}
+
 NAMESPACE_END() // namespace BE::Core
\ No newline at end of file
@@ -0,0 +1,65 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <Core.hpp>
+#include <CoreMacros.hpp>
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+NAMESPACE_BEGIN(BE::Core)
+
+/**
+ * @brief Read-only memory mapping of a whole file.
+ * @details The pages are loaded by the OS on first access and shared with the file cache, opening a file costs a few
+ * system calls whatever its size. The mapping is private to the object and released by Close() or the destructor, so
+ * the data must not be used after that.
+ */
+class CORE_API CMappedFile final
+{
+public:
+    CMappedFile() = default;
+    ~CMappedFile();
+
+    CMappedFile(const CMappedFile&) = delete;
+    CMappedFile(CMappedFile&& other) noexcept;
+
+    CMappedFile& operator=(const CMappedFile&) = delete;
+    CMappedFile& operator=(CMappedFile&& other) noexcept;
+
+    /**
+     * @brief Map a file, closing the file mapped before.
+     * @return false if the file cannot be opened or mapped, an empty file maps to no data but still succeeds.
+     */
+    bool Open(const std::filesystem::path& path);
+
+    void Close();
+
+    [[nodiscard]] bool IsOpen() const
+    {
+        return IsMapped;
+    }
+
+    // Mapped bytes of the file, at least page aligned
+    [[nodiscard]] std::span<const std::byte> GetData() const
+    {
+        return {Data, Size};
+    }
+
+private:
+    void MoveFrom(CMappedFile& other);
+
+private:
+    const std::byte* Data = nullptr;
+    size_t           Size = 0;
+    bool             IsMapped = false;
+};
+
+NAMESPACE_END() // namespace BE::Core
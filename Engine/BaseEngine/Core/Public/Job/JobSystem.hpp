@@ -0,0 +1,228 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <Core.hpp>
+#include <CoreMacros.hpp>
+#include <Job/WorkStealingDeque.hpp>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+NAMESPACE_BEGIN(BE::Core)
+
+// Bytes of user data stored inline in a job
+constexpr size_t JOB_DATA_SIZE = 40;
+
+// Jobs a worker deque can hold, a job pushed to a full deque runs immediately
+constexpr uint32_t JOB_DEQUE_CAPACITY = 4096;
+
+// Jobs allocated per thread before the ring of job storage wraps around, unfinished jobs are skipped when it does
+constexpr uint32_t MAX_JOBS_PER_THREAD = 4096;
+
+/**
+ * @brief Job System
+ * @details A fixed pool of worker threads, each owning a lock-free work-stealing deque. A worker pops its own deque
+ * from the bottom(the most recently pushed job, still warm in cache) and steals from the top of the other deques when
+ * it runs dry. Threads outside the pool push to a shared queue that the workers steal from as well.
+ *
+ * Jobs live in a per-thread ring, so creating one does not allocate. Every job counts itself and its unfinished
+ * children: a job is finished once its function returned and all children finished, and Wait() runs other jobs until
+ * then. Jobs may therefore create, run and wait for jobs themselves.
+ */
+class CORE_API CJobSystem final
+{
+public:
+    struct SJob;
+
+    // Body of a job, its data is read with GetJobData()
+    using FJobFunction = void (*)(SJob& job);
+
+    /**
+     * @brief A unit of work, one cache line.
+     */
+    struct alignas(64) SJob final
+    {
+        FJobFunction Function = nullptr;
+
+        // Job notified when this one finishes, nullptr for a root job
+        SJob* Parent = nullptr;
+
+        // 1 for the job itself plus 1 per unfinished child
+        std::atomic<int32_t> UnfinishedJobs{0};
+
+        alignas(8) std::array<std::byte, JOB_DATA_SIZE> Data{};
+    };
+
+private:
+    /**
+     * @brief Data of a ParallelFor() job: the range it covers and how to call the body.
+     */
+    struct SParallelForData final
+    {
+        void (*Invoke)(const void* body, uint32_t begin, uint32_t end) = nullptr;
+        const void* Body = nullptr;
+        CJobSystem* System = nullptr;
+        uint32_t    Begin = 0;
+        uint32_t    End = 0;
+        uint32_t    GrainSize = 1;
+    };
+
+    using FJobDeque = TWorkStealingDeque<SJob, JOB_DEQUE_CAPACITY>;
+
+    std::vector<std::thread> Workers;
+
+    // One deque per worker
+    std::vector<std::unique_ptr<FJobDeque>> Deques;
+
+    // Jobs run by threads outside the pool
+    std::mutex        ExternalMutex;
+    std::deque<SJob*> ExternalJobs;
+
+    // Idle workers sleep on WakeCondition until a job is queued
+    std::mutex              WakeMutex;
+    std::condition_variable WakeCondition;
+    std::atomic<uint32_t>   QueuedJobCount{0};
+    std::atomic<uint32_t>   SleepingWorkerCount{0};
+    bool                    IsStopping = false;
+
+public:
+    // One worker per hardware thread, minus the thread that waits for the jobs
+    CJobSystem();
+
+    // workerCount = 0 runs every job on the thread that waits for it
+    explicit CJobSystem(uint32_t workerCount);
+
+    ~CJobSystem();
+
+    CJobSystem(const CJobSystem&) = delete;
+    CJobSystem(CJobSystem&&) noexcept = delete;
+
+    CJobSystem& operator=(const CJobSystem&) = delete;
+    CJobSystem& operator=(CJobSystem&&) noexcept = delete;
+
+    // Get the shared job system
+    static CJobSystem& Get();
+
+    [[nodiscard]] uint32_t GetWorkerCount() const;
+
+    /**
+     * @brief Create a job from the ring of the calling thread.
+     * @param data Copied into the job, trivially copyable and at most JOB_DATA_SIZE bytes.
+     * @param parent The parent does not finish before this job, it must not have finished yet.
+     */
+    template <typename TData>
+    static SJob* CreateJob(FJobFunction function, const TData& data, SJob* parent = nullptr);
+
+    template <typename TData>
+    [[nodiscard]] static TData GetJobData(const SJob& job);
+
+    // Queue a job, it must not be run twice
+    void Run(SJob* job);
+
+    // Run queued jobs until the job and all of its children finished
+    void Wait(const SJob* job);
+
+    /**
+     * @brief Call body(begin, end) over sub-ranges covering [0, count) on the pool, and wait for all of them.
+     * @details Ranges are split lazily: a job keeps halving its range while its own deque is empty(so that idle
+     * workers find something to steal) and otherwise runs grainSize items at a time. Large counts are thus spread
+     * over the idle workers without creating a job per item.
+     * @param grainSize Smallest range handed to body, 0 picks one from count and the worker count.
+     */
+    template <typename TBody>
+    void ParallelFor(uint32_t count, uint32_t grainSize, const TBody& body);
+
+private:
+    void WorkerMain(uint32_t workerIndex);
+
+    // Run one job of the calling thread's deque, or stolen from the other queues
+    bool RunOneJob();
+
+    void Execute(SJob* job);
+
+    static void Finish(SJob* job);
+
+    // Allocate a job from the ring of the calling thread
+    static SJob* AllocateJob();
+
+    // Whether the calling thread has no job waiting in its own queue
+    [[nodiscard]] bool IsLocalQueueEmpty();
+
+    [[nodiscard]] uint32_t GetDefaultGrainSize(uint32_t count) const;
+
+    static void ParallelForJob(SJob& job);
+};
+
+template <typename TData>
+CJobSystem::SJob* CJobSystem::CreateJob(FJobFunction function, const TData& data, SJob* parent)
+{
+    static_assert(std::is_trivially_copyable_v<TData>, "Job data must be trivially copyable");
+    static_assert(sizeof(TData) <= JOB_DATA_SIZE, "Job data does not fit in a job");
+
+    SJob* job = AllocateJob();
+    job->Function = function;
+    job->Parent = parent;
+    job->UnfinishedJobs.store(1, std::memory_order_relaxed);
+    std::memcpy(job->Data.data(), &data, sizeof(TData));
+
+    if (parent != nullptr)
+    {
+        parent->UnfinishedJobs.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    return job;
+}
+
+template <typename TData>
+TData CJobSystem::GetJobData(const SJob& job)
+{
+    TData data;
+    std::memcpy(&data, job.Data.data(), sizeof(TData));
+    return data;
+}
+
+template <typename TBody>
+void CJobSystem::ParallelFor(uint32_t count, uint32_t grainSize, const TBody& body)
+{
+    const uint32_t GRAIN_SIZE = grainSize > 0 ? grainSize : GetDefaultGrainSize(count);
+
+    // 没有工作线程或范围不足以拆分时直接在当前线程执行
+    if (Workers.empty() || count <= GRAIN_SIZE)
+    {
+        if (count > 0)
+        {
+            body(0U, count);
+        }
+        return;
+    }
+
+    SParallelForData data;
+    data.Invoke = [](const void* bodyPtr, uint32_t begin, uint32_t end)
+    { (*static_cast<const TBody*>(bodyPtr))(begin, end); };
+    data.Body = &body;
+    data.System = this;
+    data.End = count;
+    data.GrainSize = GRAIN_SIZE;
+
+    SJob* root = CreateJob(&CJobSystem::ParallelForJob, data);
+    Run(root);
+    Wait(root);
+}
+
+NAMESPACE_END() // namespace BE::Core
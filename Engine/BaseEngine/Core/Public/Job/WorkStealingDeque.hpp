@@ -0,0 +1,135 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <CoreMacros.hpp>
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+NAMESPACE_BEGIN(BE::Core)
+
+/**
+ * @brief Lock-free work-stealing deque(Chase-Lev) of pointers with a fixed capacity.
+ * @details The owner thread pushes and pops at the bottom, any other thread steals from the top. Only the last element
+ * is contended: the owner and the thieves race for it with a compare-exchange on Top.
+ * Memory orders follow "Correct and Efficient Work-Stealing for Weak Memory Models"(Le et al., 2013).
+ * @tparam T Pointee type, the deque does not own the elements.
+ * @tparam Capacity Maximum number of elements, a power of 2.
+ */
+template <typename T, uint32_t Capacity>
+class TWorkStealingDeque final
+{
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of 2");
+
+private:
+    static constexpr int64_t MASK = static_cast<int64_t>(Capacity) - 1;
+
+    // Top 与 Bottom 分处不同的缓存行：Top 被窃取者频繁写入，Bottom 只由所有者写入
+    alignas(64) std::atomic<int64_t> Top{0};
+    alignas(64) std::atomic<int64_t> Bottom{0};
+
+    std::array<std::atomic<T*>, Capacity> Elements{};
+
+public:
+    TWorkStealingDeque() = default;
+    ~TWorkStealingDeque() = default;
+
+    TWorkStealingDeque(const TWorkStealingDeque&) = delete;
+    TWorkStealingDeque(TWorkStealingDeque&&) noexcept = delete;
+
+    TWorkStealingDeque& operator=(const TWorkStealingDeque&) = delete;
+    TWorkStealingDeque& operator=(TWorkStealingDeque&&) noexcept = delete;
+
+    /**
+     * @brief Push at the bottom, owner thread only.
+     * @return false if the deque is full.
+     */
+    bool Push(T* element)
+    {
+        const int64_t BOTTOM = Bottom.load(std::memory_order_relaxed);
+        const int64_t TOP = Top.load(std::memory_order_acquire);
+
+        if (BOTTOM - TOP >= static_cast<int64_t>(Capacity))
+        {
+            return false;
+        }
+
+        Elements[BOTTOM & MASK].store(element, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        Bottom.store(BOTTOM + 1, std::memory_order_relaxed);
+
+        return true;
+    }
+
+    /**
+     * @brief Pop the most recently pushed element, owner thread only.
+     * @return nullptr if the deque is empty or the last element was stolen.
+     */
+    T* Pop()
+    {
+        const int64_t BOTTOM = Bottom.load(std::memory_order_relaxed) - 1;
+        Bottom.store(BOTTOM, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t top = Top.load(std::memory_order_relaxed);
+
+        if (top > BOTTOM)
+        {
+            // 已经为空
+            Bottom.store(BOTTOM + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        T* element = Elements[BOTTOM & MASK].load(std::memory_order_relaxed);
+        if (top == BOTTOM)
+        {
+            // 最后一个元素：与窃取者竞争
+            if (!Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                element = nullptr;
+            }
+
+            Bottom.store(BOTTOM + 1, std::memory_order_relaxed);
+        }
+
+        return element;
+    }
+
+    /**
+     * @brief Steal the oldest element, any thread.
+     * @return nullptr if the deque is empty or another thread won the race.
+     */
+    T* Steal()
+    {
+        int64_t top = Top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t BOTTOM = Bottom.load(std::memory_order_acquire);
+
+        if (top >= BOTTOM)
+        {
+            return nullptr;
+        }
+
+        T* element = Elements[top & MASK].load(std::memory_order_relaxed);
+        if (!Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            return nullptr;
+        }
+
+        return element;
+    }
+
+    // Approximate when called by a thief
+    [[nodiscard]] bool IsEmpty() const
+    {
+        return Bottom.load(std::memory_order_relaxed) <= Top.load(std::memory_order_relaxed);
+    }
+};
+
+NAMESPACE_END() // namespace BE::Core
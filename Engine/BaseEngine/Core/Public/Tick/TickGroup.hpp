@@ -9,6 +9,7 @@
 #pragma once
 
 #include <CoreMacros.hpp>
+#include <cstddef>
 #include <cstdint>
 
 NAMESPACE_BEGIN(BE::Core)
@@ -23,6 +24,9 @@ enum class ETickGroup : uint8_t
     EndFrame,
 };
 
+// Number of tick groups, the groups tick in enum order
+constexpr size_t TICK_GROUP_COUNT = static_cast<size_t>(ETickGroup::EndFrame) + 1;
+
 constexpr ETickGroup TICK_GROUP_DEFAULT = ETickGroup::Update;
 
 NAMESPACE_END() // namespace BE::Core
\ No newline at end of file
@@ -10,10 +10,14 @@
 
 #include <CoreMacros.hpp>
 #include <Delegate/Delegate.hpp>
+#include <cstdint>
 
 NAMESPACE_BEGIN(BE::Core)
 
 enum class ETickGroup : unsigned char;
+class CTickSystem;
+
+constexpr uint32_t INVALID_PARALLEL_TICK_INDEX = UINT32_MAX;
 
 /**
  * @brief Interface for tickable objects.
@@ -38,6 +42,8 @@ public:
 
     [[nodiscard]] ETickGroup GetTickGroup() const;
 
+    [[nodiscard]] bool CanTickInParallel() const;
+
 private:
     void OnRegisterTickSuccess(NekiraDelegate::MultiSignalHandle handle);
 
@@ -48,8 +54,17 @@ public:
 protected:
     ETickGroup TickGroup;
 
+    // Opt-in: Tick() runs on a worker thread, concurrently with the other parallel tickables of the group.
+    // Set it in the constructor, like TickGroup. Tick() must then only touch state no other tickable of the group writes.
+    bool TickInParallel = false;
+
 private:
+    friend class CTickSystem;
+
     NekiraDelegate::MultiSignalHandle TickHandle{};
+
+    // Slot in the parallel tickables of the group, maintained by CTickSystem
+    uint32_t ParallelTickIndex = INVALID_PARALLEL_TICK_INDEX;
 };
 
 NAMESPACE_END() // namespace BE::Core
\ No newline at end of file
@@ -10,23 +10,36 @@
 
 #include <CoreMacros.hpp>
 #include <Delegate/Delegate.hpp>
+#include <Tick/TickGroup.hpp>
+#include <array>
+#include <mutex>
 #include <queue>
-#include <unordered_map>
+#include <vector>
 
 
 NAMESPACE_BEGIN(BE::Core)
 
 // Forward declaration
 class ITickInterface;
-enum class ETickGroup : uint8_t;
 
 /**
  * @brief Tick System to manage tick updates.
+ * @details Tick groups run one after another in ETickGroup order. Within a group the serial tickables run first on the
+ * ticking thread, then the tickables that opted into parallel tick are spread over the workers of the job system.
  */
 class CTickSystem final
 {
     NEKIRA_MULTI_DELEGATE(TTickSignature, float /* deltaTime */)
 
+    struct STickGroupData final
+    {
+        // Tickables called one after another on the ticking thread
+        TTickSignature SerialTicks;
+
+        // Tickables whose Tick() may run concurrently with each other
+        std::vector<ITickInterface*> ParallelTickables;
+    };
+
 public:
     CTickSystem(const CTickSystem&) = delete;
     CTickSystem(CTickSystem&&) noexcept = delete;
@@ -48,6 +61,17 @@ public:
     // Unregister a tick delegate
     void UnregisterTick(ETickGroup tickGroup, const NekiraDelegate::MultiSignalHandle& handle);
 
+    // Unregister a tickable that ticks in parallel
+    void UnregisterParallelTick(ETickGroup tickGroup, ITickInterface* tickable);
+
+    /**
+     * @brief Tick all registered tickables, group by group.
+     * @details Tickables pre-registered since the last call are registered first. A parallel tickable destroyed during
+     * the call is skipped from then on and removed once the call returns; it must not be destroyed while its own Tick()
+     * runs.
+     */
+    void Tick(float deltaTime);
+
 
 private:
     CTickSystem() = default;
@@ -58,10 +82,24 @@ private:
     // Register a tick delegate
     void RegisterTick(ETickGroup tickGroup, ITickInterface* tickable, void (ITickInterface::*funcPtr)(float));
 
-    // Queue of pre-registered tickables
+    // Register a tickable that ticks in parallel
+    void RegisterParallelTick(ETickGroup tickGroup, ITickInterface* tickable);
+
+    // Drop the parallel tickables unregistered during Tick()
+    void RemoveUnregisteredTickables();
+
+    // Queue of pre-registered tickables, tickables may be created during a parallel tick
+    std::mutex                  PreRegisterMutex;
     std::queue<ITickInterface*> PreRegisteredTickables;
 
-    std::unordered_map<ETickGroup, TTickSignature> TickGroupMap;
+    // Guards the parallel tickables against unregistration from other threads, which only clears the slot while
+    // IsTicking is set
+    std::mutex ParallelTickMutex;
+    bool       IsTicking = false;
+    bool       HasRemovedTickables = false;
+
+    // Indexed by ETickGroup
+    std::array<STickGroupData, TICK_GROUP_COUNT> TickGroups;
 };
 
 
@@ -0,0 +1,176 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#include <BroadPhase2D/AABBTreeBroadPhase2D.hpp>
+#include <algorithm>
+#include <cassert>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+CAABBTreeBroadPhase2D::CAABBTreeBroadPhase2D(float aabbMargin) : Tree(aabbMargin)
+{}
+
+int32_t CAABBTreeBroadPhase2D::CreateProxy(const CBoundingAABB2D& aabb, uint32_t colliderId, bool isDynamic)
+{
+    const int32_t PROXY_ID = Tree.CreateProxy(aabb, colliderId);
+
+    if (static_cast<size_t>(PROXY_ID) >= DynamicProxyIndices.size())
+    {
+        DynamicProxyIndices.resize(static_cast<size_t>(PROXY_ID) + 1, INVALID_PROXY_ID);
+    }
+
+    if (isDynamic)
+    {
+        DynamicProxyIndices[PROXY_ID] = static_cast<int32_t>(DynamicProxies.size());
+        DynamicProxies.push_back(PROXY_ID);
+    }
+    else
+    {
+        DynamicProxyIndices[PROXY_ID] = INVALID_PROXY_ID;
+    }
+
+    return PROXY_ID;
+}
+
+void CAABBTreeBroadPhase2D::CreateProxies(const SBroadPhaseBatch2D& batch, std::span<int32_t> outProxyIds)
+{
+    if (batch.TreeNodes.empty())
+    {
+        IBroadPhase2D::CreateProxies(batch, outProxyIds);
+        return;
+    }
+
+    std::vector<int32_t> nodeIds(batch.TreeNodes.size());
+    Tree.InsertSubtree(batch.TreeNodes, batch.TreeRoot, batch.ColliderIds, nodeIds);
+
+    DynamicProxyIndices.resize(Tree.GetNodes().size(), INVALID_PROXY_ID);
+
+    for (size_t index = 0; index < batch.TreeNodes.size(); ++index)
+    {
+        const STreeNode2D& node = batch.TreeNodes[index];
+        if (node.Height != 0)
+        {
+            continue;
+        }
+
+        const int32_t PROXY_ID = nodeIds[index];
+        outProxyIds[node.UserData] = PROXY_ID;
+
+        if (batch.IsDynamic[node.UserData] != 0)
+        {
+            DynamicProxyIndices[PROXY_ID] = static_cast<int32_t>(DynamicProxies.size());
+            DynamicProxies.push_back(PROXY_ID);
+        }
+        else
+        {
+            DynamicProxyIndices[PROXY_ID] = INVALID_PROXY_ID;
+        }
+    }
+}
+
+void CAABBTreeBroadPhase2D::DestroyProxy(int32_t proxyId)
+{
+    const int32_t DYNAMIC_INDEX = DynamicProxyIndices[proxyId];
+    if (DYNAMIC_INDEX != INVALID_PROXY_ID)
+    {
+        // 与末尾交换后移除
+        const int32_t LAST_PROXY = DynamicProxies.back();
+        DynamicProxies[DYNAMIC_INDEX] = LAST_PROXY;
+        DynamicProxyIndices[LAST_PROXY] = DYNAMIC_INDEX;
+        DynamicProxies.pop_back();
+        DynamicProxyIndices[proxyId] = INVALID_PROXY_ID;
+    }
+
+    Tree.DestroyProxy(proxyId);
+}
+
+void CAABBTreeBroadPhase2D::MoveProxy(int32_t proxyId, const CBoundingAABB2D& aabb, const SVector2F& displacement)
+{
+    Tree.MoveProxy(proxyId, aabb, displacement);
+}
+
+void CAABBTreeBroadPhase2D::UpdatePairs(std::vector<SBroadPhasePair2D>& outPairs)
+{
+    outPairs.clear();
+
+    for (const int32_t PROXY_ID : DynamicProxies)
+    {
+        const uint32_t COLLIDER_ID = Tree.GetUserData(PROXY_ID);
+
+        Tree.Query(Tree.GetFatAABB(PROXY_ID),
+                   [&](int32_t otherProxy)
+                   {
+                       // 两个动态代理会互相查询到对方，只保留 ProxyId 较小一方的结果
+                       if (otherProxy == PROXY_ID || (otherProxy < PROXY_ID && IsDynamicProxy(otherProxy)))
+                       {
+                           return true;
+                       }
+
+                       const uint32_t OTHER_COLLIDER = Tree.GetUserData(otherProxy);
+                       outPairs.push_back({std::min(COLLIDER_ID, OTHER_COLLIDER), std::max(COLLIDER_ID, OTHER_COLLIDER)});
+                       return true;
+                   });
+    }
+
+    // 排序使候选对顺序与代理的插入顺序及树的形状无关
+    std::sort(outPairs.begin(), outPairs.end());
+}
+
+void CAABBTreeBroadPhase2D::Query(const CBoundingAABB2D& aabb, std::vector<uint32_t>& outColliders) const
+{
+    Tree.Query(aabb,
+               [&](int32_t proxyId)
+               {
+                   outColliders.push_back(Tree.GetUserData(proxyId));
+                   return true;
+               });
+}
+
+void CAABBTreeBroadPhase2D::Query(const CBoundingAABB2D& aabb, IBroadPhaseQueryCallback2D& callback) const
+{
+    Tree.Query(aabb, [&](int32_t proxyId) { return callback.ReportCollider(Tree.GetUserData(proxyId)); });
+}
+
+void CAABBTreeBroadPhase2D::RayCast(SRayPacket2D& packet, IRayPacketCallback2D& callback) const
+{
+    Tree.RayCast(packet, [&](int32_t proxyId, uint32_t laneMask)
+                 { callback.ReportCollider(Tree.GetUserData(proxyId), laneMask, packet); });
+}
+
+CBoundingAABB2D CAABBTreeBroadPhase2D::GetFatAABB(int32_t proxyId) const
+{
+    return Tree.GetFatAABB(proxyId);
+}
+
+size_t CAABBTreeBroadPhase2D::GetProxyCount() const
+{
+    return Tree.GetProxyCount();
+}
+
+std::unique_ptr<IBroadPhase2D> CAABBTreeBroadPhase2D::Clone() const
+{
+    return std::make_unique<CAABBTreeBroadPhase2D>(*this);
+}
+
+void CAABBTreeBroadPhase2D::CopyFrom(const IBroadPhase2D& other)
+{
+    assert(dynamic_cast<const CAABBTreeBroadPhase2D*>(&other) != nullptr);
+    *this = static_cast<const CAABBTreeBroadPhase2D&>(other);
+}
+
+const CDynamicAABBTree2D& CAABBTreeBroadPhase2D::GetTree() const
+{
+    return Tree;
+}
+
+bool CAABBTreeBroadPhase2D::IsDynamicProxy(int32_t proxyId) const
+{
+    return DynamicProxyIndices[proxyId] != INVALID_PROXY_ID;
+}
+
+NAMESPACE_END() // namespace PHYE::Physics2D
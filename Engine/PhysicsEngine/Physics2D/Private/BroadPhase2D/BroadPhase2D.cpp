@@ -0,0 +1,24 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#include <BroadPhase2D/BroadPhase2D.hpp>
+#include <cassert>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+void IBroadPhase2D::CreateProxies(const SBroadPhaseBatch2D& batch, std::span<int32_t> outProxyIds)
+{
+    assert(outProxyIds.size() >= batch.AABBs.size());
+
+    for (size_t index = 0; index < batch.AABBs.size(); ++index)
+    {
+        outProxyIds[index] = CreateProxy(batch.AABBs[index], batch.ColliderIds[index], batch.IsDynamic[index] != 0);
+    }
+}
+
+NAMESPACE_END() // namespace PHYE::Physics2D
@@ -0,0 +1,521 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#include <BroadPhase2D/DynamicAABBTree2D.hpp>
+#include <cassert>
+#include <cstdlib>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+CDynamicAABBTree2D::CDynamicAABBTree2D(float aabbMargin, float displacementMultiplier)
+    : Root(NULL_TREE_NODE), FreeList(NULL_TREE_NODE), ProxyCount(0), AABBMargin(aabbMargin),
+      DisplacementMultiplier(displacementMultiplier)
+{}
+
+int32_t CDynamicAABBTree2D::CreateProxy(const CBoundingAABB2D& aabb, uint32_t userData)
+{
+    const int32_t PROXY_ID = AllocateNode();
+
+    STreeNode2D& node = Nodes[PROXY_ID];
+    node.AABB = aabb.Fattened(AABBMargin);
+    node.UserData = userData;
+    node.Height = 0;
+
+    InsertLeaf(PROXY_ID);
+    ++ProxyCount;
+
+    return PROXY_ID;
+}
+
+void CDynamicAABBTree2D::DestroyProxy(int32_t proxyId)
+{
+    assert(0 <= proxyId && proxyId < static_cast<int32_t>(Nodes.size()));
+    assert(Nodes[proxyId].IsLeaf());
+
+    RemoveLeaf(proxyId);
+    FreeNode(proxyId);
+    --ProxyCount;
+}
+
+bool CDynamicAABBTree2D::MoveProxy(int32_t proxyId, const CBoundingAABB2D& aabb, const SVector2F& displacement)
+{
+    assert(0 <= proxyId && proxyId < static_cast<int32_t>(Nodes.size()));
+    assert(Nodes[proxyId].IsLeaf());
+
+    // 预测下一次更新前的运动，沿位移方向扩展胖包围盒
+    const CBoundingAABB2D FAT_AABB = aabb.Fattened(AABBMargin).Swept(displacement * DisplacementMultiplier);
+
+    const CBoundingAABB2D& treeAABB = Nodes[proxyId].AABB;
+    if (treeAABB.Contains(aabb))
+    {
+        // 仍在胖包围盒内；但若胖包围盒相对当前预测过于宽松(例如物体已减速)，则重新插入以收紧
+        const CBoundingAABB2D HUGE_AABB = FAT_AABB.Fattened(4.0F * AABBMargin);
+        if (HUGE_AABB.Contains(treeAABB))
+        {
+            return false;
+        }
+    }
+
+    RemoveLeaf(proxyId);
+    Nodes[proxyId].AABB = FAT_AABB;
+    InsertLeaf(proxyId);
+
+    return true;
+}
+
+void CDynamicAABBTree2D::Clear()
+{
+    Nodes.clear();
+    Root = NULL_TREE_NODE;
+    FreeList = NULL_TREE_NODE;
+    ProxyCount = 0;
+}
+
+void CDynamicAABBTree2D::InsertSubtree(std::span<const STreeNode2D> nodes, int32_t root,
+                                       std::span<const uint32_t> userData, std::span<int32_t> outNodeIds)
+{
+    assert(0 <= root && root < static_cast<int32_t>(nodes.size()));
+    assert(outNodeIds.size() >= nodes.size());
+
+    if (Nodes.capacity() < Nodes.size() + nodes.size())
+    {
+        Nodes.reserve(Nodes.size() + nodes.size());
+    }
+
+    // 先分配全部节点再改写链接，分配可能使数组扩容
+    for (size_t index = 0; index < nodes.size(); ++index)
+    {
+        outNodeIds[index] = nodes[index].Height < 0 ? NULL_TREE_NODE : AllocateNode();
+    }
+
+    auto remap = [&](int32_t nodeId) { return nodeId == NULL_TREE_NODE ? NULL_TREE_NODE : outNodeIds[nodeId]; };
+
+    for (size_t index = 0; index < nodes.size(); ++index)
+    {
+        const STreeNode2D& source = nodes[index];
+        if (source.Height < 0)
+        {
+            continue;
+        }
+
+        STreeNode2D& node = Nodes[outNodeIds[index]];
+        node = source;
+        node.Parent = remap(source.Parent);
+        node.Child1 = remap(source.Child1);
+        node.Child2 = remap(source.Child2);
+
+        if (source.IsLeaf())
+        {
+            node.UserData = userData[source.UserData];
+            ++ProxyCount;
+        }
+    }
+
+    InsertLeaf(outNodeIds[root]);
+}
+
+int32_t CDynamicAABBTree2D::GetHeight() const
+{
+    return Root == NULL_TREE_NODE ? 0 : Nodes[Root].Height;
+}
+
+int32_t CDynamicAABBTree2D::GetMaxBalance() const
+{
+    int32_t maxBalance = 0;
+    for (const auto& node : Nodes)
+    {
+        if (node.Height <= 1)
+        {
+            continue;
+        }
+
+        const int32_t BALANCE = std::abs(Nodes[node.Child2].Height - Nodes[node.Child1].Height);
+        maxBalance = BE::Math::Max(maxBalance, BALANCE);
+    }
+
+    return maxBalance;
+}
+
+float CDynamicAABBTree2D::GetAreaRatio() const
+{
+    if (Root == NULL_TREE_NODE)
+    {
+        return 0.0F;
+    }
+
+    const float ROOT_PERIMETER = Nodes[Root].AABB.Perimeter();
+    if (ROOT_PERIMETER <= 0.0F)
+    {
+        return 0.0F;
+    }
+
+    float totalPerimeter = 0.0F;
+    for (const auto& node : Nodes)
+    {
+        if (node.Height >= 0)
+        {
+            totalPerimeter += node.AABB.Perimeter();
+        }
+    }
+
+    return totalPerimeter / ROOT_PERIMETER;
+}
+
+void CDynamicAABBTree2D::Validate() const
+{
+#ifndef NDEBUG
+    if (Root != NULL_TREE_NODE)
+    {
+        assert(Nodes[Root].Parent == NULL_TREE_NODE);
+        ValidateNode(Root);
+    }
+
+    size_t freeCount = 0;
+    for (int32_t freeNode = FreeList; freeNode != NULL_TREE_NODE; freeNode = Nodes[freeNode].Parent)
+    {
+        assert(Nodes[freeNode].Height == -1);
+        ++freeCount;
+    }
+
+    assert(GetHeight() == ComputeHeight(Root));
+    assert(Nodes.size() - freeCount == (ProxyCount == 0 ? 0 : (2 * ProxyCount) - 1));
+#endif
+}
+
+int32_t CDynamicAABBTree2D::AllocateNode()
+{
+    if (FreeList == NULL_TREE_NODE)
+    {
+        Nodes.emplace_back();
+        return static_cast<int32_t>(Nodes.size() - 1);
+    }
+
+    const int32_t NODE_ID = FreeList;
+    FreeList = Nodes[NODE_ID].Parent;
+
+    STreeNode2D& node = Nodes[NODE_ID];
+    node.Parent = NULL_TREE_NODE;
+    node.Child1 = NULL_TREE_NODE;
+    node.Child2 = NULL_TREE_NODE;
+    node.Height = 0;
+    node.UserData = 0;
+
+    return NODE_ID;
+}
+
+void CDynamicAABBTree2D::FreeNode(int32_t nodeId)
+{
+    STreeNode2D& node = Nodes[nodeId];
+    node.Parent = FreeList;
+    node.Child1 = NULL_TREE_NODE;
+    node.Child2 = NULL_TREE_NODE;
+    node.Height = -1;
+    FreeList = nodeId;
+}
+
+void CDynamicAABBTree2D::InsertLeaf(int32_t leaf)
+{
+    if (Root == NULL_TREE_NODE)
+    {
+        Root = leaf;
+        Nodes[Root].Parent = NULL_TREE_NODE;
+        return;
+    }
+
+    // 1. 按周长代价(SAH)自顶向下寻找最佳兄弟节点
+    const CBoundingAABB2D LEAF_AABB = Nodes[leaf].AABB;
+
+    int32_t index = Root;
+    while (!Nodes[index].IsLeaf())
+    {
+        const STreeNode2D& node = Nodes[index];
+
+        const float PERIMETER = node.AABB.Perimeter();
+        const float COMBINED_PERIMETER = CBoundingAABB2D::Union(node.AABB, LEAF_AABB).Perimeter();
+
+        // 在此处新建父节点的代价
+        const float COST = 2.0F * COMBINED_PERIMETER;
+
+        // 继续下探时，祖先节点增大带来的代价
+        const float INHERITANCE_COST = 2.0F * (COMBINED_PERIMETER - PERIMETER);
+
+        auto descendCost = [&](int32_t child) -> float
+        {
+            const STreeNode2D& childNode = Nodes[child];
+            const float        UNION_PERIMETER = CBoundingAABB2D::Union(childNode.AABB, LEAF_AABB).Perimeter();
+
+            if (childNode.IsLeaf())
+            {
+                return UNION_PERIMETER + INHERITANCE_COST;
+            }
+
+            return (UNION_PERIMETER - childNode.AABB.Perimeter()) + INHERITANCE_COST;
+        };
+
+        const float COST1 = descendCost(node.Child1);
+        const float COST2 = descendCost(node.Child2);
+
+        if (COST < COST1 && COST < COST2)
+        {
+            break;
+        }
+
+        index = (COST1 < COST2) ? node.Child1 : node.Child2;
+    }
+
+    const int32_t SIBLING = index;
+
+    // 2. 新建父节点，替换兄弟节点的位置(先分配，避免数组扩容使引用失效)
+    const int32_t NEW_PARENT = AllocateNode();
+    const int32_t OLD_PARENT = Nodes[SIBLING].Parent;
+
+    STreeNode2D& newParent = Nodes[NEW_PARENT];
+    newParent.Parent = OLD_PARENT;
+    newParent.AABB = CBoundingAABB2D::Union(LEAF_AABB, Nodes[SIBLING].AABB);
+    newParent.Height = Nodes[SIBLING].Height + 1;
+    newParent.Child1 = SIBLING;
+    newParent.Child2 = leaf;
+
+    if (OLD_PARENT != NULL_TREE_NODE)
+    {
+        STreeNode2D& oldParent = Nodes[OLD_PARENT];
+        if (oldParent.Child1 == SIBLING)
+        {
+            oldParent.Child1 = NEW_PARENT;
+        }
+        else
+        {
+            oldParent.Child2 = NEW_PARENT;
+        }
+    }
+    else
+    {
+        Root = NEW_PARENT;
+    }
+
+    Nodes[SIBLING].Parent = NEW_PARENT;
+    Nodes[leaf].Parent = NEW_PARENT;
+
+    // 3. 向上修正包围盒与高度，并旋转保持平衡
+    Refit(Nodes[leaf].Parent);
+}
+
+void CDynamicAABBTree2D::RemoveLeaf(int32_t leaf)
+{
+    if (leaf == Root)
+    {
+        Root = NULL_TREE_NODE;
+        return;
+    }
+
+    const int32_t PARENT = Nodes[leaf].Parent;
+    const int32_t GRAND_PARENT = Nodes[PARENT].Parent;
+    const int32_t SIBLING = (Nodes[PARENT].Child1 == leaf) ? Nodes[PARENT].Child2 : Nodes[PARENT].Child1;
+
+    // 用兄弟节点替换父节点，并释放父节点
+    if (GRAND_PARENT != NULL_TREE_NODE)
+    {
+        STreeNode2D& grandParent = Nodes[GRAND_PARENT];
+        if (grandParent.Child1 == PARENT)
+        {
+            grandParent.Child1 = SIBLING;
+        }
+        else
+        {
+            grandParent.Child2 = SIBLING;
+        }
+
+        Nodes[SIBLING].Parent = GRAND_PARENT;
+        FreeNode(PARENT);
+
+        Refit(GRAND_PARENT);
+    }
+    else
+    {
+        Root = SIBLING;
+        Nodes[SIBLING].Parent = NULL_TREE_NODE;
+        FreeNode(PARENT);
+    }
+
+    Nodes[leaf].Parent = NULL_TREE_NODE;
+}
+
+void CDynamicAABBTree2D::Refit(int32_t nodeId)
+{
+    int32_t index = nodeId;
+    while (index != NULL_TREE_NODE)
+    {
+        index = Balance(index);
+
+        STreeNode2D&       node = Nodes[index];
+        const STreeNode2D& child1 = Nodes[node.Child1];
+        const STreeNode2D& child2 = Nodes[node.Child2];
+
+        node.Height = 1 + BE::Math::Max(child1.Height, child2.Height);
+        node.AABB = CBoundingAABB2D::Union(child1.AABB, child2.AABB);
+
+        index = node.Parent;
+    }
+}
+
+int32_t CDynamicAABBTree2D::Balance(int32_t nodeId)
+{
+    const int32_t I_A = nodeId;
+    STreeNode2D&  a = Nodes[I_A];
+
+    if (a.IsLeaf() || a.Height < 2)
+    {
+        return I_A;
+    }
+
+    const int32_t I_B = a.Child1;
+    const int32_t I_C = a.Child2;
+    STreeNode2D&  b = Nodes[I_B];
+    STreeNode2D&  c = Nodes[I_C];
+
+    const int32_t BALANCE = c.Height - b.Height;
+
+    // C 过高：将 C 旋转为子树根，A 成为 C 的子节点
+    if (BALANCE > 1)
+    {
+        const int32_t I_F = c.Child1;
+        const int32_t I_G = c.Child2;
+        STreeNode2D&  f = Nodes[I_F];
+        STreeNode2D&  g = Nodes[I_G];
+
+        c.Child1 = I_A;
+        c.Parent = a.Parent;
+        a.Parent = I_C;
+
+        if (c.Parent != NULL_TREE_NODE)
+        {
+            STreeNode2D& parent = Nodes[c.Parent];
+            (parent.Child1 == I_A ? parent.Child1 : parent.Child2) = I_C;
+        }
+        else
+        {
+            Root = I_C;
+        }
+
+        // 较高的孙节点留在 C 下，较矮的交给 A
+        if (f.Height > g.Height)
+        {
+            c.Child2 = I_F;
+            a.Child2 = I_G;
+            g.Parent = I_A;
+            a.AABB = CBoundingAABB2D::Union(b.AABB, g.AABB);
+            c.AABB = CBoundingAABB2D::Union(a.AABB, f.AABB);
+
+            a.Height = 1 + BE::Math::Max(b.Height, g.Height);
+            c.Height = 1 + BE::Math::Max(a.Height, f.Height);
+        }
+        else
+        {
+            c.Child2 = I_G;
+            a.Child2 = I_F;
+            f.Parent = I_A;
+            a.AABB = CBoundingAABB2D::Union(b.AABB, f.AABB);
+            c.AABB = CBoundingAABB2D::Union(a.AABB, g.AABB);
+
+            a.Height = 1 + BE::Math::Max(b.Height, f.Height);
+            c.Height = 1 + BE::Math::Max(a.Height, g.Height);
+        }
+
+        return I_C;
+    }
+
+    // B 过高：将 B 旋转上来(与上面对称)
+    if (BALANCE < -1)
+    {
+        const int32_t I_D = b.Child1;
+        const int32_t I_E = b.Child2;
+        STreeNode2D&  d = Nodes[I_D];
+        STreeNode2D&  e = Nodes[I_E];
+
+        b.Child1 = I_A;
+        b.Parent = a.Parent;
+        a.Parent = I_B;
+
+        if (b.Parent != NULL_TREE_NODE)
+        {
+            STreeNode2D& parent = Nodes[b.Parent];
+            (parent.Child1 == I_A ? parent.Child1 : parent.Child2) = I_B;
+        }
+        else
+        {
+            Root = I_B;
+        }
+
+        if (d.Height > e.Height)
+        {
+            b.Child2 = I_D;
+            a.Child1 = I_E;
+            e.Parent = I_A;
+            a.AABB = CBoundingAABB2D::Union(c.AABB, e.AABB);
+            b.AABB = CBoundingAABB2D::Union(a.AABB, d.AABB);
+
+            a.Height = 1 + BE::Math::Max(c.Height, e.Height);
+            b.Height = 1 + BE::Math::Max(a.Height, d.Height);
+        }
+        else
+        {
+            b.Child2 = I_E;
+            a.Child1 = I_D;
+            d.Parent = I_A;
+            a.AABB = CBoundingAABB2D::Union(c.AABB, d.AABB);
+            b.AABB = CBoundingAABB2D::Union(a.AABB, e.AABB);
+
+            a.Height = 1 + BE::Math::Max(c.Height, d.Height);
+            b.Height = 1 + BE::Math::Max(a.Height, e.Height);
+        }
+
+        return I_B;
+    }
+
+    return I_A;
+}
+
+int32_t CDynamicAABBTree2D::ComputeHeight(int32_t nodeId) const
+{
+    if (nodeId == NULL_TREE_NODE)
+    {
+        return 0;
+    }
+
+    const STreeNode2D& node = Nodes[nodeId];
+    if (node.IsLeaf())
+    {
+        return 0;
+    }
+
+    return 1 + BE::Math::Max(ComputeHeight(node.Child1), ComputeHeight(node.Child2));
+}
+
+void CDynamicAABBTree2D::ValidateNode(int32_t nodeId) const
+{
+    const STreeNode2D& node = Nodes[nodeId];
+    if (node.IsLeaf())
+    {
+        assert(node.Child2 == NULL_TREE_NODE);
+        assert(node.Height == 0);
+        return;
+    }
+
+    const STreeNode2D& child1 = Nodes[node.Child1];
+    const STreeNode2D& child2 = Nodes[node.Child2];
+
+    assert(child1.Parent == nodeId);
+    assert(child2.Parent == nodeId);
+    assert(node.Height == 1 + BE::Math::Max(child1.Height, child2.Height));
+    assert(node.AABB.Contains(child1.AABB) && node.AABB.Contains(child2.AABB));
+
+    ValidateNode(node.Child1);
+    ValidateNode(node.Child2);
+}
+
+NAMESPACE_END() // namespace PHYE::Physics2D
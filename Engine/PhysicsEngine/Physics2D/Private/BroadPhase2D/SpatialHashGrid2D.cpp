@@ -0,0 +1,346 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#include <BroadPhase2D/SpatialHashGrid2D.hpp>
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cmath>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+namespace
+{
+
+// 单元坐标的上限，防止极端坐标转换为整数时溢出
+constexpr float MAX_CELL_COORDINATE = 1.0E9F;
+
+} // namespace
+
+CSpatialHashGrid2D::CSpatialHashGrid2D(float cellSize, float aabbMargin)
+    : ProxyCount(0), DesiredCellSize(cellSize), AABBMargin(aabbMargin), CellSize(1.0F), InverseCellSize(1.0F),
+      BucketMask(0)
+{}
+
+int32_t CSpatialHashGrid2D::CreateProxy(const CBoundingAABB2D& aabb, uint32_t colliderId, bool isDynamic)
+{
+    int32_t proxyId = INVALID_PROXY_ID;
+    if (FreeProxies.empty())
+    {
+        proxyId = static_cast<int32_t>(Proxies.size());
+        Proxies.emplace_back();
+    }
+    else
+    {
+        proxyId = FreeProxies.back();
+        FreeProxies.pop_back();
+    }
+
+    SGridProxy2D& proxy = Proxies[proxyId];
+    proxy.AABB = aabb.Fattened(AABBMargin);
+    proxy.ColliderId = colliderId;
+    proxy.IsDynamic = isDynamic;
+    proxy.IsInUse = true;
+
+    ++ProxyCount;
+    return proxyId;
+}
+
+void CSpatialHashGrid2D::DestroyProxy(int32_t proxyId)
+{
+    assert(Proxies[proxyId].IsInUse);
+
+    Proxies[proxyId].IsInUse = false;
+    FreeProxies.push_back(proxyId);
+    --ProxyCount;
+}
+
+void CSpatialHashGrid2D::MoveProxy(int32_t proxyId, const CBoundingAABB2D& aabb, const SVector2F& displacement)
+{
+    // 网格每步重建，只需覆盖到下一次更新为止的位移，快速移动的代理在接触前一步就能配对
+    Proxies[proxyId].AABB = aabb.Fattened(AABBMargin).Swept(displacement);
+}
+
+void CSpatialHashGrid2D::UpdatePairs(std::vector<SBroadPhasePair2D>& outPairs)
+{
+    outPairs.clear();
+
+    Rebuild();
+
+    // 1. 网格内：同一桶、同一单元的代理两两测试
+    const uint32_t BUCKET_COUNT = BucketMask + 1;
+    for (uint32_t bucket = 0; bucket < BUCKET_COUNT; ++bucket)
+    {
+        const uint32_t BEGIN = BucketStarts[bucket];
+        const uint32_t END = BucketStarts[bucket + 1];
+
+        for (uint32_t i = BEGIN; i + 1 < END; ++i)
+        {
+            const SGridEntry2D& entryA = Entries[i];
+            const SGridProxy2D& proxyA = Proxies[entryA.ProxyId];
+
+            for (uint32_t j = i + 1; j < END; ++j)
+            {
+                const SGridEntry2D& entryB = Entries[j];
+
+                // 哈希冲突：不同单元落在同一个桶
+                if (entryA.CellX != entryB.CellX || entryA.CellY != entryB.CellY)
+                {
+                    continue;
+                }
+
+                const SGridProxy2D& proxyB = Proxies[entryB.ProxyId];
+                if ((!proxyA.IsDynamic && !proxyB.IsDynamic) || !proxyA.AABB.Overlaps(proxyB.AABB))
+                {
+                    continue;
+                }
+
+                // 只在重叠区域左下角所在的单元上报，避免跨多个单元的重复对
+                const int32_t REF_CELL_X = ToCell(BE::Math::Max(proxyA.AABB.GetMin().X, proxyB.AABB.GetMin().X));
+                const int32_t REF_CELL_Y = ToCell(BE::Math::Max(proxyA.AABB.GetMin().Y, proxyB.AABB.GetMin().Y));
+                if (REF_CELL_X != entryA.CellX || REF_CELL_Y != entryA.CellY)
+                {
+                    continue;
+                }
+
+                outPairs.push_back({BE::Math::Min(proxyA.ColliderId, proxyB.ColliderId),
+                                    BE::Math::Max(proxyA.ColliderId, proxyB.ColliderId)});
+            }
+        }
+    }
+
+    // 2. 大代理：与其余所有代理直接测试
+    for (const int32_t LARGE_PROXY : LargeProxies)
+    {
+        for (int32_t other = 0; other < static_cast<int32_t>(Proxies.size()); ++other)
+        {
+            if (!Proxies[other].IsInUse || other == LARGE_PROXY)
+            {
+                continue;
+            }
+
+            // 两个大代理之间只由 id 较小者测试
+            const SCellRange2D& otherRange = CellRanges[other];
+            const bool          OTHER_IS_LARGE = otherRange.MaxX < otherRange.MinX;
+            if (OTHER_IS_LARGE && other < LARGE_PROXY)
+            {
+                continue;
+            }
+
+            AddPairIfOverlapping(LARGE_PROXY, other, outPairs);
+        }
+    }
+
+    std::sort(outPairs.begin(), outPairs.end());
+}
+
+void CSpatialHashGrid2D::Query(const CBoundingAABB2D& aabb, std::vector<uint32_t>& outColliders) const
+{
+    // 排序结构只在 UpdatePairs() 中刷新，之后移动或创建的代理不在其中，逐个测试
+    for (const auto& proxy : Proxies)
+    {
+        if (proxy.IsInUse && proxy.AABB.Overlaps(aabb))
+        {
+            outColliders.push_back(proxy.ColliderId);
+        }
+    }
+}
+
+void CSpatialHashGrid2D::Query(const CBoundingAABB2D& aabb, IBroadPhaseQueryCallback2D& callback) const
+{
+    for (const auto& proxy : Proxies)
+    {
+        if (proxy.IsInUse && proxy.AABB.Overlaps(aabb) && !callback.ReportCollider(proxy.ColliderId))
+        {
+            return;
+        }
+    }
+}
+
+void CSpatialHashGrid2D::RayCast(SRayPacket2D& packet, IRayPacketCallback2D& callback) const
+{
+    // 与 Query() 相同，逐个代理做包围盒测试
+    for (const auto& proxy : Proxies)
+    {
+        if (packet.ActiveMask == 0)
+        {
+            return;
+        }
+
+        if (!proxy.IsInUse)
+        {
+            continue;
+        }
+
+        const uint32_t LANE_MASK = RayPacketOverlaps(packet, proxy.AABB);
+        if (LANE_MASK != 0)
+        {
+            callback.ReportCollider(proxy.ColliderId, LANE_MASK, packet);
+        }
+    }
+}
+
+CBoundingAABB2D CSpatialHashGrid2D::GetFatAABB(int32_t proxyId) const
+{
+    return Proxies[proxyId].AABB;
+}
+
+size_t CSpatialHashGrid2D::GetProxyCount() const
+{
+    return ProxyCount;
+}
+
+std::unique_ptr<IBroadPhase2D> CSpatialHashGrid2D::Clone() const
+{
+    return std::make_unique<CSpatialHashGrid2D>(*this);
+}
+
+void CSpatialHashGrid2D::CopyFrom(const IBroadPhase2D& other)
+{
+    assert(dynamic_cast<const CSpatialHashGrid2D*>(&other) != nullptr);
+    *this = static_cast<const CSpatialHashGrid2D&>(other);
+}
+
+float CSpatialHashGrid2D::GetCellSize() const
+{
+    return CellSize;
+}
+
+float CSpatialHashGrid2D::ComputeCellSize() const
+{
+    if (DesiredCellSize > 0.0F)
+    {
+        return DesiredCellSize;
+    }
+
+    // 自动模式：取动态代理的平均尺寸，使大多数代理只覆盖 1~4 个单元
+    float  totalSize = 0.0F;
+    size_t count = 0;
+    for (const auto& proxy : Proxies)
+    {
+        if (proxy.IsInUse && proxy.IsDynamic)
+        {
+            const SVector2F SIZE = proxy.AABB.GetMax() - proxy.AABB.GetMin();
+            totalSize += BE::Math::Max(SIZE.X, SIZE.Y);
+            ++count;
+        }
+    }
+
+    return (count > 0 && totalSize > 0.0F) ? totalSize / static_cast<float>(count) : 1.0F;
+}
+
+int32_t CSpatialHashGrid2D::ToCell(float coordinate) const
+{
+    const float CELL = std::floor(coordinate * InverseCellSize);
+    return static_cast<int32_t>(BE::Math::Clamp(CELL, -MAX_CELL_COORDINATE, MAX_CELL_COORDINATE));
+}
+
+CSpatialHashGrid2D::SCellRange2D CSpatialHashGrid2D::ComputeCellRange(const CBoundingAABB2D& aabb) const
+{
+    SCellRange2D range;
+    range.MinX = ToCell(aabb.GetMin().X);
+    range.MinY = ToCell(aabb.GetMin().Y);
+    range.MaxX = ToCell(aabb.GetMax().X);
+    range.MaxY = ToCell(aabb.GetMax().Y);
+    return range;
+}
+
+uint32_t CSpatialHashGrid2D::HashCell(int32_t cellX, int32_t cellY) const
+{
+    const uint32_t HASH = (static_cast<uint32_t>(cellX) * 73856093U) ^ (static_cast<uint32_t>(cellY) * 19349663U);
+    return HASH & BucketMask;
+}
+
+void CSpatialHashGrid2D::Rebuild()
+{
+    CellSize = ComputeCellSize();
+    InverseCellSize = 1.0F / CellSize;
+
+    // 1. 计算每个代理覆盖的单元范围，统计条目总数；大代理标记为空范围
+    CellRanges.resize(Proxies.size());
+    LargeProxies.clear();
+
+    size_t entryCount = 0;
+    for (int32_t proxyId = 0; proxyId < static_cast<int32_t>(Proxies.size()); ++proxyId)
+    {
+        SCellRange2D& range = CellRanges[proxyId];
+        range = SCellRange2D();
+
+        const SGridProxy2D& proxy = Proxies[proxyId];
+        if (!proxy.IsInUse)
+        {
+            continue;
+        }
+
+        const SCellRange2D FULL_RANGE = ComputeCellRange(proxy.AABB);
+        const int64_t      CELL_COUNT = (static_cast<int64_t>(FULL_RANGE.MaxX) - FULL_RANGE.MinX + 1) *
+                                   (static_cast<int64_t>(FULL_RANGE.MaxY) - FULL_RANGE.MinY + 1);
+
+        if (CELL_COUNT > MAX_CELLS_PER_PROXY)
+        {
+            LargeProxies.push_back(proxyId);
+            continue;
+        }
+
+        range = FULL_RANGE;
+        entryCount += static_cast<size_t>(CELL_COUNT);
+    }
+
+    // 2. 桶数取不小于 2 倍条目数的 2 的幂，降低冲突
+    const uint32_t BUCKET_COUNT = std::bit_ceil(static_cast<uint32_t>(BE::Math::Max<size_t>(entryCount * 2, 1)));
+    BucketMask = BUCKET_COUNT - 1;
+
+    // 3. 计数排序：统计每个桶的条目数 -> 前缀和 -> 分发
+    BucketStarts.assign(static_cast<size_t>(BUCKET_COUNT) + 1, 0);
+    for (const auto& range : CellRanges)
+    {
+        for (int32_t y = range.MinY; y <= range.MaxY; ++y)
+        {
+            for (int32_t x = range.MinX; x <= range.MaxX; ++x)
+            {
+                ++BucketStarts[HashCell(x, y) + 1];
+            }
+        }
+    }
+
+    for (uint32_t bucket = 0; bucket < BUCKET_COUNT; ++bucket)
+    {
+        BucketStarts[bucket + 1] += BucketStarts[bucket];
+    }
+
+    BucketCursors.assign(BucketStarts.begin(), BucketStarts.end() - 1);
+    Entries.resize(entryCount);
+
+    for (int32_t proxyId = 0; proxyId < static_cast<int32_t>(CellRanges.size()); ++proxyId)
+    {
+        const SCellRange2D& range = CellRanges[proxyId];
+        for (int32_t y = range.MinY; y <= range.MaxY; ++y)
+        {
+            for (int32_t x = range.MinX; x <= range.MaxX; ++x)
+            {
+                Entries[BucketCursors[HashCell(x, y)]++] = SGridEntry2D{proxyId, x, y};
+            }
+        }
+    }
+}
+
+void CSpatialHashGrid2D::AddPairIfOverlapping(int32_t proxyA, int32_t proxyB,
+                                              std::vector<SBroadPhasePair2D>& outPairs) const
+{
+    const SGridProxy2D& a = Proxies[proxyA];
+    const SGridProxy2D& b = Proxies[proxyB];
+
+    if ((!a.IsDynamic && !b.IsDynamic) || !a.AABB.Overlaps(b.AABB))
+    {
+        return;
+    }
+
+    outPairs.push_back({BE::Math::Min(a.ColliderId, b.ColliderId), BE::Math::Max(a.ColliderId, b.ColliderId)});
+}
+
+NAMESPACE_END() // namespace PHYE::Physics2D
@@ -0,0 +1,258 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#include <BroadPhase2D/SweepAndPrune2D.hpp>
+#include <algorithm>
+#include <cassert>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+namespace
+{
+
+// 取 AABB 在指定轴上的分量
+float GetAxisValue(const SVector2F& vector, uint32_t axis)
+{
+    return axis == 0 ? vector.X : vector.Y;
+}
+
+} // namespace
+
+CSweepAndPrune2D::CSweepAndPrune2D(float aabbMargin) : ProxyCount(0), AABBMargin(aabbMargin), SweepAxis(0)
+{}
+
+int32_t CSweepAndPrune2D::CreateProxy(const CBoundingAABB2D& aabb, uint32_t colliderId, bool isDynamic)
+{
+    int32_t proxyId = INVALID_PROXY_ID;
+    if (FreeProxies.empty())
+    {
+        proxyId = static_cast<int32_t>(Proxies.size());
+        Proxies.emplace_back();
+    }
+    else
+    {
+        proxyId = FreeProxies.back();
+        FreeProxies.pop_back();
+    }
+
+    SSAPProxy2D& proxy = Proxies[proxyId];
+    proxy.AABB = aabb.Fattened(AABBMargin);
+    proxy.ColliderId = colliderId;
+    proxy.IsDynamic = isDynamic;
+    proxy.IsInUse = true;
+
+    // 新区间追加到末尾，下一次插入排序会将其移动到正确位置
+    Intervals.push_back({0.0F, 0.0F, proxyId});
+
+    ++ProxyCount;
+    return proxyId;
+}
+
+void CSweepAndPrune2D::DestroyProxy(int32_t proxyId)
+{
+    assert(Proxies[proxyId].IsInUse);
+
+    // 直接从区间数组中移除(保持剩余区间有序)，销毁不频繁，线性开销可以接受
+    std::erase_if(Intervals, [proxyId](const SSAPInterval2D& interval) { return interval.ProxyId == proxyId; });
+
+    Proxies[proxyId].IsInUse = false;
+    FreeProxies.push_back(proxyId);
+    --ProxyCount;
+}
+
+void CSweepAndPrune2D::MoveProxy(int32_t proxyId, const CBoundingAABB2D& aabb, const SVector2F& displacement)
+{
+    // 区间每步重新排序，只需覆盖到下一次更新为止的位移
+    Proxies[proxyId].AABB = aabb.Fattened(AABBMargin).Swept(displacement);
+}
+
+void CSweepAndPrune2D::UpdatePairs(std::vector<SBroadPhasePair2D>& outPairs)
+{
+    outPairs.clear();
+
+    SortIntervals(ChooseSweepAxis());
+
+    const uint32_t OTHER_AXIS = 1 - SweepAxis;
+    const size_t   COUNT = Intervals.size();
+
+    for (size_t i = 0; i < COUNT; ++i)
+    {
+        const SSAPInterval2D& intervalA = Intervals[i];
+        const SSAPProxy2D&    proxyA = Proxies[intervalA.ProxyId];
+
+        const float MIN_A = GetAxisValue(proxyA.AABB.GetMin(), OTHER_AXIS);
+        const float MAX_A = GetAxisValue(proxyA.AABB.GetMax(), OTHER_AXIS);
+
+        for (size_t j = i + 1; j < COUNT && Intervals[j].Min <= intervalA.Max; ++j)
+        {
+            const SSAPProxy2D& proxyB = Proxies[Intervals[j].ProxyId];
+
+            if (!proxyA.IsDynamic && !proxyB.IsDynamic)
+            {
+                continue;
+            }
+
+            // 扫描轴上已重叠，只需再测试另一轴
+            if (GetAxisValue(proxyB.AABB.GetMin(), OTHER_AXIS) > MAX_A ||
+                GetAxisValue(proxyB.AABB.GetMax(), OTHER_AXIS) < MIN_A)
+            {
+                continue;
+            }
+
+            outPairs.push_back({BE::Math::Min(proxyA.ColliderId, proxyB.ColliderId),
+                                BE::Math::Max(proxyA.ColliderId, proxyB.ColliderId)});
+        }
+    }
+
+    std::sort(outPairs.begin(), outPairs.end());
+}
+
+void CSweepAndPrune2D::Query(const CBoundingAABB2D& aabb, std::vector<uint32_t>& outColliders) const
+{
+    // 排序结构只在 UpdatePairs() 中刷新，之后移动或创建的代理不在其中，逐个测试
+    for (const auto& proxy : Proxies)
+    {
+        if (proxy.IsInUse && proxy.AABB.Overlaps(aabb))
+        {
+            outColliders.push_back(proxy.ColliderId);
+        }
+    }
+}
+
+void CSweepAndPrune2D::Query(const CBoundingAABB2D& aabb, IBroadPhaseQueryCallback2D& callback) const
+{
+    for (const auto& proxy : Proxies)
+    {
+        if (proxy.IsInUse && proxy.AABB.Overlaps(aabb) && !callback.ReportCollider(proxy.ColliderId))
+        {
+            return;
+        }
+    }
+}
+
+void CSweepAndPrune2D::RayCast(SRayPacket2D& packet, IRayPacketCallback2D& callback) const
+{
+    // 与 Query() 相同，逐个代理做包围盒测试
+    for (const auto& proxy : Proxies)
+    {
+        if (packet.ActiveMask == 0)
+        {
+            return;
+        }
+
+        if (!proxy.IsInUse)
+        {
+            continue;
+        }
+
+        const uint32_t LANE_MASK = RayPacketOverlaps(packet, proxy.AABB);
+        if (LANE_MASK != 0)
+        {
+            callback.ReportCollider(proxy.ColliderId, LANE_MASK, packet);
+        }
+    }
+}
+
+CBoundingAABB2D CSweepAndPrune2D::GetFatAABB(int32_t proxyId) const
+{
+    return Proxies[proxyId].AABB;
+}
+
+size_t CSweepAndPrune2D::GetProxyCount() const
+{
+    return ProxyCount;
+}
+
+std::unique_ptr<IBroadPhase2D> CSweepAndPrune2D::Clone() const
+{
+    return std::make_unique<CSweepAndPrune2D>(*this);
+}
+
+void CSweepAndPrune2D::CopyFrom(const IBroadPhase2D& other)
+{
+    assert(dynamic_cast<const CSweepAndPrune2D*>(&other) != nullptr);
+    *this = static_cast<const CSweepAndPrune2D&>(other);
+}
+
+uint32_t CSweepAndPrune2D::GetSweepAxis() const
+{
+    return SweepAxis;
+}
+
+uint32_t CSweepAndPrune2D::ChooseSweepAxis() const
+{
+    if (Intervals.size() < 2)
+    {
+        return SweepAxis;
+    }
+
+    // 单次遍历计算中心点在两轴上的方差
+    double sumX = 0.0;
+    double sumY = 0.0;
+    double sumSquaredX = 0.0;
+    double sumSquaredY = 0.0;
+
+    for (const auto& interval : Intervals)
+    {
+        const SVector2F CENTER = Proxies[interval.ProxyId].AABB.GetCenter();
+        sumX += CENTER.X;
+        sumY += CENTER.Y;
+        sumSquaredX += static_cast<double>(CENTER.X) * CENTER.X;
+        sumSquaredY += static_cast<double>(CENTER.Y) * CENTER.Y;
+    }
+
+    const double INVERSE_COUNT = 1.0 / static_cast<double>(Intervals.size());
+    const double VARIANCE_X = (sumSquaredX * INVERSE_COUNT) - ((sumX * INVERSE_COUNT) * (sumX * INVERSE_COUNT));
+    const double VARIANCE_Y = (sumSquaredY * INVERSE_COUNT) - ((sumY * INVERSE_COUNT) * (sumY * INVERSE_COUNT));
+
+    // 带少量滞后，避免两轴方差接近时来回切换导致整体重排
+    constexpr double HYSTERESIS = 1.1;
+    if (SweepAxis == 0)
+    {
+        return VARIANCE_Y > VARIANCE_X * HYSTERESIS ? 1 : 0;
+    }
+
+    return VARIANCE_X > VARIANCE_Y * HYSTERESIS ? 0 : 1;
+}
+
+void CSweepAndPrune2D::SortIntervals(uint32_t axis)
+{
+    for (auto& interval : Intervals)
+    {
+        const CBoundingAABB2D& aabb = Proxies[interval.ProxyId].AABB;
+        interval.Min = GetAxisValue(aabb.GetMin(), axis);
+        interval.Max = GetAxisValue(aabb.GetMax(), axis);
+    }
+
+    auto lessByMin = [](const SSAPInterval2D& a, const SSAPInterval2D& b) { return a.Min < b.Min; };
+
+    if (axis != SweepAxis)
+    {
+        // 换轴后原顺序失去意义，直接整体排序
+        SweepAxis = axis;
+        std::sort(Intervals.begin(), Intervals.end(), lessByMin);
+        return;
+    }
+
+    // 时间相干性：上一帧的顺序几乎有序，插入排序接近线性
+    for (size_t i = 1; i < Intervals.size(); ++i)
+    {
+        const SSAPInterval2D KEY = Intervals[i];
+
+        size_t j = i;
+        while (j > 0 && lessByMin(KEY, Intervals[j - 1]))
+        {
+            Intervals[j] = Intervals[j - 1];
+            --j;
+        }
+
+        Intervals[j] = KEY;
+    }
+}
+
+NAMESPACE_END() // namespace PHYE::Physics2D
@@ -0,0 +1,505 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#include <ForceField2D/BarnesHutTree2D.hpp>
+#include <Solver2D/WideFloat2D.hpp>
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+using PHYE::PhysicsBase::ERigidBodyType;
+
+namespace
+{
+
+// SIMD_WIDTH_2D masses of an interaction list
+struct alignas(SIMD_ALIGNMENT_2D) SInteractionBlock2D final
+{
+    TWideArray2D X;
+    TWideArray2D Y;
+    TWideArray2D Mass;
+};
+
+/**
+ * @brief Masses acting on the bodies of one leaf: cells far enough to be approximated and the bodies of the
+ * others leaves, the leaf itself included.
+ */
+struct SInteractionList2D final
+{
+    std::vector<SInteractionBlock2D> Blocks;
+    uint32_t                         Count = 0;
+
+    void Clear()
+    {
+        Count = 0;
+    }
+
+    void Add(float x, float y, float mass)
+    {
+        const uint32_t BLOCK = Count / SIMD_WIDTH_2D;
+        const uint32_t LANE = Count % SIMD_WIDTH_2D;
+
+        if (BLOCK == Blocks.size())
+        {
+            Blocks.emplace_back();
+        }
+
+        Blocks[BLOCK].X[LANE] = x;
+        Blocks[BLOCK].Y[LANE] = y;
+        Blocks[BLOCK].Mass[LANE] = mass;
+        ++Count;
+    }
+
+    // 用零质量填满最后一个块，求和时整块处理
+    void Pad()
+    {
+        while (Count % SIMD_WIDTH_2D != 0)
+        {
+            Add(0.0F, 0.0F, 0.0F);
+        }
+    }
+};
+
+/**
+ * @brief Collect the masses acting on the box [minX, maxX] x [minY, maxY] into outList.
+ * @param invOpeningAngle 1 / opening angle, infinite to open every cell.
+ */
+void GatherInteractions(std::span<const SBarnesHutNode2D> nodes, std::span<const SBarnesHutBody2D> bodies, float minX,
+                        float minY, float maxX, float maxY, float invOpeningAngle, SInteractionList2D& outList)
+{
+    outList.Clear();
+
+    const auto NODE_COUNT = static_cast<uint32_t>(nodes.size());
+
+    uint32_t index = 0;
+    while (index < NODE_COUNT)
+    {
+        const SBarnesHutNode2D& node = nodes[index];
+
+        // 盒子到质心的距离，质心在盒子内时为0
+        const float DX = std::max({minX - node.CenterX, 0.0F, node.CenterX - maxX});
+        const float DY = std::max({minY - node.CenterY, 0.0F, node.CenterY - maxY});
+        const float OPENING_DISTANCE = (node.Size * invOpeningAngle) + node.Offset;
+
+        if ((DX * DX) + (DY * DY) > OPENING_DISTANCE * OPENING_DISTANCE)
+        {
+            outList.Add(node.CenterX, node.CenterY, node.Mass);
+            index = node.Next;
+        }
+        else if (node.BodyCount > 0)
+        {
+            const uint32_t END = node.FirstBody + node.BodyCount;
+            for (uint32_t body = node.FirstBody; body < END; ++body)
+            {
+                outList.Add(bodies[body].X, bodies[body].Y, bodies[body].Mass);
+            }
+
+            index = node.Next;
+        }
+        else
+        {
+            ++index;
+        }
+    }
+
+    outList.Pad();
+}
+
+// 软化长度保证距离平方为正，与自身的项(r = 0)贡献为0，不需要分支
+void SumInteractions(const SInteractionList2D& list, float x, float y, float softeningSq, SVector2F& outAcceleration)
+{
+    const SWideFloat2D POINT_X = WideSplat(x);
+    const SWideFloat2D POINT_Y = WideSplat(y);
+    const SWideFloat2D SOFTENING_SQ = WideSplat(softeningSq);
+    const SWideFloat2D ONE = WideSplat(1.0F);
+
+    SWideFloat2D accelerationX = WideSplat(0.0F);
+    SWideFloat2D accelerationY = WideSplat(0.0F);
+
+    const uint32_t BLOCK_COUNT = list.Count / SIMD_WIDTH_2D;
+    for (uint32_t block = 0; block < BLOCK_COUNT; ++block)
+    {
+        const SInteractionBlock2D& masses = list.Blocks[block];
+
+        const SWideFloat2D DX = WideLoad(masses.X) - POINT_X;
+        const SWideFloat2D DY = WideLoad(masses.Y) - POINT_Y;
+        const SWideFloat2D INV_DISTANCE = ONE / WideSqrt((DX * DX) + (DY * DY) + SOFTENING_SQ);
+        const SWideFloat2D SCALE = WideLoad(masses.Mass) * INV_DISTANCE * INV_DISTANCE * INV_DISTANCE;
+
+        accelerationX = accelerationX + (DX * SCALE);
+        accelerationY = accelerationY + (DY * SCALE);
+    }
+
+    alignas(SIMD_ALIGNMENT_2D) TWideArray2D lanesX;
+    alignas(SIMD_ALIGNMENT_2D) TWideArray2D lanesY;
+    WideStore(lanesX, accelerationX);
+    WideStore(lanesY, accelerationY);
+
+    float sumX = 0.0F;
+    float sumY = 0.0F;
+    for (uint32_t lane = 0; lane < SIMD_WIDTH_2D; ++lane)
+    {
+        sumX += lanesX[lane];
+        sumY += lanesY[lane];
+    }
+
+    outAcceleration.X = sumX;
+    outAcceleration.Y = sumY;
+}
+
+bool IsLeafCell(uint32_t bodyCount, uint32_t depth)
+{
+    return bodyCount <= BARNES_HUT_LEAF_SIZE_2D || depth == BARNES_HUT_MAX_DEPTH_2D;
+}
+
+// 四个象限的刚体范围 {左下, 右下, 左上, 右上, 结束}：先按Y再按X原地划分
+std::array<uint32_t, 5> PartitionCell(std::span<SBarnesHutBody2D> bodies, uint32_t begin, uint32_t end, float midX,
+                                      float midY)
+{
+    const auto FIRST = bodies.begin();
+    const auto BELOW = [midY](const SBarnesHutBody2D& body) { return body.Y < midY; };
+    const auto LEFT = [midX](const SBarnesHutBody2D& body) { return body.X < midX; };
+
+    const auto SPLIT_Y = static_cast<uint32_t>(std::partition(FIRST + begin, FIRST + end, BELOW) - FIRST);
+    const auto SPLIT_LOW = static_cast<uint32_t>(std::partition(FIRST + begin, FIRST + SPLIT_Y, LEFT) - FIRST);
+    const auto SPLIT_HIGH = static_cast<uint32_t>(std::partition(FIRST + SPLIT_Y, FIRST + end, LEFT) - FIRST);
+
+    return {begin, SPLIT_LOW, SPLIT_Y, SPLIT_HIGH, end};
+}
+
+// 已划分过的单元：子树只在各自的范围内重排，象限的边界可以二分查找
+std::array<uint32_t, 5> FindQuadrants(std::span<const SBarnesHutBody2D> bodies, uint32_t begin, uint32_t end,
+                                      float midX, float midY)
+{
+    const auto FIRST = bodies.begin();
+    const auto BELOW = [midY](const SBarnesHutBody2D& body) { return body.Y < midY; };
+    const auto LEFT = [midX](const SBarnesHutBody2D& body) { return body.X < midX; };
+
+    const auto SPLIT_Y = static_cast<uint32_t>(std::partition_point(FIRST + begin, FIRST + end, BELOW) - FIRST);
+    const auto SPLIT_LOW = static_cast<uint32_t>(std::partition_point(FIRST + begin, FIRST + SPLIT_Y, LEFT) - FIRST);
+    const auto SPLIT_HIGH = static_cast<uint32_t>(std::partition_point(FIRST + SPLIT_Y, FIRST + end, LEFT) - FIRST);
+
+    return {begin, SPLIT_LOW, SPLIT_Y, SPLIT_HIGH, end};
+}
+
+float QuadrantMinX(uint32_t quadrant, float minX, float half)
+{
+    return (quadrant & 1U) != 0 ? minX + half : minX;
+}
+
+float QuadrantMinY(uint32_t quadrant, float minY, float half)
+{
+    return (quadrant & 2U) != 0 ? minY + half : minY;
+}
+
+void FinishNode(SBarnesHutNode2D& node, float mass, float momentX, float momentY, float minX, float minY,
+                float size, uint32_t next)
+{
+    const float CELL_CENTER_X = minX + (size * 0.5F);
+    const float CELL_CENTER_Y = minY + (size * 0.5F);
+
+    node.Mass = mass;
+
+    // 没有质量的单元(只有零质量的动态刚体)取几何中心
+    node.CenterX = mass > 0.0F ? momentX / mass : CELL_CENTER_X;
+    node.CenterY = mass > 0.0F ? momentY / mass : CELL_CENTER_Y;
+    node.Size = size;
+    node.Offset = std::sqrt(((node.CenterX - CELL_CENTER_X) * (node.CenterX - CELL_CENTER_X)) +
+                            ((node.CenterY - CELL_CENTER_Y) * (node.CenterY - CELL_CENTER_Y)));
+    node.Next = next;
+}
+
+// Build the subtree of the cell [minX, minX + size] x [minY, minY + size] over bodies[begin, end)
+void BuildSubtree(std::span<SBarnesHutBody2D> bodies, uint32_t begin, uint32_t end, float minX, float minY,
+                  float size, uint32_t depth, std::vector<SBarnesHutNode2D>& outNodes,
+                  std::vector<SBarnesHutLeaf2D>& outLeaves)
+{
+    const auto NODE = static_cast<uint32_t>(outNodes.size());
+    outNodes.emplace_back();
+
+    float mass = 0.0F;
+    float momentX = 0.0F;
+    float momentY = 0.0F;
+
+    if (IsLeafCell(end - begin, depth))
+    {
+        SBarnesHutLeaf2D& leaf = outLeaves.emplace_back();
+        leaf.FirstBody = begin;
+        leaf.BodyCount = end - begin;
+        leaf.MinX = leaf.MaxX = bodies[begin].X;
+        leaf.MinY = leaf.MaxY = bodies[begin].Y;
+
+        for (uint32_t body = begin; body < end; ++body)
+        {
+            mass += bodies[body].Mass;
+            momentX += bodies[body].Mass * bodies[body].X;
+            momentY += bodies[body].Mass * bodies[body].Y;
+
+            leaf.MinX = std::min(leaf.MinX, bodies[body].X);
+            leaf.MinY = std::min(leaf.MinY, bodies[body].Y);
+            leaf.MaxX = std::max(leaf.MaxX, bodies[body].X);
+            leaf.MaxY = std::max(leaf.MaxY, bodies[body].Y);
+        }
+
+        outNodes[NODE].FirstBody = begin;
+        outNodes[NODE].BodyCount = end - begin;
+    }
+    else
+    {
+        const float                   HALF = size * 0.5F;
+        const std::array<uint32_t, 5> BOUNDS = PartitionCell(bodies, begin, end, minX + HALF, minY + HALF);
+
+        for (uint32_t quadrant = 0; quadrant < 4; ++quadrant)
+        {
+            if (BOUNDS[quadrant] == BOUNDS[quadrant + 1])
+            {
+                continue;
+            }
+
+            const auto CHILD = static_cast<uint32_t>(outNodes.size());
+            BuildSubtree(bodies, BOUNDS[quadrant], BOUNDS[quadrant + 1], QuadrantMinX(quadrant, minX, HALF),
+                         QuadrantMinY(quadrant, minY, HALF), HALF, depth + 1, outNodes, outLeaves);
+
+            const SBarnesHutNode2D& child = outNodes[CHILD];
+            mass += child.Mass;
+            momentX += child.Mass * child.CenterX;
+            momentY += child.Mass * child.CenterY;
+        }
+    }
+
+    FinishNode(outNodes[NODE], mass, momentX, momentY, minX, minY, size, static_cast<uint32_t>(outNodes.size()));
+}
+
+} // namespace
+
+void CBarnesHutTree2D::Build(std::span<const SRigidBodyComponent2D> bodies, uint32_t bodyGroups,
+                             BE::Core::CJobSystem* jobSystem)
+{
+    Bodies.clear();
+    Nodes.clear();
+    Leaves.clear();
+
+    float minX = 0.0F;
+    float minY = 0.0F;
+    float maxX = 0.0F;
+    float maxY = 0.0F;
+
+    for (uint32_t index = 0; index < bodies.size(); ++index)
+    {
+        const SRigidBodyComponent2D& body = bodies[index];
+
+        if ((body.ForceGroups & bodyGroups) == 0 || (body.Mass <= 0.0F && body.Type != ERigidBodyType::Dynamic))
+        {
+            continue;
+        }
+
+        if (Bodies.empty())
+        {
+            minX = maxX = body.Position.X;
+            minY = maxY = body.Position.Y;
+        }
+        else
+        {
+            minX = std::min(minX, body.Position.X);
+            minY = std::min(minY, body.Position.Y);
+            maxX = std::max(maxX, body.Position.X);
+            maxY = std::max(maxY, body.Position.Y);
+        }
+
+        Bodies.push_back({body.Position.X, body.Position.Y, std::max(body.Mass, 0.0F), index});
+    }
+
+    if (Bodies.empty())
+    {
+        return;
+    }
+
+    // 正方形的根单元，保证所有单元的宽高一致
+    const float SIZE = std::max(maxX - minX, maxY - minY);
+    const auto  BODY_COUNT = static_cast<uint32_t>(Bodies.size());
+    uint32_t    nextSubtree = 0;
+
+    SubtreeCount = 0;
+    SplitCell(0, BODY_COUNT, minX, minY, SIZE, 0);
+
+    // 各子树覆盖互不相交的刚体范围，可以同时构建
+    const auto BUILD_SUBTREES = [this](uint32_t begin, uint32_t end)
+    {
+        for (uint32_t index = begin; index < end; ++index)
+        {
+            SBarnesHutSubtree2D& subtree = Subtrees[index];
+            subtree.Nodes.clear();
+            subtree.Leaves.clear();
+
+            BuildSubtree(Bodies, subtree.Begin, subtree.End, subtree.MinX, subtree.MinY, subtree.Size, subtree.Depth,
+                         subtree.Nodes, subtree.Leaves);
+        }
+    };
+
+    if (jobSystem != nullptr)
+    {
+        jobSystem->ParallelFor(SubtreeCount, 1, BUILD_SUBTREES);
+    }
+    else
+    {
+        BUILD_SUBTREES(0, SubtreeCount);
+    }
+
+    EmitCell(0, BODY_COUNT, minX, minY, SIZE, 0, nextSubtree);
+}
+
+void CBarnesHutTree2D::Clear()
+{
+    Bodies.clear();
+    Nodes.clear();
+    Leaves.clear();
+}
+
+bool CBarnesHutTree2D::IsEmpty() const
+{
+    return Nodes.empty();
+}
+
+void CBarnesHutTree2D::ComputeAccelerations(float openingAngle, float softening, std::span<SVector2F> outAccelerations,
+                                            BE::Core::CJobSystem* jobSystem) const
+{
+    assert(softening > 0.0F && "Softening must be positive");
+
+    const float INV_OPENING_ANGLE = 1.0F / openingAngle;
+    const float SOFTENING_SQ = softening * softening;
+
+    const auto COMPUTE_LEAVES = [&](uint32_t begin, uint32_t end)
+    {
+        SInteractionList2D list;
+
+        for (uint32_t leafIndex = begin; leafIndex < end; ++leafIndex)
+        {
+            const SBarnesHutLeaf2D& leaf = Leaves[leafIndex];
+            GatherInteractions(Nodes, Bodies, leaf.MinX, leaf.MinY, leaf.MaxX, leaf.MaxY, INV_OPENING_ANGLE, list);
+
+            const uint32_t END = leaf.FirstBody + leaf.BodyCount;
+            for (uint32_t body = leaf.FirstBody; body < END; ++body)
+            {
+                SumInteractions(list, Bodies[body].X, Bodies[body].Y, SOFTENING_SQ,
+                                outAccelerations[Bodies[body].Index]);
+            }
+        }
+    };
+
+    const auto LEAF_COUNT = static_cast<uint32_t>(Leaves.size());
+
+    // 每个刚体只写入自己的加速度，各叶子可以同时计算
+    if (jobSystem != nullptr)
+    {
+        jobSystem->ParallelFor(LEAF_COUNT, BARNES_HUT_LEAVES_PER_JOB_2D, COMPUTE_LEAVES);
+    }
+    else
+    {
+        COMPUTE_LEAVES(0, LEAF_COUNT);
+    }
+}
+
+void CBarnesHutTree2D::ComputeAcceleration(const SVector2F& point, float openingAngle, float softening,
+                                           SVector2F& outAcceleration) const
+{
+    assert(softening > 0.0F && "Softening must be positive");
+
+    SInteractionList2D list;
+    GatherInteractions(Nodes, Bodies, point.X, point.Y, point.X, point.Y, 1.0F / openingAngle, list);
+    SumInteractions(list, point.X, point.Y, softening * softening, outAcceleration);
+}
+
+const std::vector<SBarnesHutNode2D>& CBarnesHutTree2D::GetNodes() const
+{
+    return Nodes;
+}
+
+void CBarnesHutTree2D::SplitCell(uint32_t begin, uint32_t end, float minX, float minY, float size, uint32_t depth)
+{
+    if (IsLeafCell(end - begin, depth) || depth == BARNES_HUT_SPLIT_DEPTH_2D)
+    {
+        if (SubtreeCount == Subtrees.size())
+        {
+            Subtrees.emplace_back();
+        }
+
+        SBarnesHutSubtree2D& subtree = Subtrees[SubtreeCount++];
+        subtree.Begin = begin;
+        subtree.End = end;
+        subtree.MinX = minX;
+        subtree.MinY = minY;
+        subtree.Size = size;
+        subtree.Depth = depth;
+        return;
+    }
+
+    const float                   HALF = size * 0.5F;
+    const std::array<uint32_t, 5> BOUNDS = PartitionCell(Bodies, begin, end, minX + HALF, minY + HALF);
+
+    for (uint32_t quadrant = 0; quadrant < 4; ++quadrant)
+    {
+        if (BOUNDS[quadrant] != BOUNDS[quadrant + 1])
+        {
+            SplitCell(BOUNDS[quadrant], BOUNDS[quadrant + 1], QuadrantMinX(quadrant, minX, HALF),
+                      QuadrantMinY(quadrant, minY, HALF), HALF, depth + 1);
+        }
+    }
+}
+
+void CBarnesHutTree2D::EmitCell(uint32_t begin, uint32_t end, float minX, float minY, float size, uint32_t depth,
+                                uint32_t& nextSubtree)
+{
+    if (IsLeafCell(end - begin, depth) || depth == BARNES_HUT_SPLIT_DEPTH_2D)
+    {
+        const SBarnesHutSubtree2D& subtree = Subtrees[nextSubtree++];
+        const auto                 BASE = static_cast<uint32_t>(Nodes.size());
+
+        for (const SBarnesHutNode2D& node : subtree.Nodes)
+        {
+            Nodes.push_back(node);
+            Nodes.back().Next += BASE;
+        }
+
+        Leaves.insert(Leaves.end(), subtree.Leaves.begin(), subtree.Leaves.end());
+        return;
+    }
+
+    const auto NODE = static_cast<uint32_t>(Nodes.size());
+    Nodes.emplace_back();
+
+    float mass = 0.0F;
+    float momentX = 0.0F;
+    float momentY = 0.0F;
+
+    const float                   HALF = size * 0.5F;
+    const std::array<uint32_t, 5> BOUNDS = FindQuadrants(Bodies, begin, end, minX + HALF, minY + HALF);
+
+    for (uint32_t quadrant = 0; quadrant < 4; ++quadrant)
+    {
+        if (BOUNDS[quadrant] == BOUNDS[quadrant + 1])
+        {
+            continue;
+        }
+
+        const auto CHILD = static_cast<uint32_t>(Nodes.size());
+        EmitCell(BOUNDS[quadrant], BOUNDS[quadrant + 1], QuadrantMinX(quadrant, minX, HALF),
+                 QuadrantMinY(quadrant, minY, HALF), HALF, depth + 1, nextSubtree);
+
+        const SBarnesHutNode2D& child = Nodes[CHILD];
+        mass += child.Mass;
+        momentX += child.Mass * child.CenterX;
+        momentY += child.Mass * child.CenterY;
+    }
+
+    FinishNode(Nodes[NODE], mass, momentX, momentY, minX, minY, size, static_cast<uint32_t>(Nodes.size()));
+}
+
+NAMESPACE_END() // namespace PHYE::Physics2D
@@ -0,0 +1,145 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#include <ForceField2D/ForceField2D.hpp>
+#include <cmath>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+using PHYE::PhysicsBase::ERigidBodyType;
+
+/**
+ * @[INFO] 与积分器相同，这里的循环直接操作分量，循环体内没有虚函数调用：
+ * 一个力场对一批刚体只做一次遍历，力场参数在循环外预先乘好步长。
+ * 力场直接修改速度而不是累加到 Force 上，Force 在整个 Step 内保留(子步之间不清零)，
+ * 而力场的力随刚体位置与速度变化，需要每个子步重新计算。
+ */
+
+namespace
+{
+    bool IsAffected(const SRigidBodyComponent2D& body, uint32_t bodyGroups)
+    {
+        return body.Type == ERigidBodyType::Dynamic && body.IsAwake && (body.ForceGroups & bodyGroups) != 0;
+    }
+} // namespace
+
+void ApplyForceField2D(std::span<SRigidBodyComponent2D> bodies, const SGravityField2D& field, float timeStep)
+{
+    const float ACCELERATION_X = field.Acceleration.X * timeStep;
+    const float ACCELERATION_Y = field.Acceleration.Y * timeStep;
+
+    for (auto& body : bodies)
+    {
+        if (!IsAffected(body, field.BodyGroups))
+        {
+            continue;
+        }
+
+        body.Velocity.X += ACCELERATION_X * body.GravityScale;
+        body.Velocity.Y += ACCELERATION_Y * body.GravityScale;
+    }
+}
+
+void ApplyForceField2D(std::span<SRigidBodyComponent2D> bodies, const SDragField2D& field, float timeStep)
+{
+    for (auto& body : bodies)
+    {
+        if (!IsAffected(body, field.BodyGroups))
+        {
+            continue;
+        }
+
+        const float SPEED = std::sqrt((body.Velocity.X * body.Velocity.X) + (body.Velocity.Y * body.Velocity.Y));
+        const float COEFFICIENT = field.LinearCoefficient + (field.QuadraticCoefficient * SPEED);
+
+        // 隐式积分: v *= 1 / (1 + dt * c / m)，与积分器的阻尼相同
+        const float SCALE = 1.0F / (1.0F + (COEFFICIENT * body.InverseMass * timeStep));
+
+        body.Velocity.X *= SCALE;
+        body.Velocity.Y *= SCALE;
+    }
+}
+
+void ApplyForceField2D(std::span<SRigidBodyComponent2D> bodies, const SAttractorField2D& field, float timeStep)
+{
+    const float RADIUS_SQ = field.Radius * field.Radius;
+    const float MIN_DISTANCE_SQ = field.MinDistance * field.MinDistance;
+    const float STRENGTH_DT = field.Strength * timeStep;
+
+    for (auto& body : bodies)
+    {
+        if (!IsAffected(body, field.BodyGroups))
+        {
+            continue;
+        }
+
+        const float DX = field.Center.X - body.Position.X;
+        const float DY = field.Center.Y - body.Position.Y;
+        const float DISTANCE_SQ = (DX * DX) + (DY * DY);
+
+        // 位于中心的刚体没有确定的方向
+        if (DISTANCE_SQ > RADIUS_SQ || DISTANCE_SQ == 0.0F)
+        {
+            continue;
+        }
+
+        const float INV_DISTANCE = 1.0F / std::sqrt(DISTANCE_SQ);
+        const float DELTA_V = STRENGTH_DT / (DISTANCE_SQ > MIN_DISTANCE_SQ ? DISTANCE_SQ : MIN_DISTANCE_SQ);
+
+        body.Velocity.X += DX * INV_DISTANCE * DELTA_V;
+        body.Velocity.Y += DY * INV_DISTANCE * DELTA_V;
+    }
+}
+
+void ApplyForceField2D(std::span<SRigidBodyComponent2D> bodies, const SWindField2D& field, float timeStep)
+{
+    const SVector2F& MIN = field.Volume.GetMin();
+    const SVector2F& MAX = field.Volume.GetMax();
+
+    const float COEFFICIENT_DT = field.Coefficient * timeStep;
+
+    for (auto& body : bodies)
+    {
+        if (!IsAffected(body, field.BodyGroups))
+        {
+            continue;
+        }
+
+        if (body.Position.X < MIN.X || body.Position.X > MAX.X || body.Position.Y < MIN.Y || body.Position.Y > MAX.Y)
+        {
+            continue;
+        }
+
+        // 隐式积分: v' = v + c * (w - v') => v' = (v + c * w) / (1 + c)，c = k * dt / m
+        const float C = COEFFICIENT_DT * body.InverseMass;
+        const float SCALE = 1.0F / (1.0F + C);
+
+        body.Velocity.X = (body.Velocity.X + (C * field.Velocity.X)) * SCALE;
+        body.Velocity.Y = (body.Velocity.Y + (C * field.Velocity.Y)) * SCALE;
+    }
+}
+
+void ApplyForceField2D(std::span<SRigidBodyComponent2D> bodies, const SNBodyGravityField2D& field,
+                       std::span<const SVector2F> accelerations, float timeStep)
+{
+    const float G_DT = field.GravitationalConstant * timeStep;
+
+    for (size_t index = 0; index < bodies.size(); ++index)
+    {
+        SRigidBodyComponent2D& body = bodies[index];
+        if (!IsAffected(body, field.BodyGroups))
+        {
+            continue;
+        }
+
+        body.Velocity.X += accelerations[index].X * G_DT;
+        body.Velocity.Y += accelerations[index].Y * G_DT;
+    }
+}
+
+NAMESPACE_END() // namespace PHYE::Physics2D
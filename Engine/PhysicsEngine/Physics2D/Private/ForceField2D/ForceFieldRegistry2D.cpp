@@ -0,0 +1,206 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#include <ForceField2D/ForceFieldRegistry2D.hpp>
+#include <cassert>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+uint32_t CForceFieldRegistry2D::AddField(const SGravityField2D& field)
+{
+    return AddFieldTo(GravityFields, EForceFieldType2D::Gravity, field);
+}
+
+uint32_t CForceFieldRegistry2D::AddField(const SDragField2D& field)
+{
+    return AddFieldTo(DragFields, EForceFieldType2D::Drag, field);
+}
+
+uint32_t CForceFieldRegistry2D::AddField(const SAttractorField2D& field)
+{
+    return AddFieldTo(AttractorFields, EForceFieldType2D::Attractor, field);
+}
+
+uint32_t CForceFieldRegistry2D::AddField(const SWindField2D& field)
+{
+    return AddFieldTo(WindFields, EForceFieldType2D::Wind, field);
+}
+
+uint32_t CForceFieldRegistry2D::AddField(const SNBodyGravityField2D& field)
+{
+    return AddFieldTo(NBodyGravityFields, EForceFieldType2D::NBodyGravity, field);
+}
+
+void CForceFieldRegistry2D::RemoveField(uint32_t fieldId)
+{
+    const EForceFieldType2D TYPE = GetFieldType(fieldId);
+    assert(TYPE != EForceFieldType2D::Count && "Force field is not registered");
+
+    const uint32_t INDEX = Slots[fieldId].Index;
+
+    switch (TYPE)
+    {
+    case EForceFieldType2D::Gravity:
+        RemoveFieldFrom(GravityFields, INDEX);
+        break;
+    case EForceFieldType2D::Drag:
+        RemoveFieldFrom(DragFields, INDEX);
+        break;
+    case EForceFieldType2D::Attractor:
+        RemoveFieldFrom(AttractorFields, INDEX);
+        break;
+    case EForceFieldType2D::Wind:
+        RemoveFieldFrom(WindFields, INDEX);
+        break;
+    case EForceFieldType2D::NBodyGravity:
+        RemoveFieldFrom(NBodyGravityFields, INDEX);
+        break;
+    default:
+        return;
+    }
+
+    Slots[fieldId] = SForceFieldSlot2D();
+    FreeIds.push_back(fieldId);
+}
+
+EForceFieldType2D CForceFieldRegistry2D::GetFieldType(uint32_t fieldId) const
+{
+    return fieldId < Slots.size() ? Slots[fieldId].Type : EForceFieldType2D::Count;
+}
+
+uint32_t CForceFieldRegistry2D::GetFieldCount() const
+{
+    return static_cast<uint32_t>(GravityFields.Fields.size() + DragFields.Fields.size() +
+                                 AttractorFields.Fields.size() + WindFields.Fields.size() +
+                                 NBodyGravityFields.Fields.size());
+}
+
+void CForceFieldRegistry2D::Clear()
+{
+    GravityFields = TForceFieldArray2D<SGravityField2D>();
+    DragFields = TForceFieldArray2D<SDragField2D>();
+    AttractorFields = TForceFieldArray2D<SAttractorField2D>();
+    WindFields = TForceFieldArray2D<SWindField2D>();
+    NBodyGravityFields = TForceFieldArray2D<SNBodyGravityField2D>();
+    NBodyGravityTree.Clear();
+    NBodyGravityAccelerations.clear();
+
+    Slots.clear();
+    FreeIds.clear();
+}
+
+void CForceFieldRegistry2D::Apply(std::span<SRigidBodyComponent2D> bodies, float timeStep,
+                                  BE::Core::CJobSystem* jobSystem)
+{
+    if (bodies.empty() || GetFieldCount() == 0)
+    {
+        return;
+    }
+
+    // 引力只取决于位置，不受其它力场改变的速度影响，可以在分块之前按树的叶子计算
+    if (!NBodyGravityFields.Fields.empty())
+    {
+        NBodyGravityAccelerations.resize(bodies.size());
+    }
+
+    for (const SNBodyGravityField2D& field : NBodyGravityFields.Fields)
+    {
+        NBodyGravityTree.Build(bodies, field.BodyGroups, jobSystem);
+        NBodyGravityTree.ComputeAccelerations(field.OpeningAngle, field.Softening, NBodyGravityAccelerations,
+                                              jobSystem);
+        ApplyForceField2D(bodies, field, NBodyGravityAccelerations, timeStep);
+    }
+
+    const auto APPLY_RANGE = [this, bodies, timeStep](uint32_t begin, uint32_t end)
+    {
+        for (uint32_t chunk = begin; chunk < end; chunk += FORCE_FIELD_CHUNK_SIZE_2D)
+        {
+            const uint32_t CHUNK_END = chunk + FORCE_FIELD_CHUNK_SIZE_2D < end ? chunk + FORCE_FIELD_CHUNK_SIZE_2D : end;
+            ApplyChunk(bodies.subspan(chunk, CHUNK_END - chunk), timeStep);
+        }
+    };
+
+    const auto COUNT = static_cast<uint32_t>(bodies.size());
+
+    if (jobSystem != nullptr)
+    {
+        jobSystem->ParallelFor(COUNT, FORCE_FIELD_BODIES_PER_JOB_2D, APPLY_RANGE);
+    }
+    else
+    {
+        APPLY_RANGE(0, COUNT);
+    }
+}
+
+template <typename TField>
+uint32_t CForceFieldRegistry2D::AddFieldTo(TForceFieldArray2D<TField>& fields, EForceFieldType2D type,
+                                           const TField& field)
+{
+    uint32_t fieldId = 0;
+
+    if (!FreeIds.empty())
+    {
+        fieldId = FreeIds.back();
+        FreeIds.pop_back();
+    }
+    else
+    {
+        fieldId = static_cast<uint32_t>(Slots.size());
+        Slots.emplace_back();
+    }
+
+    Slots[fieldId].Type = type;
+    Slots[fieldId].Index = static_cast<uint32_t>(fields.Fields.size());
+
+    fields.Fields.push_back(field);
+    fields.Ids.push_back(fieldId);
+
+    return fieldId;
+}
+
+template <typename TField>
+void CForceFieldRegistry2D::RemoveFieldFrom(TForceFieldArray2D<TField>& fields, uint32_t index)
+{
+    // 与末尾交换后删除，保持数组紧凑
+    const uint32_t LAST = static_cast<uint32_t>(fields.Fields.size()) - 1;
+    if (index != LAST)
+    {
+        fields.Fields[index] = fields.Fields[LAST];
+        fields.Ids[index] = fields.Ids[LAST];
+        Slots[fields.Ids[index]].Index = index;
+    }
+
+    fields.Fields.pop_back();
+    fields.Ids.pop_back();
+}
+
+void CForceFieldRegistry2D::ApplyChunk(std::span<SRigidBodyComponent2D> bodies, float timeStep) const
+{
+    for (const SGravityField2D& field : GravityFields.Fields)
+    {
+        ApplyForceField2D(bodies, field, timeStep);
+    }
+
+    for (const SAttractorField2D& field : AttractorFields.Fields)
+    {
+        ApplyForceField2D(bodies, field, timeStep);
+    }
+
+    for (const SWindField2D& field : WindFields.Fields)
+    {
+        ApplyForceField2D(bodies, field, timeStep);
+    }
+
+    // 阻尼最后施加，作用于其它力场改变后的速度
+    for (const SDragField2D& field : DragFields.Fields)
+    {
+        ApplyForceField2D(bodies, field, timeStep);
+    }
+}
+
+NAMESPACE_END() // namespace PHYE::Physics2D
@@ -1,19 +0,0 @@
-/**
- * GPL-3.0 License
- *
- * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
- *
- * For more detail, please refer to the LICENSE file in the root directory of this project.
- */
-
-#include <ForceGenerator2D/GravityGenerator2D.hpp>
-
-
-NAMESPACE_BEGIN(PHYE::Physics2D)
-
-void CGravityGenerator2D::UpdateForce(CPhysicsObject2D* object, float deltaTime)
-{
-    // @TODO: Implement Gravity Force Application Logic Here
-}
-
-NAMESPACE_END() // namespace PHYE::Physics2D
\ No newline at end of file
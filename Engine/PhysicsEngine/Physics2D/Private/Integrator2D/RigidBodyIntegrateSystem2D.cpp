@@ -0,0 +1,47 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#include <Integrator2D/RigidBodyIntegrateSystem2D.hpp>
+#include <Integrator2D/RigidBodyIntegrator2D.hpp>
+#include <Job/JobSystem.hpp>
+#include <PhysicsWorld2D/PhysicsWorld2D.hpp>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+CRigidBodyIntegrateSystem2D::CRigidBodyIntegrateSystem2D(CPhysicsWorld2D& world) : World(&world)
+{}
+
+NekiraECS::SystemGroup CRigidBodyIntegrateSystem2D::GetGroup() const
+{
+    return NekiraECS::SystemGroup::PreUpdate;
+}
+
+void CRigidBodyIntegrateSystem2D::OnUpdate(float deltaTime)
+{
+    IntegrateVelocities(deltaTime);
+    IntegratePositions(deltaTime);
+
+    auto bodies = World->GetRigidBodies();
+    ClearForces2D(bodies);
+    SyncTransforms2D(bodies);
+}
+
+void CRigidBodyIntegrateSystem2D::IntegrateVelocities(float timeStep) const
+{
+    World->GetForceFields().Apply(World->GetRigidBodies(), timeStep,
+                                  World->GetSettings().EnableParallelSolve ? &BE::Core::CJobSystem::Get() : nullptr);
+
+    IntegrateVelocities2D(World->GetRigidBodies(), World->GetSettings().Gravity, timeStep);
+}
+
+void CRigidBodyIntegrateSystem2D::IntegratePositions(float timeStep) const
+{
+    IntegratePositions2D(World->GetRigidBodies(), timeStep);
+}
+
+NAMESPACE_END() // namespace PHYE::Physics2D
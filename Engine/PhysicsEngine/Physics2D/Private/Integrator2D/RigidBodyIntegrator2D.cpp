@@ -0,0 +1,100 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#include <Integrator2D/RigidBodyIntegrator2D.hpp>
+#include <Rigid2D/RigidBody2D/RigidBodyComponent2D.hpp>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+using PHYE::PhysicsBase::ERigidBodyType;
+
+/**
+ * @[INFO] 这里的循环刻意直接操作分量，而不是通过TVector2的运算符：
+ * 每个刚体只做少量乘加，临时向量的构造/移动反而会成为主要开销。
+ * 循环体内没有虚函数和std::function调用，编译器可以完整内联。
+ */
+
+void IntegrateVelocities2D(std::span<SRigidBodyComponent2D> bodies, const SVector2F& gravity, float timeStep)
+{
+    const float GRAVITY_X = gravity.X * timeStep;
+    const float GRAVITY_Y = gravity.Y * timeStep;
+
+    for (auto& body : bodies)
+    {
+        if (body.Type != ERigidBodyType::Dynamic)
+        {
+            continue;
+        }
+
+        // 施加在休眠刚体上的外力会唤醒它，岛屿中的其它刚体在求解前被一并唤醒
+        if (!body.IsAwake)
+        {
+            if (body.Force.X == 0.0F && body.Force.Y == 0.0F && body.Torque == 0.0F)
+            {
+                continue;
+            }
+
+            body.IsAwake = true;
+            body.SleepTime = 0.0F;
+        }
+
+        const float INV_MASS_DT = body.InverseMass * timeStep;
+
+        float vx = body.Velocity.X + (GRAVITY_X * body.GravityScale) + (body.Force.X * INV_MASS_DT);
+        float vy = body.Velocity.Y + (GRAVITY_Y * body.GravityScale) + (body.Force.Y * INV_MASS_DT);
+        float w = body.AngularVelocity + (body.Torque * body.InverseInertia * timeStep);
+
+        // 阻尼: v *= 1 / (1 + dt * c)，在大步长下也不会反向
+        const float LINEAR_SCALE = 1.0F / (1.0F + (timeStep * body.LinearDamping));
+        const float ANGULAR_SCALE = 1.0F / (1.0F + (timeStep * body.AngularDamping));
+
+        body.Velocity.X = vx * LINEAR_SCALE;
+        body.Velocity.Y = vy * LINEAR_SCALE;
+        body.AngularVelocity = w * ANGULAR_SCALE;
+    }
+}
+
+void IntegratePositions2D(std::span<SRigidBodyComponent2D> bodies, float timeStep)
+{
+    for (auto& body : bodies)
+    {
+        if (body.Type == ERigidBodyType::Static || !body.IsAwake)
+        {
+            continue;
+        }
+
+        body.Position.X += body.Velocity.X * timeStep;
+        body.Position.Y += body.Velocity.Y * timeStep;
+        body.Rotation += body.AngularVelocity * timeStep;
+    }
+}
+
+void ClearForces2D(std::span<SRigidBodyComponent2D> bodies)
+{
+    for (auto& body : bodies)
+    {
+        body.Force.X = 0.0F;
+        body.Force.Y = 0.0F;
+        body.Torque = 0.0F;
+    }
+}
+
+void SyncTransforms2D(std::span<SRigidBodyComponent2D> bodies)
+{
+    for (auto& body : bodies)
+    {
+        if (body.Type == ERigidBodyType::Static)
+        {
+            continue;
+        }
+
+        body.Transform = STransform2D(body.Position, BE::Math::RadiansToDegrees(body.Rotation));
+    }
+}
+
+NAMESPACE_END() // namespace PHYE::Physics2D
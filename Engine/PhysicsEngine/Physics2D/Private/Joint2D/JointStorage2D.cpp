@@ -0,0 +1,239 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#include <Joint2D/JointStorage2D.hpp>
+#include <cassert>
+#include <limits>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+SJointId2D CJointStorage2D::Add(const SDistanceJointDef2D& def)
+{
+    const SJointId2D JOINT_ID = AddJoint(EJointType2D::Distance, def.BodyA, def.BodyB, def.LocalAnchorA,
+                                         def.LocalAnchorB, def.CollideConnected);
+    Lengths.back() = def.Length;
+
+    return JOINT_ID;
+}
+
+SJointId2D CJointStorage2D::Add(const SRevoluteJointDef2D& def)
+{
+    return AddJoint(EJointType2D::Revolute, def.BodyA, def.BodyB, def.LocalAnchorA, def.LocalAnchorB,
+                    def.CollideConnected);
+}
+
+SJointId2D CJointStorage2D::Add(const SPrismaticJointDef2D& def)
+{
+    const SJointId2D JOINT_ID = AddJoint(EJointType2D::Prismatic, def.BodyA, def.BodyB, def.LocalAnchorA,
+                                         def.LocalAnchorB, def.CollideConnected);
+    LocalAxes.back() = def.LocalAxisA.Normalized();
+    ReferenceAngles.back() = def.ReferenceAngle;
+
+    return JOINT_ID;
+}
+
+SJointId2D CJointStorage2D::Add(const SWeldJointDef2D& def)
+{
+    const SJointId2D JOINT_ID = AddJoint(EJointType2D::Weld, def.BodyA, def.BodyB, def.LocalAnchorA,
+                                         def.LocalAnchorB, def.CollideConnected);
+    ReferenceAngles.back() = def.ReferenceAngle;
+
+    return JOINT_ID;
+}
+
+void CJointStorage2D::Remove(SJointId2D jointId)
+{
+    assert(Contains(jointId) && "Joint does not exist");
+
+    // 与末尾交换后删除，保持数组紧凑
+    const uint32_t INDEX = DenseIndices[jointId.Index];
+    const uint32_t LAST = Size() - 1;
+
+    if (INDEX != LAST)
+    {
+        Types[INDEX] = Types[LAST];
+        BodiesA[INDEX] = BodiesA[LAST];
+        BodiesB[INDEX] = BodiesB[LAST];
+        LocalAnchorsA[INDEX] = LocalAnchorsA[LAST];
+        LocalAnchorsB[INDEX] = LocalAnchorsB[LAST];
+        LocalAxes[INDEX] = LocalAxes[LAST];
+        ReferenceAngles[INDEX] = ReferenceAngles[LAST];
+        Lengths[INDEX] = Lengths[LAST];
+        CollideConnected[INDEX] = CollideConnected[LAST];
+
+        for (auto& impulses : Impulses)
+        {
+            impulses[INDEX] = impulses[LAST];
+        }
+
+        Ids[INDEX] = Ids[LAST];
+        DenseIndices[Ids[INDEX].Index] = INDEX;
+    }
+
+    Types.pop_back();
+    BodiesA.pop_back();
+    BodiesB.pop_back();
+    LocalAnchorsA.pop_back();
+    LocalAnchorsB.pop_back();
+    LocalAxes.pop_back();
+    ReferenceAngles.pop_back();
+    Lengths.pop_back();
+    CollideConnected.pop_back();
+
+    for (auto& impulses : Impulses)
+    {
+        impulses.pop_back();
+    }
+
+    Ids.pop_back();
+    DenseIndices[jointId.Index] = INVALID_JOINT_ID;
+
+    // 世代号跳过0，0 保留给无效的 ID
+    uint16_t& generation = Generations[jointId.Index];
+    generation = generation == std::numeric_limits<uint16_t>::max() ? 1 : generation + 1;
+
+    FreeIds.push_back(jointId.Index);
+}
+
+bool CJointStorage2D::Contains(SJointId2D jointId) const
+{
+    return jointId.Index < DenseIndices.size() && DenseIndices[jointId.Index] != INVALID_JOINT_ID &&
+           Generations[jointId.Index] == jointId.Generation;
+}
+
+uint32_t CJointStorage2D::GetDenseIndex(SJointId2D jointId) const
+{
+    return Contains(jointId) ? DenseIndices[jointId.Index] : INVALID_JOINT_ID;
+}
+
+uint32_t CJointStorage2D::Size() const
+{
+    return static_cast<uint32_t>(Types.size());
+}
+
+void CJointStorage2D::Clear()
+{
+    *this = CJointStorage2D();
+}
+
+void CJointStorage2D::ResetImpulses()
+{
+    for (auto& impulses : Impulses)
+    {
+        impulses.assign(impulses.size(), 0.0F);
+    }
+}
+
+std::span<const EJointType2D> CJointStorage2D::GetTypes() const
+{
+    return Types;
+}
+
+std::span<const SBodyId2D> CJointStorage2D::GetBodiesA() const
+{
+    return BodiesA;
+}
+
+std::span<const SBodyId2D> CJointStorage2D::GetBodiesB() const
+{
+    return BodiesB;
+}
+
+std::span<const SVector2F> CJointStorage2D::GetLocalAnchorsA() const
+{
+    return LocalAnchorsA;
+}
+
+std::span<const SVector2F> CJointStorage2D::GetLocalAnchorsB() const
+{
+    return LocalAnchorsB;
+}
+
+std::span<const SVector2F> CJointStorage2D::GetLocalAxes() const
+{
+    return LocalAxes;
+}
+
+std::span<const float> CJointStorage2D::GetReferenceAngles() const
+{
+    return ReferenceAngles;
+}
+
+std::span<const float> CJointStorage2D::GetLengths() const
+{
+    return Lengths;
+}
+
+std::span<const uint8_t> CJointStorage2D::GetCollideConnected() const
+{
+    return CollideConnected;
+}
+
+std::span<const SJointId2D> CJointStorage2D::GetIds() const
+{
+    return Ids;
+}
+
+std::span<float> CJointStorage2D::GetImpulses(uint32_t row)
+{
+    return Impulses[row];
+}
+
+std::span<const float> CJointStorage2D::GetImpulses(uint32_t row) const
+{
+    return Impulses[row];
+}
+
+void CJointStorage2D::SetLength(SJointId2D jointId, float length)
+{
+    assert(Contains(jointId) && Types[DenseIndices[jointId.Index]] == EJointType2D::Distance);
+    Lengths[DenseIndices[jointId.Index]] = length;
+}
+
+SJointId2D CJointStorage2D::AddJoint(EJointType2D type, const SBodyId2D& bodyA, const SBodyId2D& bodyB,
+                                     const SVector2F& localAnchorA, const SVector2F& localAnchorB,
+                                     bool collideConnected)
+{
+    SJointId2D jointId;
+
+    if (!FreeIds.empty())
+    {
+        jointId.Index = FreeIds.back();
+        FreeIds.pop_back();
+    }
+    else
+    {
+        jointId.Index = static_cast<uint32_t>(DenseIndices.size());
+        DenseIndices.emplace_back();
+        Generations.push_back(1);
+    }
+
+    jointId.Generation = Generations[jointId.Index];
+    DenseIndices[jointId.Index] = Size();
+
+    Types.push_back(type);
+    BodiesA.push_back(bodyA);
+    BodiesB.push_back(bodyB);
+    LocalAnchorsA.push_back(localAnchorA);
+    LocalAnchorsB.push_back(localAnchorB);
+    LocalAxes.emplace_back(1.0F, 0.0F);
+    ReferenceAngles.push_back(0.0F);
+    Lengths.push_back(0.0F);
+    CollideConnected.push_back(collideConnected ? 1 : 0);
+
+    for (auto& impulses : Impulses)
+    {
+        impulses.push_back(0.0F);
+    }
+
+    Ids.push_back(jointId);
+
+    return jointId;
+}
+
+NAMESPACE_END() // namespace PHYE::Physics2D
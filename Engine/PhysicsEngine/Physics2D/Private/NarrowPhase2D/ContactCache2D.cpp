@@ -0,0 +1,44 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#include <NarrowPhase2D/ContactCache2D.hpp>
+#include <algorithm>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+void CContactCache2D::Store(std::span<const SContactManifold2D> manifolds)
+{
+    Manifolds.assign(manifolds.begin(), manifolds.end());
+
+    ManifoldIndices.Reserve(Manifolds.size());
+    for (uint32_t index = 0; index < Manifolds.size(); ++index)
+    {
+        const SContactManifold2D& manifold = Manifolds[index];
+        ManifoldIndices.Insert(CPairHashMap2D::MakeKey(manifold.ColliderA, manifold.ColliderB), index);
+    }
+}
+
+void CContactCache2D::Clear()
+{
+    Manifolds.clear();
+    ManifoldIndices.Clear();
+}
+
+void CContactCache2D::CopyFrom(const CContactCache2D& other)
+{
+    // 赋值只分配刚好够用的容量，按倍数预留以免每次增长都重新分配
+    if (Manifolds.capacity() < other.Manifolds.size())
+    {
+        Manifolds.reserve(std::max(other.Manifolds.size(), Manifolds.capacity() * 2));
+    }
+
+    Manifolds = other.Manifolds;
+    ManifoldIndices = other.ManifoldIndices;
+}
+
+NAMESPACE_END() // namespace PHYE::Physics2D
@@ -0,0 +1,639 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#include <MathUtility/MathUtilities.hpp>
+#include <NarrowPhase2D/CollideFunctions2D.hpp>
+#include <NarrowPhase2D/Distance2D.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+namespace
+{
+
+// Squared distances below this are treated as zero
+constexpr float DISTANCE_EPSILON_SQUARED = 1.0E-12F;
+
+// EPA stops when the support point improves the closest edge by less than this
+constexpr float EPA_TOLERANCE = 1.0E-4F;
+
+// Point of the Minkowski difference B - A
+struct SSimplexVertex2D
+{
+    SVector2F WA;
+    SVector2F WB;
+    SVector2F W;
+
+    // Barycentric coordinate of the closest point
+    float A = 0.0F;
+
+    uint32_t IndexA = 0;
+    uint32_t IndexB = 0;
+};
+
+struct SSimplex2D
+{
+    std::array<SSimplexVertex2D, 3> Vertices;
+    uint32_t                        Count = 0;
+};
+
+uint32_t FindSupport(std::span<const SVector2F> vertices, const SVector2F& direction)
+{
+    uint32_t bestIndex = 0;
+    float    bestValue = vertices[0] | direction;
+
+    for (uint32_t index = 1; index < vertices.size(); ++index)
+    {
+        const float VALUE = vertices[index] | direction;
+        if (VALUE > bestValue)
+        {
+            bestValue = VALUE;
+            bestIndex = index;
+        }
+    }
+
+    return bestIndex;
+}
+
+SSimplexVertex2D MakeVertex(std::span<const SVector2F> verticesA, std::span<const SVector2F> verticesB,
+                            uint32_t indexA, uint32_t indexB)
+{
+    SSimplexVertex2D vertex;
+    vertex.IndexA = indexA;
+    vertex.IndexB = indexB;
+    vertex.WA = verticesA[indexA];
+    vertex.WB = verticesB[indexB];
+    vertex.W = vertex.WB - vertex.WA;
+    vertex.A = 1.0F;
+
+    return vertex;
+}
+
+// Support point of B - A in the direction
+SSimplexVertex2D FindSupportVertex(std::span<const SVector2F> verticesA, std::span<const SVector2F> verticesB,
+                                   const SVector2F& direction)
+{
+    return MakeVertex(verticesA, verticesB, FindSupport(verticesA, -direction), FindSupport(verticesB, direction));
+}
+
+void ReadCache(const SSimplexCache2D& cache, std::span<const SVector2F> verticesA, std::span<const SVector2F> verticesB,
+               SSimplex2D& simplex)
+{
+    simplex.Count = 0;
+
+    for (uint32_t index = 0; index < cache.Count; ++index)
+    {
+        // 顶点数变化后缓存失效
+        if (cache.IndexA[index] >= verticesA.size() || cache.IndexB[index] >= verticesB.size())
+        {
+            simplex.Count = 0;
+            break;
+        }
+
+        simplex.Vertices[simplex.Count++] = MakeVertex(verticesA, verticesB, cache.IndexA[index], cache.IndexB[index]);
+    }
+
+    if (simplex.Count == 0)
+    {
+        simplex.Vertices[0] = MakeVertex(verticesA, verticesB, 0, 0);
+        simplex.Count = 1;
+    }
+}
+
+void WriteCache(const SSimplex2D& simplex, SSimplexCache2D& cache)
+{
+    cache.Count = static_cast<uint8_t>(simplex.Count);
+
+    for (uint32_t index = 0; index < simplex.Count; ++index)
+    {
+        cache.IndexA[index] = static_cast<uint8_t>(simplex.Vertices[index].IndexA);
+        cache.IndexB[index] = static_cast<uint8_t>(simplex.Vertices[index].IndexB);
+    }
+}
+
+// Direction from the simplex towards the origin
+SVector2F ComputeSearchDirection(const SSimplex2D& simplex)
+{
+    if (simplex.Count == 1)
+    {
+        return -simplex.Vertices[0].W;
+    }
+
+    const SVector2F EDGE = simplex.Vertices[1].W - simplex.Vertices[0].W;
+    const float     SIGN = EDGE ^ (-simplex.Vertices[0].W);
+
+    // 原点位于边的左侧或右侧
+    return SIGN > 0.0F ? SVector2F(-EDGE.Y, EDGE.X) : SVector2F(EDGE.Y, -EDGE.X);
+}
+
+// Closest point of a segment simplex to the origin, reduces to a vertex when the origin is past an end
+void SolveSegment(SSimplex2D& simplex)
+{
+    SSimplexVertex2D& vertex1 = simplex.Vertices[0];
+    SSimplexVertex2D& vertex2 = simplex.Vertices[1];
+
+    const SVector2F EDGE = vertex2.W - vertex1.W;
+
+    const float D12_2 = -(vertex1.W | EDGE);
+    if (D12_2 <= 0.0F)
+    {
+        vertex1.A = 1.0F;
+        simplex.Count = 1;
+        return;
+    }
+
+    const float D12_1 = vertex2.W | EDGE;
+    if (D12_1 <= 0.0F)
+    {
+        vertex2.A = 1.0F;
+        vertex1 = vertex2;
+        simplex.Count = 1;
+        return;
+    }
+
+    const float INVERSE = 1.0F / (D12_1 + D12_2);
+    vertex1.A = D12_1 * INVERSE;
+    vertex2.A = D12_2 * INVERSE;
+    simplex.Count = 2;
+}
+
+// Closest feature of a triangle simplex to the origin(Voronoi regions of vertices, edges and the interior)
+void SolveTriangle(SSimplex2D& simplex)
+{
+    SSimplexVertex2D& vertex1 = simplex.Vertices[0];
+    SSimplexVertex2D& vertex2 = simplex.Vertices[1];
+    SSimplexVertex2D& vertex3 = simplex.Vertices[2];
+
+    const SVector2F W1 = vertex1.W;
+    const SVector2F W2 = vertex2.W;
+    const SVector2F W3 = vertex3.W;
+
+    const SVector2F E12 = W2 - W1;
+    const float     D12_1 = W2 | E12;
+    const float     D12_2 = -(W1 | E12);
+
+    const SVector2F E13 = W3 - W1;
+    const float     D13_1 = W3 | E13;
+    const float     D13_2 = -(W1 | E13);
+
+    const SVector2F E23 = W3 - W2;
+    const float     D23_1 = W3 | E23;
+    const float     D23_2 = -(W2 | E23);
+
+    const float N123 = E12 ^ E13;
+    const float D123_1 = N123 * (W2 ^ W3);
+    const float D123_2 = N123 * (W3 ^ W1);
+    const float D123_3 = N123 * (W1 ^ W2);
+
+    // 顶点1
+    if (D12_2 <= 0.0F && D13_2 <= 0.0F)
+    {
+        vertex1.A = 1.0F;
+        simplex.Count = 1;
+        return;
+    }
+
+    // 边12
+    if (D12_1 > 0.0F && D12_2 > 0.0F && D123_3 <= 0.0F)
+    {
+        const float INVERSE = 1.0F / (D12_1 + D12_2);
+        vertex1.A = D12_1 * INVERSE;
+        vertex2.A = D12_2 * INVERSE;
+        simplex.Count = 2;
+        return;
+    }
+
+    // 边13
+    if (D13_1 > 0.0F && D13_2 > 0.0F && D123_2 <= 0.0F)
+    {
+        const float INVERSE = 1.0F / (D13_1 + D13_2);
+        vertex1.A = D13_1 * INVERSE;
+        vertex3.A = D13_2 * INVERSE;
+        vertex2 = vertex3;
+        simplex.Count = 2;
+        return;
+    }
+
+    // 顶点2
+    if (D12_1 <= 0.0F && D23_2 <= 0.0F)
+    {
+        vertex2.A = 1.0F;
+        vertex1 = vertex2;
+        simplex.Count = 1;
+        return;
+    }
+
+    // 顶点3
+    if (D13_1 <= 0.0F && D23_1 <= 0.0F)
+    {
+        vertex3.A = 1.0F;
+        vertex1 = vertex3;
+        simplex.Count = 1;
+        return;
+    }
+
+    // 边23
+    if (D23_1 > 0.0F && D23_2 > 0.0F && D123_1 <= 0.0F)
+    {
+        const float INVERSE = 1.0F / (D23_1 + D23_2);
+        vertex2.A = D23_1 * INVERSE;
+        vertex3.A = D23_2 * INVERSE;
+        vertex1 = vertex3;
+        simplex.Count = 2;
+        return;
+    }
+
+    // 原点在三角形内部
+    const float INVERSE = 1.0F / (D123_1 + D123_2 + D123_3);
+    vertex1.A = D123_1 * INVERSE;
+    vertex2.A = D123_2 * INVERSE;
+    vertex3.A = D123_3 * INVERSE;
+    simplex.Count = 3;
+}
+
+void ComputeWitnessPoints(const SSimplex2D& simplex, SVector2F& pointA, SVector2F& pointB)
+{
+    pointA = SVector2F(0.0F, 0.0F);
+    pointB = SVector2F(0.0F, 0.0F);
+
+    for (uint32_t index = 0; index < simplex.Count; ++index)
+    {
+        pointA += simplex.Vertices[index].WA * simplex.Vertices[index].A;
+        pointB += simplex.Vertices[index].WB * simplex.Vertices[index].A;
+    }
+
+    // 三角形单纯形意味着重叠，两个见证点重合
+    if (simplex.Count == 3)
+    {
+        pointB = pointA;
+    }
+}
+
+SDistanceOutput2D RunGJK(std::span<const SVector2F> verticesA, std::span<const SVector2F> verticesB,
+                         SSimplexCache2D& cache, SSimplex2D& simplex)
+{
+    ReadCache(cache, verticesA, verticesB, simplex);
+
+    SDistanceOutput2D output;
+
+    while (output.Iterations < MAX_GJK_ITERATIONS_2D)
+    {
+        // 记录当前单纯形的顶点，用于检测重复的支撑点
+        std::array<uint32_t, 3> savedA{};
+        std::array<uint32_t, 3> savedB{};
+        const uint32_t          SAVED_COUNT = simplex.Count;
+        for (uint32_t index = 0; index < SAVED_COUNT; ++index)
+        {
+            savedA[index] = simplex.Vertices[index].IndexA;
+            savedB[index] = simplex.Vertices[index].IndexB;
+        }
+
+        if (simplex.Count == 2)
+        {
+            SolveSegment(simplex);
+        }
+        else if (simplex.Count == 3)
+        {
+            SolveTriangle(simplex);
+        }
+
+        // 原点被三角形包含：重叠
+        if (simplex.Count == 3)
+        {
+            break;
+        }
+
+        const SVector2F DIRECTION = ComputeSearchDirection(simplex);
+        if ((DIRECTION | DIRECTION) < DISTANCE_EPSILON_SQUARED)
+        {
+            // 原点位于单纯形上
+            break;
+        }
+
+        const SSimplexVertex2D VERTEX = FindSupportVertex(verticesA, verticesB, DIRECTION);
+        ++output.Iterations;
+
+        // 支撑点已在单纯形中：无法再靠近原点
+        bool isDuplicate = false;
+        for (uint32_t index = 0; index < SAVED_COUNT; ++index)
+        {
+            if (VERTEX.IndexA == savedA[index] && VERTEX.IndexB == savedB[index])
+            {
+                isDuplicate = true;
+                break;
+            }
+        }
+
+        if (isDuplicate)
+        {
+            break;
+        }
+
+        simplex.Vertices[simplex.Count++] = VERTEX;
+    }
+
+    ComputeWitnessPoints(simplex, output.PointA, output.PointB);
+
+    const SVector2F DELTA = output.PointB - output.PointA;
+    output.Distance = std::sqrt(DELTA | DELTA);
+
+    WriteCache(simplex, cache);
+
+    return output;
+}
+
+bool IsSameVertex(const SSimplexVertex2D& lhs, const SSimplexVertex2D& rhs)
+{
+    return lhs.IndexA == rhs.IndexA && lhs.IndexB == rhs.IndexB;
+}
+
+/**
+ * Grow a degenerate GJK simplex(the origin lies on a vertex or an edge) into a counter-clockwise triangle.
+ * Returns false when the Minkowski difference itself is degenerate, the shapes are then only touching.
+ */
+bool BuildInitialPolytope(std::span<const SVector2F> verticesA, std::span<const SVector2F> verticesB,
+                          SSimplex2D& simplex)
+{
+    if (simplex.Count == 1)
+    {
+        constexpr std::array<std::pair<float, float>, 4> DIRECTIONS = {
+            {{1.0F, 0.0F}, {-1.0F, 0.0F}, {0.0F, 1.0F}, {0.0F, -1.0F}}};
+
+        for (const auto& [x, y] : DIRECTIONS)
+        {
+            const SSimplexVertex2D VERTEX = FindSupportVertex(verticesA, verticesB, SVector2F(x, y));
+            if (!IsSameVertex(VERTEX, simplex.Vertices[0]))
+            {
+                simplex.Vertices[simplex.Count++] = VERTEX;
+                break;
+            }
+        }
+
+        if (simplex.Count == 1)
+        {
+            return false;
+        }
+    }
+
+    if (simplex.Count == 2)
+    {
+        const SVector2F EDGE = simplex.Vertices[1].W - simplex.Vertices[0].W;
+        const SVector2F NORMAL(-EDGE.Y, EDGE.X);
+
+        for (const float SIGN : {1.0F, -1.0F})
+        {
+            const SSimplexVertex2D VERTEX = FindSupportVertex(verticesA, verticesB, NORMAL * SIGN);
+            const float            AREA = EDGE ^ (VERTEX.W - simplex.Vertices[0].W);
+            if (std::abs(AREA) > DISTANCE_EPSILON_SQUARED)
+            {
+                simplex.Vertices[simplex.Count++] = VERTEX;
+                break;
+            }
+        }
+
+        if (simplex.Count == 2)
+        {
+            return false;
+        }
+    }
+
+    // 统一为逆时针
+    if (((simplex.Vertices[1].W - simplex.Vertices[0].W) ^ (simplex.Vertices[2].W - simplex.Vertices[0].W)) < 0.0F)
+    {
+        std::swap(simplex.Vertices[1], simplex.Vertices[2]);
+    }
+
+    return true;
+}
+
+// Polygon expanded by EPA, one vertex per iteration on top of the initial triangle
+using TPolytope2D = std::array<SSimplexVertex2D, MAX_EPA_ITERATIONS_2D + 3>;
+
+bool IsReflexVertex(const TPolytope2D& polytope, uint32_t count, uint32_t index)
+{
+    const SVector2F& previous = polytope[(index > 0) ? index - 1 : count - 1].W;
+    const SVector2F& current = polytope[index].W;
+    const SVector2F& next = polytope[(index + 1 < count) ? index + 1 : 0].W;
+
+    return ((current - previous) ^ (next - current)) <= 0.0F;
+}
+
+void RemovePolytopeVertex(TPolytope2D& polytope, uint32_t& count, uint32_t index)
+{
+    for (uint32_t current = index; current + 1 < count; ++current)
+    {
+        polytope[current] = polytope[current + 1];
+    }
+    --count;
+}
+
+SDistanceProxy2D ToDistanceProxy(const SCircleShapeData2D& circle)
+{
+    SDistanceProxy2D proxy;
+    proxy.Vertices[0] = circle.Center;
+    proxy.Count = 1;
+    proxy.Radius = circle.Radius;
+
+    return proxy;
+}
+
+SDistanceProxy2D ToDistanceProxy(const SPolygonShapeData2D& polygon)
+{
+    SDistanceProxy2D proxy;
+    proxy.Count = polygon.Count;
+
+    for (uint32_t index = 0; index < polygon.Count; ++index)
+    {
+        proxy.Vertices[index] = polygon.Vertices[index];
+    }
+
+    return proxy;
+}
+
+} // namespace
+
+SDistanceOutput2D ComputeDistance(std::span<const SVector2F> verticesA, std::span<const SVector2F> verticesB,
+                                  SSimplexCache2D& cache)
+{
+    SSimplex2D simplex;
+    return RunGJK(verticesA, verticesB, cache, simplex);
+}
+
+bool ComputePenetration(std::span<const SVector2F> verticesA, std::span<const SVector2F> verticesB,
+                        SSimplexCache2D& cache, SPenetrationOutput2D& output)
+{
+    SSimplex2D              simplex;
+    const SDistanceOutput2D DISTANCE = RunGJK(verticesA, verticesB, cache, simplex);
+
+    if (DISTANCE.Distance * DISTANCE.Distance > DISTANCE_EPSILON_SQUARED)
+    {
+        return false;
+    }
+
+    output.Iterations = 0;
+
+    if (!BuildInitialPolytope(verticesA, verticesB, simplex))
+    {
+        // 仅接触
+        output.Normal = SVector2F(0.0F, 1.0F);
+        output.PointA = DISTANCE.PointA;
+        output.PointB = DISTANCE.PointB;
+        output.Depth = 0.0F;
+        return true;
+    }
+
+    // 逆时针多边形，不断向离原点最近的边之外扩展
+    TPolytope2D polytope;
+    uint32_t    count = 3;
+    std::copy_n(simplex.Vertices.begin(), 3, polytope.begin());
+
+    uint32_t  closestEdge = 0;
+    SVector2F closestNormal(0.0F, 1.0F);
+    float     closestDistance = 0.0F;
+
+    while (true)
+    {
+        closestDistance = std::numeric_limits<float>::max();
+
+        for (uint32_t index = 0; index < count; ++index)
+        {
+            const uint32_t  NEXT = (index + 1 < count) ? index + 1 : 0;
+            const SVector2F EDGE = polytope[NEXT].W - polytope[index].W;
+            const float     LENGTH = std::sqrt(EDGE | EDGE);
+            if (LENGTH * LENGTH < DISTANCE_EPSILON_SQUARED)
+            {
+                continue;
+            }
+
+            const SVector2F NORMAL = SVector2F(EDGE.Y, -EDGE.X) * (1.0F / LENGTH);
+            const float     DISTANCE_TO_EDGE = NORMAL | polytope[index].W;
+            if (DISTANCE_TO_EDGE < closestDistance)
+            {
+                closestDistance = DISTANCE_TO_EDGE;
+                closestNormal = NORMAL;
+                closestEdge = index;
+            }
+        }
+
+        if (output.Iterations >= MAX_EPA_ITERATIONS_2D)
+        {
+            break;
+        }
+
+        const SSimplexVertex2D VERTEX = FindSupportVertex(verticesA, verticesB, closestNormal);
+        ++output.Iterations;
+
+        if ((VERTEX.W | closestNormal) - closestDistance < EPA_TOLERANCE)
+        {
+            break;
+        }
+
+        // 在最近边的两个顶点之间插入新的支撑点
+        uint32_t inserted = closestEdge + 1;
+        for (uint32_t index = count; index > inserted; --index)
+        {
+            polytope[index] = polytope[index - 1];
+        }
+        polytope[inserted] = VERTEX;
+        ++count;
+
+        // GJK 的初始顶点不一定在闵可夫斯基差的边界上，移除新顶点两侧变为凹的顶点以保持凸性
+        while (count > 3)
+        {
+            const uint32_t PREVIOUS = (inserted > 0) ? inserted - 1 : count - 1;
+            if (!IsReflexVertex(polytope, count, PREVIOUS))
+            {
+                break;
+            }
+
+            RemovePolytopeVertex(polytope, count, PREVIOUS);
+            inserted = (PREVIOUS < inserted) ? inserted - 1 : inserted;
+        }
+
+        while (count > 3)
+        {
+            const uint32_t NEXT = (inserted + 1 < count) ? inserted + 1 : 0;
+            if (!IsReflexVertex(polytope, count, NEXT))
+            {
+                break;
+            }
+
+            RemovePolytopeVertex(polytope, count, NEXT);
+            inserted = (NEXT < inserted) ? inserted - 1 : inserted;
+        }
+    }
+
+    // 最近边上离原点最近的点，插值得到两侧的见证点
+    const SSimplexVertex2D& vertex1 = polytope[closestEdge];
+    const SSimplexVertex2D& vertex2 = polytope[(closestEdge + 1 < count) ? closestEdge + 1 : 0];
+
+    const SVector2F EDGE = vertex2.W - vertex1.W;
+    const float     EDGE_LENGTH_SQUARED = EDGE | EDGE;
+    const float     T = EDGE_LENGTH_SQUARED > DISTANCE_EPSILON_SQUARED
+                            ? BE::Math::Clamp(-(vertex1.W | EDGE) / EDGE_LENGTH_SQUARED, 0.0F, 1.0F)
+                            : 0.0F;
+
+    // 原点从最近边穿出闵可夫斯基差 B - A，对应 B 沿该边外法线的反方向移动
+    output.Normal = -closestNormal;
+    output.Depth = BE::Math::Max(closestDistance, 0.0F);
+    output.PointA = vertex1.WA + ((vertex2.WA - vertex1.WA) * T);
+    output.PointB = vertex1.WB + ((vertex2.WB - vertex1.WB) * T);
+
+    return true;
+}
+
+SDistanceProxy2D MakeDistanceProxy(const CPrimitiveShape2D& shape)
+{
+    const SPose2D IDENTITY;
+
+    switch (shape.GetShapeType())
+    {
+        case EShapeType2D::Point:
+            return ToDistanceProxy(ToShapeData(static_cast<const CPoint2D&>(shape), IDENTITY));
+        case EShapeType2D::Circle:
+            return ToDistanceProxy(ToShapeData(static_cast<const CCircle2D&>(shape), IDENTITY));
+        case EShapeType2D::Line:
+            return ToDistanceProxy(ToPolygon(ToShapeData(static_cast<const CLine2D&>(shape), IDENTITY)));
+        case EShapeType2D::Rectangle:
+            return ToDistanceProxy(ToPolygon(ToShapeData(static_cast<const CRectangle2D&>(shape), IDENTITY)));
+        case EShapeType2D::OrientedRectangle:
+            return ToDistanceProxy(
+                ToPolygon(ToShapeData(static_cast<const COrientedRectangle2D&>(shape), IDENTITY)));
+        case EShapeType2D::Polygon:
+            return ToDistanceProxy(ToShapeData(static_cast<const CPolygon2D&>(shape), IDENTITY));
+        default:
+            return {};
+    }
+}
+
+SDistanceProxy2D TransformDistanceProxy(const SDistanceProxy2D& proxy, const SPose2D& pose)
+{
+    SDistanceProxy2D result;
+    result.Count = proxy.Count;
+    result.Radius = proxy.Radius;
+
+    for (uint32_t index = 0; index < proxy.Count; ++index)
+    {
+        result.Vertices[index] = pose.TransformPoint(proxy.Vertices[index]);
+    }
+
+    return result;
+}
+
+bool TestOverlap(const SDistanceProxy2D& proxyA, const SDistanceProxy2D& proxyB)
+{
+    SSimplexCache2D         cache;
+    const SDistanceOutput2D OUTPUT = ComputeDistance(proxyA.GetVertices(), proxyB.GetVertices(), cache);
+
+    return OUTPUT.Distance <= proxyA.Radius + proxyB.Radius;
+}
+
+NAMESPACE_END() // namespace PHYE::Physics2D
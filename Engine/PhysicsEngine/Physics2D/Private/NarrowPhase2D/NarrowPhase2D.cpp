@@ -0,0 +1,172 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#include <NarrowPhase2D/CollideFunctions2D.hpp>
+#include <NarrowPhase2D/NarrowPhase2D.hpp>
+#include <algorithm>
+#include <utility>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+namespace
+{
+
+/**
+ * @brief Batch function of one pair of concrete shapes.
+ * @details Kernel is a compile-time function pointer, so its call is resolved(and usually inlined) at compile time.
+ */
+template <typename TShapeA, typename TShapeB, auto Kernel>
+void CollideBatch(std::span<const SShapePair2D> pairs, std::span<const SColliderRecord2D> colliders,
+                  const CContactCache2D& cache, std::vector<SContactManifold2D>& outManifolds)
+{
+    for (const auto& pair : pairs)
+    {
+        const SColliderRecord2D& recordA = colliders[pair.ColliderA];
+        const SColliderRecord2D& recordB = colliders[pair.ColliderB];
+
+        // 上一步的流形：提供 GJK 单纯形缓存，并在碰撞后按特征ID继承冲量
+        const SContactManifold2D* previous = cache.Find(pair.ColliderA, pair.ColliderB);
+
+        SContactManifold2D manifold;
+        if (previous != nullptr)
+        {
+            manifold.SimplexCache = previous->SimplexCache;
+        }
+
+        if (!Kernel(ToShapeData(static_cast<const TShapeA&>(*recordA.Shape), recordA.Pose),
+                    ToShapeData(static_cast<const TShapeB&>(*recordB.Shape), recordB.Pose), manifold))
+        {
+            continue;
+        }
+
+        if (previous != nullptr)
+        {
+            WarmStartManifold(*previous, manifold);
+        }
+
+        manifold.ColliderA = pair.ColliderA;
+        manifold.ColliderB = pair.ColliderB;
+        outManifolds.push_back(std::move(manifold));
+    }
+}
+
+constexpr size_t ToIndex(EShapeType2D type)
+{
+    return static_cast<size_t>(type);
+}
+
+// 分派表：[TypeA][TypeB]，只填写 TypeA <= TypeB 的部分
+using FCollideTable2D = std::array<std::array<FCollideBatch2D, SHAPE_TYPE_COUNT_2D>, SHAPE_TYPE_COUNT_2D>;
+
+constexpr FCollideTable2D CreateCollideTable()
+{
+    FCollideTable2D table{};
+
+    constexpr auto POINT = ToIndex(EShapeType2D::Point);
+    constexpr auto CIRCLE = ToIndex(EShapeType2D::Circle);
+    constexpr auto LINE = ToIndex(EShapeType2D::Line);
+    constexpr auto RECTANGLE = ToIndex(EShapeType2D::Rectangle);
+    constexpr auto ORIENTED_RECTANGLE = ToIndex(EShapeType2D::OrientedRectangle);
+    constexpr auto POLYGON = ToIndex(EShapeType2D::Polygon);
+
+    // 点按半径为0的圆处理；点与点、点与线段、线段与线段没有面积，不产生接触
+    table[POINT][CIRCLE] = &CollideBatch<CPoint2D, CCircle2D, CollideCircles>;
+    table[POINT][RECTANGLE] = &CollideBatch<CPoint2D, CRectangle2D, CollideCircleBox>;
+    table[POINT][ORIENTED_RECTANGLE] = &CollideBatch<CPoint2D, COrientedRectangle2D, CollideCircleBox>;
+    table[POINT][POLYGON] = &CollideBatch<CPoint2D, CPolygon2D, CollideCirclePolygon>;
+
+    table[CIRCLE][CIRCLE] = &CollideBatch<CCircle2D, CCircle2D, CollideCircles>;
+    table[CIRCLE][LINE] = &CollideBatch<CCircle2D, CLine2D, CollideCircleSegment>;
+    table[CIRCLE][RECTANGLE] = &CollideBatch<CCircle2D, CRectangle2D, CollideCircleBox>;
+    table[CIRCLE][ORIENTED_RECTANGLE] = &CollideBatch<CCircle2D, COrientedRectangle2D, CollideCircleBox>;
+    table[CIRCLE][POLYGON] = &CollideBatch<CCircle2D, CPolygon2D, CollideCirclePolygon>;
+
+    table[LINE][RECTANGLE] = &CollideBatch<CLine2D, CRectangle2D, CollideSegmentBox>;
+    table[LINE][ORIENTED_RECTANGLE] = &CollideBatch<CLine2D, COrientedRectangle2D, CollideSegmentBox>;
+    table[LINE][POLYGON] = &CollideBatch<CLine2D, CPolygon2D, CollideSegmentPolygon>;
+
+    table[RECTANGLE][RECTANGLE] = &CollideBatch<CRectangle2D, CRectangle2D, CollideBoxes>;
+    table[RECTANGLE][ORIENTED_RECTANGLE] = &CollideBatch<CRectangle2D, COrientedRectangle2D, CollideBoxes>;
+    table[ORIENTED_RECTANGLE][ORIENTED_RECTANGLE] =
+        &CollideBatch<COrientedRectangle2D, COrientedRectangle2D, CollideBoxes>;
+
+    table[RECTANGLE][POLYGON] = &CollideBatch<CRectangle2D, CPolygon2D, CollideBoxPolygon>;
+    table[ORIENTED_RECTANGLE][POLYGON] = &CollideBatch<COrientedRectangle2D, CPolygon2D, CollideBoxPolygon>;
+    table[POLYGON][POLYGON] = &CollideBatch<CPolygon2D, CPolygon2D, CollideConvexPolygons>;
+
+    return table;
+}
+
+constexpr FCollideTable2D COLLIDE_TABLE = CreateCollideTable();
+
+} // namespace
+
+void CNarrowPhase2D::Collide(std::span<const SBroadPhasePair2D> pairs, std::span<const SColliderRecord2D> colliders,
+                             const CContactCache2D& cache, std::vector<SContactManifold2D>& outManifolds)
+{
+    outManifolds.clear();
+
+    // 1. 计数：统计每个形状类型对的数量
+    GroupStarts.fill(0);
+    PairKeys.resize(pairs.size());
+
+    for (size_t index = 0; index < pairs.size(); ++index)
+    {
+        const size_t TYPE_A = ToIndex(colliders[pairs[index].ColliderA].ShapeType);
+        const size_t TYPE_B = ToIndex(colliders[pairs[index].ColliderB].ShapeType);
+
+        const size_t KEY = TYPE_A <= TYPE_B ? (TYPE_A * SHAPE_TYPE_COUNT_2D) + TYPE_B
+                                            : (TYPE_B * SHAPE_TYPE_COUNT_2D) + TYPE_A;
+
+        PairKeys[index] = static_cast<uint8_t>(KEY);
+        ++GroupStarts[KEY + 1];
+    }
+
+    for (size_t key = 0; key < SHAPE_PAIR_KEY_COUNT; ++key)
+    {
+        GroupStarts[key + 1] += GroupStarts[key];
+    }
+
+    // 2. 分发：按形状类型对分组，并保证 A 的类型不大于 B
+    std::array<uint32_t, SHAPE_PAIR_KEY_COUNT> cursors{};
+    std::copy(GroupStarts.begin(), GroupStarts.end() - 1, cursors.begin());
+
+    SortedPairs.resize(pairs.size());
+    for (size_t index = 0; index < pairs.size(); ++index)
+    {
+        const SBroadPhasePair2D& pair = pairs[index];
+
+        const bool SWAP = colliders[pair.ColliderA].ShapeType > colliders[pair.ColliderB].ShapeType;
+
+        SortedPairs[cursors[PairKeys[index]]++] =
+            SWAP ? SShapePair2D{pair.ColliderB, pair.ColliderA} : SShapePair2D{pair.ColliderA, pair.ColliderB};
+    }
+
+    // 3. 每组调用一次单态的批处理函数
+    const std::span<const SShapePair2D> SORTED_PAIRS(SortedPairs);
+    for (size_t key = 0; key < SHAPE_PAIR_KEY_COUNT; ++key)
+    {
+        const uint32_t BEGIN = GroupStarts[key];
+        const uint32_t END = GroupStarts[key + 1];
+
+        const FCollideBatch2D COLLIDE = COLLIDE_TABLE[key / SHAPE_TYPE_COUNT_2D][key % SHAPE_TYPE_COUNT_2D];
+        if (BEGIN == END || COLLIDE == nullptr)
+        {
+            continue;
+        }
+
+        COLLIDE(SORTED_PAIRS.subspan(BEGIN, END - BEGIN), colliders, cache, outManifolds);
+    }
+}
+
+FCollideBatch2D CNarrowPhase2D::GetCollideFunction(EShapeType2D typeA, EShapeType2D typeB)
+{
+    return COLLIDE_TABLE[ToIndex(typeA)][ToIndex(typeB)];
+}
+
+NAMESPACE_END() // namespace PHYE::Physics2D
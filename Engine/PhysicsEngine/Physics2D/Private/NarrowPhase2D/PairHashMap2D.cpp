@@ -0,0 +1,97 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#include <NarrowPhase2D/PairHashMap2D.hpp>
+#include <algorithm>
+#include <bit>
+#include <utility>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+namespace
+{
+
+constexpr size_t MIN_CAPACITY = 16;
+
+// 装载因子不超过 1/2
+size_t ComputeCapacity(size_t count)
+{
+    return std::bit_ceil(std::max(count * 2, MIN_CAPACITY));
+}
+
+} // namespace
+
+void CPairHashMap2D::Clear()
+{
+    if (Count == 0)
+    {
+        return;
+    }
+
+    std::fill(Slots.begin(), Slots.end(), SSlot());
+    Count = 0;
+}
+
+void CPairHashMap2D::Reserve(size_t count)
+{
+    const size_t CAPACITY = ComputeCapacity(count);
+    if (CAPACITY > Slots.size())
+    {
+        Slots.assign(CAPACITY, SSlot());
+        Mask = CAPACITY - 1;
+        Count = 0;
+        return;
+    }
+
+    Clear();
+}
+
+void CPairHashMap2D::Insert(uint64_t key, uint32_t value)
+{
+    if ((Count + 1) * 2 > Slots.size())
+    {
+        Rehash(ComputeCapacity(Count + 1));
+    }
+
+    for (size_t slot = Hash(key) & Mask;; slot = (slot + 1) & Mask)
+    {
+        SSlot& entry = Slots[slot];
+        if (entry.Key == key)
+        {
+            entry.Value = value;
+            return;
+        }
+
+        if (entry.Key == EMPTY_KEY)
+        {
+            entry.Key = key;
+            entry.Value = value;
+            ++Count;
+            return;
+        }
+    }
+}
+
+void CPairHashMap2D::Rehash(size_t capacity)
+{
+    std::vector<SSlot> oldSlots(capacity, SSlot());
+    std::swap(oldSlots, Slots);
+
+    Mask = capacity - 1;
+    Count = 0;
+
+    for (const SSlot& entry : oldSlots)
+    {
+        if (entry.Key != EMPTY_KEY)
+        {
+            Insert(entry.Key, entry.Value);
+        }
+    }
+}
+
+NAMESPACE_END() // namespace PHYE::Physics2D
@@ -0,0 +1,162 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#include <NarrowPhase2D/RayCast2D.hpp>
+#include <cmath>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+SRayCastOutput2D RayCastCircle(const SCircleShapeData2D& circle, const SRayCastInput2D& input)
+{
+    SRayCastOutput2D output;
+
+    // |Origin + Translation * t - Center|^2 = Radius^2
+    const SVector2F OFFSET = input.Origin - circle.Center;
+    const float     C = (OFFSET | OFFSET) - (circle.Radius * circle.Radius);
+    if (C < 0.0F)
+    {
+        // 起点在圆内
+        return output;
+    }
+
+    const float A = input.Translation | input.Translation;
+    const float B = OFFSET | input.Translation;
+    const float DISCRIMINANT = (B * B) - (A * C);
+    if (A < COLLIDE_LINEAR_EPSILON_2D * COLLIDE_LINEAR_EPSILON_2D || DISCRIMINANT < 0.0F)
+    {
+        return output;
+    }
+
+    // 较小的根即进入点
+    const float FRACTION = -(B + std::sqrt(DISCRIMINANT)) / A;
+    if (FRACTION < 0.0F || FRACTION > input.MaxFraction)
+    {
+        return output;
+    }
+
+    output.Fraction = FRACTION;
+    output.Point = input.Origin + (input.Translation * FRACTION);
+    output.Normal = (output.Point - circle.Center).Normalized();
+    output.IsHit = true;
+
+    return output;
+}
+
+SRayCastOutput2D RayCastSegment(const SSegmentShapeData2D& segment, const SRayCastInput2D& input)
+{
+    SRayCastOutput2D output;
+
+    // Origin + Translation * t = Start + Edge * u
+    const SVector2F EDGE = segment.End - segment.Start;
+    const float     DENOMINATOR = input.Translation ^ EDGE;
+    if (std::abs(DENOMINATOR) < COLLIDE_LINEAR_EPSILON_2D)
+    {
+        // 平行或退化的线段
+        return output;
+    }
+
+    const SVector2F OFFSET = segment.Start - input.Origin;
+    const float     FRACTION = (OFFSET ^ EDGE) / DENOMINATOR;
+    const float     EDGE_FRACTION = (OFFSET ^ input.Translation) / DENOMINATOR;
+
+    if (FRACTION < 0.0F || FRACTION > input.MaxFraction || EDGE_FRACTION < 0.0F || EDGE_FRACTION > 1.0F)
+    {
+        return output;
+    }
+
+    // 法线朝向射线起点一侧
+    SVector2F normal = SVector2F(EDGE.Y, -EDGE.X).Normalized();
+    if ((normal | input.Translation) > 0.0F)
+    {
+        normal = -normal;
+    }
+
+    output.Fraction = FRACTION;
+    output.Point = input.Origin + (input.Translation * FRACTION);
+    output.Normal = normal;
+    output.IsHit = true;
+
+    return output;
+}
+
+SRayCastOutput2D RayCastPolygon(const SPolygonShapeData2D& polygon, const SRayCastInput2D& input)
+{
+    SRayCastOutput2D output;
+
+    // 用每条边的半平面裁剪射线区间 [lower, upper]
+    float    lower = 0.0F;
+    float    upper = input.MaxFraction;
+    uint32_t enterEdge = polygon.Count;
+
+    for (uint32_t index = 0; index < polygon.Count; ++index)
+    {
+        const SVector2F& NORMAL = polygon.Normals[index];
+        const float      NUMERATOR = NORMAL | (polygon.Vertices[index] - input.Origin);
+        const float      DENOMINATOR = NORMAL | input.Translation;
+
+        if (DENOMINATOR == 0.0F)
+        {
+            // 与边平行且在边的外侧
+            if (NUMERATOR < 0.0F)
+            {
+                return output;
+            }
+        }
+        else if (DENOMINATOR < 0.0F && NUMERATOR < lower * DENOMINATOR)
+        {
+            // 进入该半平面
+            lower = NUMERATOR / DENOMINATOR;
+            enterEdge = index;
+        }
+        else if (DENOMINATOR > 0.0F && NUMERATOR < upper * DENOMINATOR)
+        {
+            // 离开该半平面
+            upper = NUMERATOR / DENOMINATOR;
+        }
+
+        if (upper < lower)
+        {
+            return output;
+        }
+    }
+
+    // 没有进入任何半平面：起点在多边形内
+    if (enterEdge == polygon.Count)
+    {
+        return output;
+    }
+
+    output.Fraction = lower;
+    output.Point = input.Origin + (input.Translation * lower);
+    output.Normal = polygon.Normals[enterEdge];
+    output.IsHit = true;
+
+    return output;
+}
+
+SRayCastOutput2D RayCastShape(const CPrimitiveShape2D& shape, const SPose2D& pose, const SRayCastInput2D& input)
+{
+    switch (shape.GetShapeType())
+    {
+        case EShapeType2D::Circle:
+            return RayCastCircle(ToShapeData(static_cast<const CCircle2D&>(shape), pose), input);
+        case EShapeType2D::Line:
+            return RayCastSegment(ToShapeData(static_cast<const CLine2D&>(shape), pose), input);
+        case EShapeType2D::Rectangle:
+            return RayCastPolygon(ToPolygon(ToShapeData(static_cast<const CRectangle2D&>(shape), pose)), input);
+        case EShapeType2D::OrientedRectangle:
+            return RayCastPolygon(ToPolygon(ToShapeData(static_cast<const COrientedRectangle2D&>(shape), pose)),
+                                  input);
+        case EShapeType2D::Polygon:
+            return RayCastPolygon(ToShapeData(static_cast<const CPolygon2D&>(shape), pose), input);
+        default:
+            return {};
+    }
+}
+
+NAMESPACE_END() // namespace PHYE::Physics2D
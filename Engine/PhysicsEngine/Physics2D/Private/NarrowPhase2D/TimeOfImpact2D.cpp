@@ -0,0 +1,110 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#include <MathUtility/MathUtilities.hpp>
+#include <NarrowPhase2D/CollideFunctions2D.hpp>
+#include <NarrowPhase2D/Distance2D.hpp>
+#include <NarrowPhase2D/TimeOfImpact2D.hpp>
+#include <cmath>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+namespace
+{
+
+// 接近速度的上界低于此值时视为不再接近
+constexpr float TOI_APPROACH_EPSILON = 1.0E-6F;
+
+// 形状上离刚体原点最远的点的距离，用于估计旋转带来的位移
+float ComputeExtent(const SDistanceProxy2D& proxy, const SPose2D& local)
+{
+    float extentSq = 0.0F;
+    for (const SVector2F& vertex : proxy.GetVertices())
+    {
+        const SVector2F POINT = local.TransformPoint(vertex);
+        extentSq = BE::Math::Max(extentSq, POINT | POINT);
+    }
+
+    return std::sqrt(extentSq) + proxy.Radius;
+}
+
+} // namespace
+
+STOIOutput2D ComputeTimeOfImpact(const SDistanceProxy2D& proxyA, const SPose2D& localA, const SSweep2D& sweepA,
+                                 const SDistanceProxy2D& proxyB, const SPose2D& localB, const SSweep2D& sweepB)
+{
+    STOIOutput2D output;
+
+    const float TOTAL_RADIUS = proxyA.Radius + proxyB.Radius;
+
+    // 单位时间内两形状沿法线接近的速度上界：相对平移 + 各自的旋转 * 半径
+    const SVector2F RELATIVE_DISPLACEMENT = (sweepA.Center1 - sweepA.Center0) - (sweepB.Center1 - sweepB.Center0);
+    const float     ANGULAR_BOUND = (std::abs(sweepA.Angle1 - sweepA.Angle0) * ComputeExtent(proxyA, localA)) +
+                                (std::abs(sweepB.Angle1 - sweepB.Angle0) * ComputeExtent(proxyB, localB));
+
+    SSimplexCache2D cache;
+
+    float time = 0.0F;
+
+    for (uint32_t iteration = 0; iteration < MAX_TOI_ITERATIONS_2D; ++iteration)
+    {
+        const SDistanceProxy2D WORLD_A = TransformDistanceProxy(proxyA, sweepA.GetPose(time) * localA);
+        const SDistanceProxy2D WORLD_B = TransformDistanceProxy(proxyB, sweepB.GetPose(time) * localB);
+
+        const SDistanceOutput2D DISTANCE = ComputeDistance(WORLD_A.GetVertices(), WORLD_B.GetVertices(), cache);
+
+        output.Iterations = iteration + 1;
+
+        // 核心已经重叠：只可能发生在起点，前进总是保守的
+        if (DISTANCE.Distance < COLLIDE_LINEAR_EPSILON_2D)
+        {
+            output.State = ETOIState2D::Touching;
+            output.Time = time;
+            return output;
+        }
+
+        const SVector2F NORMAL = (DISTANCE.PointB - DISTANCE.PointA) * (1.0F / DISTANCE.Distance);
+        const float     SEPARATION = DISTANCE.Distance - TOTAL_RADIUS;
+
+        output.Time = time;
+        output.Normal = NORMAL;
+        output.Point = DISTANCE.PointA + (NORMAL * proxyA.Radius);
+
+        if (SEPARATION <= TOI_TARGET_SEPARATION_2D + TOI_TOLERANCE_2D)
+        {
+            output.State = iteration == 0 ? ETOIState2D::Touching : ETOIState2D::Hit;
+            return output;
+        }
+
+        // 不再接近，或在扫掠结束前无法到达目标间距
+        const float APPROACH = (RELATIVE_DISPLACEMENT | NORMAL) + ANGULAR_BOUND;
+        if (APPROACH <= TOI_APPROACH_EPSILON)
+        {
+            break;
+        }
+
+        time += (SEPARATION - TOI_TARGET_SEPARATION_2D) / APPROACH;
+        if (time >= 1.0F)
+        {
+            break;
+        }
+
+        // 迭代次数用尽时当前时刻仍然安全，按碰撞处理，避免穿透
+        if (iteration + 1 == MAX_TOI_ITERATIONS_2D)
+        {
+            output.State = ETOIState2D::Hit;
+            return output;
+        }
+    }
+
+    output.State = ETOIState2D::Separated;
+    output.Time = 1.0F;
+    return output;
+}
+
+NAMESPACE_END() // namespace PHYE::Physics2D
@@ -11,7 +11,9 @@
 
 NAMESPACE_BEGIN(PHYE::Physics2D)
 
-CPhysicsObject2D::CPhysicsObject2D() : RigidBody(std::move(std::make_unique<CRigidBody2D>()))
+CPhysicsObject2D::CPhysicsObject2D(CPhysicsWorld2D& world) : RigidBody(std::make_unique<CRigidBody2D>(world))
 {}
 
+CPhysicsObject2D::~CPhysicsObject2D() = default;
+
 NAMESPACE_END() // namespace PHYE::Physics2D
\ No newline at end of file
@@ -6,14 +6,1913 @@
  * For more detail, please refer to the LICENSE file in the root directory of this project.
  */
 
+#include <BroadPhase2D/AABBTreeBroadPhase2D.hpp>
+#include <BroadPhase2D/SpatialHashGrid2D.hpp>
+#include <BroadPhase2D/SweepAndPrune2D.hpp>
+#include <Integrator2D/RigidBodyIntegrator2D.hpp>
+#include <Job/JobSystem.hpp>
+#include <NarrowPhase2D/RayCast2D.hpp>
+#include <NarrowPhase2D/TimeOfImpact2D.hpp>
+#include <PhysicsObject2D/PhysicsObject2D.hpp>
 #include <PhysicsWorld2D/PhysicsWorld2D.hpp>
+#include <Rigid2D/Collider2D/Collider2D.hpp>
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <limits>
 
 NAMESPACE_BEGIN(PHYE::Physics2D)
 
-CPhysicsWorld2D& CPhysicsWorld2D::Get()
+namespace
 {
-    static CPhysicsWorld2D instance;
-    return instance;
+
+using SStepClock = std::chrono::steady_clock;
+
+// 一个任务处理的射线包数
+constexpr uint32_t RAY_PACKETS_PER_JOB_2D = 4;
+
+// 64位 FNV-1a 的初始值与乘数
+constexpr uint64_t STATE_HASH_OFFSET_2D = 14695981039346656037ULL;
+constexpr uint64_t STATE_HASH_PRIME_2D = 1099511628211ULL;
+
+/**
+ * @brief Adds the lifetime of the scope to a stage time slot(in microseconds).
+ */
+struct SScopedStageTimer final
+{
+    explicit SScopedStageTimer(double& target) : Target(target), Start(SStepClock::now())
+    {}
+
+    ~SScopedStageTimer()
+    {
+        Target += std::chrono::duration<double, std::micro>(SStepClock::now() - Start).count();
+    }
+
+    SScopedStageTimer(const SScopedStageTimer&) = delete;
+    SScopedStageTimer(SScopedStageTimer&&) noexcept = delete;
+
+    SScopedStageTimer& operator=(const SScopedStageTimer&) = delete;
+    SScopedStageTimer& operator=(SScopedStageTimer&&) noexcept = delete;
+
+private:
+    double&                Target;
+    SStepClock::time_point Start;
+};
+
+// 按设置创建宽相位
+std::unique_ptr<IBroadPhase2D> CreateBroadPhase(const SPhysicsWorldSettings2D& settings)
+{
+    switch (settings.BroadPhaseType)
+    {
+        case EBroadPhaseType2D::SpatialHash:
+            return std::make_unique<CSpatialHashGrid2D>(settings.GridCellSize);
+        case EBroadPhaseType2D::SweepAndPrune:
+            return std::make_unique<CSweepAndPrune2D>();
+        case EBroadPhaseType2D::AABBTree:
+        default:
+            return std::make_unique<CAABBTreeBroadPhase2D>();
+    }
+}
+
+// 复制到快照缓冲，容量按倍数增长，世界缓慢变大时不必每次都重新分配
+template <typename T>
+void CopyArray(const std::vector<T>& source, std::vector<T>& target)
+{
+    if (target.capacity() < source.size())
+    {
+        target.reserve(std::max(source.size(), target.capacity() * 2));
+    }
+
+    target = source;
+}
+
+// 按字节把一个32位字混入哈希
+uint64_t HashWord(uint64_t hash, uint32_t word)
+{
+    for (uint32_t shift = 0; shift < 32; shift += 8)
+    {
+        hash ^= (word >> shift) & 0xFFU;
+        hash *= STATE_HASH_PRIME_2D;
+    }
+
+    return hash;
+}
+
+// 浮点数按位哈希，-0 与 +0 不同
+uint64_t HashFloat(uint64_t hash, float value)
+{
+    return HashWord(hash, std::bit_cast<uint32_t>(value));
+}
+
+// 流形的碰撞体顺序由形状类型决定，排序时用较小的ID作为主键
+uint64_t GetManifoldKey(const SContactManifold2D& manifold)
+{
+    const uint32_t LOW = std::min(manifold.ColliderA, manifold.ColliderB);
+    const uint32_t HIGH = std::max(manifold.ColliderA, manifold.ColliderB);
+    return (static_cast<uint64_t>(LOW) << 32U) | HIGH;
+}
+
+// 一对刚体的键，与刚体顺序无关
+uint64_t GetBodyPairKey(BodyIndexType bodyA, BodyIndexType bodyB)
+{
+    const BodyIndexType LOW = std::min(bodyA, bodyB);
+    const BodyIndexType HIGH = std::max(bodyA, bodyB);
+    return (static_cast<uint64_t>(LOW) << 32U) | HIGH;
+}
+
+// 参与模拟且未休眠的刚体
+bool IsBodyActive(const SRigidBodyComponent2D* body)
+{
+    return body != nullptr && body->Type != PHYE::PhysicsBase::ERigidBodyType::Static && body->IsAwake;
+}
+
+bool IsBodySleeping(const SRigidBodyComponent2D* body)
+{
+    return body != nullptr && body->Type == PHYE::PhysicsBase::ERigidBodyType::Dynamic && !body->IsAwake;
+}
+
+bool IsBodyBullet(const SRigidBodyComponent2D* body)
+{
+    return IsBodyActive(body) && body->Type == PHYE::PhysicsBase::ERigidBodyType::Dynamic && body->IsBullet;
+}
+
+// 子弹在一个子步内最早的碰撞
+struct SContinuousHit2D final
+{
+    float     Time = 1.0F;
+    uint32_t  Collider = INVALID_COLLIDER_ID;
+    SVector2F Normal;
+    SVector2F Point;
+};
+
+// 刚体上一点的速度
+SVector2F GetPointVelocity(const SRigidBodyComponent2D& body, const SVector2F& offset)
+{
+    return body.Velocity + SVector2F(-body.AngularVelocity * offset.Y, body.AngularVelocity * offset.X);
+}
+
+void ApplyImpulse(SRigidBodyComponent2D& body, float inverseMass, float inverseInertia, const SVector2F& offset,
+                  const SVector2F& impulse)
+{
+    body.Velocity += impulse * inverseMass;
+    body.AngularVelocity += inverseInertia * (offset ^ impulse);
+}
+
+/**
+ * @brief Contact impulse between a bullet and the body it hit, at the time of impact.
+ * @details A single point version of the contact solver: a normal impulse with restitution, then friction clamped by
+ * the normal impulse. Bodies that are not Dynamic have infinite mass.
+ */
+void ApplyImpactImpulse(SRigidBodyComponent2D& bullet, SRigidBodyComponent2D& other, const SVector2F& normal,
+                        const SVector2F& point, float friction, float restitution)
+{
+    const bool  IS_OTHER_DYNAMIC = other.Type == PHYE::PhysicsBase::ERigidBodyType::Dynamic;
+    const float INV_MASS_A = bullet.InverseMass;
+    const float INV_INERTIA_A = bullet.InverseInertia;
+    const float INV_MASS_B = IS_OTHER_DYNAMIC ? other.InverseMass : 0.0F;
+    const float INV_INERTIA_B = IS_OTHER_DYNAMIC ? other.InverseInertia : 0.0F;
+
+    const SVector2F OFFSET_A = point - bullet.Position;
+    const SVector2F OFFSET_B = point - other.Position;
+
+    const auto EFFECTIVE_MASS = [&](const SVector2F& direction)
+    {
+        const float CROSS_A = OFFSET_A ^ direction;
+        const float CROSS_B = OFFSET_B ^ direction;
+        const float K = INV_MASS_A + INV_MASS_B + (INV_INERTIA_A * CROSS_A * CROSS_A) +
+                        (INV_INERTIA_B * CROSS_B * CROSS_B);
+        return K > 0.0F ? 1.0F / K : 0.0F;
+    };
+
+    // 1. 法向：只处理接近的速度
+    const float NORMAL_SPEED =
+        (GetPointVelocity(other, OFFSET_B) - GetPointVelocity(bullet, OFFSET_A)) | normal;
+    if (NORMAL_SPEED >= 0.0F)
+    {
+        return;
+    }
+
+    const float BOUNCE = -NORMAL_SPEED > RESTITUTION_VELOCITY_THRESHOLD_2D ? restitution : 0.0F;
+    const float NORMAL_IMPULSE = -(1.0F + BOUNCE) * NORMAL_SPEED * EFFECTIVE_MASS(normal);
+
+    ApplyImpulse(bullet, INV_MASS_A, INV_INERTIA_A, OFFSET_A, normal * -NORMAL_IMPULSE);
+    ApplyImpulse(other, INV_MASS_B, INV_INERTIA_B, OFFSET_B, normal * NORMAL_IMPULSE);
+
+    // 2. 摩擦
+    const SVector2F TANGENT(normal.Y, -normal.X);
+    const float     TANGENT_SPEED =
+        (GetPointVelocity(other, OFFSET_B) - GetPointVelocity(bullet, OFFSET_A)) | TANGENT;
+    const float MAX_FRICTION = friction * NORMAL_IMPULSE;
+    const float TANGENT_IMPULSE =
+        BE::Math::Clamp(-TANGENT_SPEED * EFFECTIVE_MASS(TANGENT), -MAX_FRICTION, MAX_FRICTION);
+
+    ApplyImpulse(bullet, INV_MASS_A, INV_INERTIA_A, OFFSET_A, TANGENT * -TANGENT_IMPULSE);
+    ApplyImpulse(other, INV_MASS_B, INV_INERTIA_B, OFFSET_B, TANGENT * TANGENT_IMPULSE);
+}
+
+/**
+ * @brief Keeps the closest hit of every ray of a packet while the broadphase reports the colliders it crosses.
+ * @details The fraction of the closest hit becomes the MaxFraction of the lane, so the traversal skips the boxes behind
+ * it.
+ */
+class CClosestRayCastCallback2D final : public IRayPacketCallback2D
+{
+public:
+    CClosestRayCastCallback2D(std::span<const SColliderRecord2D> colliders, std::span<const SRayCastInput2D> inputs,
+                              std::span<SRayCastHit2D> hits, uint32_t layerMask)
+        : Colliders(colliders), Inputs(inputs), Hits(hits), LayerMask(layerMask)
+    {}
+
+    void ReportCollider(uint32_t colliderId, uint32_t laneMask, SRayPacket2D& packet) override
+    {
+        const SColliderRecord2D& record = Colliders[colliderId];
+        if ((record.CollisionLayers & LayerMask) == 0)
+        {
+            return;
+        }
+
+        for (uint32_t mask = laneMask; mask != 0; mask &= mask - 1)
+        {
+            const auto LANE = static_cast<uint32_t>(std::countr_zero(mask));
+
+            SRayCastInput2D input = Inputs[LANE];
+            input.MaxFraction = packet.MaxFraction[LANE];
+
+            const SRayCastOutput2D OUTPUT = RayCastShape(*record.Shape, record.Pose, input);
+            if (!OUTPUT.IsHit)
+            {
+                continue;
+            }
+
+            Hits[LANE] = {colliderId, OUTPUT.Point, OUTPUT.Normal, OUTPUT.Fraction};
+            packet.MaxFraction[LANE] = OUTPUT.Fraction;
+        }
+    }
+
+private:
+    std::span<const SColliderRecord2D> Colliders;
+    std::span<const SRayCastInput2D>   Inputs;
+    std::span<SRayCastHit2D>           Hits;
+    uint32_t                           LayerMask;
+};
+
+/**
+ * @brief Writes the colliders whose shape overlaps a proxy(in world space) until the output is full.
+ */
+class COverlapQueryCallback2D final : public IBroadPhaseQueryCallback2D
+{
+public:
+    COverlapQueryCallback2D(std::span<const SColliderRecord2D> colliders, const SDistanceProxy2D& proxy,
+                            const CBoundingAABB2D& bounds, uint32_t layerMask, std::span<uint32_t> outColliders)
+        : Colliders(colliders), Proxy(proxy), Bounds(bounds), LayerMask(layerMask), Output(outColliders)
+    {}
+
+    bool ReportCollider(uint32_t colliderId) override
+    {
+        const SColliderRecord2D& record = Colliders[colliderId];
+
+        // 宽相位中是扩大后的包围盒，先用紧包围盒过滤
+        if ((record.CollisionLayers & LayerMask) == 0 || !record.AABB.Overlaps(Bounds))
+        {
+            return true;
+        }
+
+        if (!TestOverlap(Proxy, TransformDistanceProxy(MakeDistanceProxy(*record.Shape), record.Pose)))
+        {
+            return true;
+        }
+
+        Output[Count++] = colliderId;
+        return Count < Output.size();
+    }
+
+    [[nodiscard]] uint32_t GetCount() const
+    {
+        return Count;
+    }
+
+private:
+    std::span<const SColliderRecord2D> Colliders;
+    const SDistanceProxy2D&            Proxy;
+    const CBoundingAABB2D&             Bounds;
+    uint32_t                           LayerMask;
+    std::span<uint32_t>                Output;
+    uint32_t                           Count = 0;
+};
+
+/**
+ * @brief Time of impact of a swept shape against every candidate, keeping the closest hits sorted by fraction.
+ */
+class CShapeCastCallback2D final : public IBroadPhaseQueryCallback2D
+{
+public:
+    CShapeCastCallback2D(std::span<const SColliderRecord2D> colliders, const SDistanceProxy2D& proxy,
+                         const SPose2D& localPose, const SSweep2D& sweep, uint32_t layerMask,
+                         std::span<SShapeCastHit2D> outHits)
+        : Colliders(colliders), Proxy(proxy), LocalPose(localPose), Sweep(sweep), LayerMask(layerMask),
+          Output(outHits)
+    {}
+
+    bool ReportCollider(uint32_t colliderId) override
+    {
+        const SColliderRecord2D& record = Colliders[colliderId];
+        if ((record.CollisionLayers & LayerMask) == 0)
+        {
+            return true;
+        }
+
+        // 碰撞体停在当前位姿
+        const STOIOutput2D TOI =
+            ComputeTimeOfImpact(Proxy, LocalPose, Sweep, MakeDistanceProxy(*record.Shape), record.Pose, SSweep2D());
+
+        if (TOI.State == ETOIState2D::Hit)
+        {
+            Insert({colliderId, TOI.Point, -TOI.Normal, TOI.Time});
+        }
+        else if (TOI.State == ETOIState2D::Touching)
+        {
+            Insert({colliderId, TOI.Point, ComputeTouchingNormal(TOI, record), 0.0F});
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] uint32_t GetCount() const
+    {
+        return Count;
+    }
+
+private:
+    // 起点已接触：核心分离时用距离查询的法线，核心重叠时用穿透方向，两者都没有时(如两个圆心重合)为零向量
+    SVector2F ComputeTouchingNormal(const STOIOutput2D& toi, const SColliderRecord2D& record) const
+    {
+        if ((toi.Normal | toi.Normal) > 0.0F)
+        {
+            return -toi.Normal;
+        }
+
+        const SDistanceProxy2D START = TransformDistanceProxy(Proxy, Sweep.GetPose(0.0F) * LocalPose);
+        const SDistanceProxy2D COLLIDER = TransformDistanceProxy(MakeDistanceProxy(*record.Shape), record.Pose);
+
+        SSimplexCache2D      cache;
+        SPenetrationOutput2D penetration;
+        if (ComputePenetration(START.GetVertices(), COLLIDER.GetVertices(), cache, penetration) &&
+            penetration.Depth > 0.0F)
+        {
+            return -penetration.Normal;
+        }
+
+        return SVector2F(0.0F);
+    }
+
+    // 插入排序，输出已满时丢弃最远的结果
+    void Insert(const SShapeCastHit2D& hit)
+    {
+        if (Count == Output.size())
+        {
+            if (Count == 0 || hit.Fraction >= Output[Count - 1].Fraction)
+            {
+                return;
+            }
+            --Count;
+        }
+
+        uint32_t index = Count++;
+        for (; index > 0 && Output[index - 1].Fraction > hit.Fraction; --index)
+        {
+            Output[index] = Output[index - 1];
+        }
+        Output[index] = hit;
+    }
+
+private:
+    std::span<const SColliderRecord2D> Colliders;
+    const SDistanceProxy2D&            Proxy;
+    const SPose2D&                     LocalPose;
+    const SSweep2D&                    Sweep;
+    uint32_t                           LayerMask;
+    std::span<SShapeCastHit2D>         Output;
+    uint32_t                           Count = 0;
+};
+
+} // namespace
+
+
+
+double SPhysicsStepStats2D::GetStageTime(EPhysicsStage2D stage) const
+{
+    return StageTimes[static_cast<size_t>(stage)];
+}
+
+void SPhysicsStepStats2D::Reset()
+{
+    StageTimes.fill(0.0);
+    TotalTime = 0.0;
+    StepCount = 0;
+    SubStepCount = 0;
+    DroppedTime = 0.0F;
+}
+
+
+
+CPhysicsWorld2D::CPhysicsWorld2D(const SPhysicsWorldSettings2D& settings)
+    : Integrator(*this), Settings(settings), Accumulator(0.0F), StepIndex(0), StateHash(STATE_HASH_OFFSET_2D),
+      NextSnapshot(0), StructureVersion(0)
+{
+    // Settings 在 BroadPhase 之后声明，因此在构造函数体内创建
+    BroadPhase = CreateBroadPhase(Settings);
+}
+
+CPhysicsWorld2D::~CPhysicsWorld2D() = default;
+
+void CPhysicsWorld2D::Step(float deltaTime)
+{
+    StepStats.Reset();
+
+    SScopedStageTimer totalTimer(StepStats.TotalTime);
+
+    // 在步与步之间合并已准备好的区域
+    UpdateRegions();
+
+    if (deltaTime <= 0.0F || Settings.FixedTimeStep <= 0.0F)
+    {
+        return;
+    }
+
+    Accumulator += deltaTime;
+
+    const uint32_t SUB_STEP_COUNT = std::max<uint32_t>(Settings.SubStepCount, 1);
+    const float    SUB_TIME_STEP = Settings.FixedTimeStep / static_cast<float>(SUB_STEP_COUNT);
+
+    while (Accumulator >= Settings.FixedTimeStep && StepStats.StepCount < Settings.MaxStepsPerFrame)
+    {
+        for (uint32_t subStep = 0; subStep < SUB_STEP_COUNT; ++subStep)
+        {
+            SubStep(SUB_TIME_STEP);
+            ++StepStats.SubStepCount;
+        }
+
+        Accumulator -= Settings.FixedTimeStep;
+        ++StepStats.StepCount;
+        ++StepIndex;
+
+        if (Settings.EnableDeterminism)
+        {
+            UpdateStateHash();
+        }
+    }
+
+    // 超出单帧预算的整步直接丢弃，只保留不足一步的余量用于插值，保证每帧耗时有上界
+    if (Accumulator >= Settings.FixedTimeStep)
+    {
+        const float REMAINDER = std::fmod(Accumulator, Settings.FixedTimeStep);
+        StepStats.DroppedTime = Accumulator - REMAINDER;
+        Accumulator = REMAINDER;
+    }
+
+    if (StepStats.StepCount > 0)
+    {
+        // 外力只在本帧的步进中生效
+        ClearForces2D(RigidBodies.GetComponents());
+        SyncTransforms2D(RigidBodies.GetComponents());
+    }
+}
+
+void CPhysicsWorld2D::StepWorlds(std::span<CPhysicsWorld2D* const> worlds, float deltaTime)
+{
+    BE::Core::CJobSystem::Get().ParallelFor(static_cast<uint32_t>(worlds.size()), 1,
+                                            [&](uint32_t begin, uint32_t end)
+                                            {
+                                                for (uint32_t index = begin; index < end; ++index)
+                                                {
+                                                    worlds[index]->Step(deltaTime);
+                                                }
+                                            });
+}
+
+SBodyId2D CPhysicsWorld2D::CreateRigidBody(PHYE::PhysicsBase::ERigidBodyType type, float mass, float inertia)
+{
+    SBodyId2D body;
+
+    if (FreeBodyIndices.empty())
+    {
+        assert(BodyGenerations.size() <= std::numeric_limits<BodyIndexType>::max());
+
+        body.Index = static_cast<BodyIndexType>(BodyGenerations.size());
+        BodyGenerations.push_back(1);
+    }
+    else
+    {
+        body.Index = FreeBodyIndices.back();
+        FreeBodyIndices.pop_back();
+    }
+
+    body.Generation = BodyGenerations[body.Index];
+    RigidBodies.Add(body.Index, type, mass, inertia);
+    ++StructureVersion;
+
+    return body;
+}
+
+void CPhysicsWorld2D::DestroyRigidBody(SBodyId2D body)
+{
+    if (GetRigidBody(body) == nullptr)
+    {
+        return;
+    }
+
+    // 槽位会被复用，连接该刚体的关节必须一起销毁，否则会约束之后占用槽位的刚体
+    DestroyBodyJoints(std::span<const BodyIndexType>(&body.Index, 1));
+    RemoveRigidBody(body);
+}
+
+void CPhysicsWorld2D::RemoveRigidBody(SBodyId2D body)
+{
+    RigidBodies.Remove(body.Index);
+
+    // 世代号跳过0，0 保留给无效的 ID
+    uint16_t& generation = BodyGenerations[body.Index];
+    generation = generation == std::numeric_limits<uint16_t>::max() ? 1 : generation + 1;
+
+    FreeBodyIndices.push_back(body.Index);
+    ++StructureVersion;
+}
+
+void CPhysicsWorld2D::WakeRigidBody(SBodyId2D body)
+{
+    SRigidBodyComponent2D* component = GetRigidBody(body);
+    if (component != nullptr)
+    {
+        WakeBody(*component);
+    }
+}
+
+SRigidBodyComponent2D* CPhysicsWorld2D::GetRigidBody(SBodyId2D body)
+{
+    if (body.Index >= BodyGenerations.size() || BodyGenerations[body.Index] != body.Generation)
+    {
+        return nullptr;
+    }
+
+    return RigidBodies.Get(body.Index);
+}
+
+std::span<SRigidBodyComponent2D> CPhysicsWorld2D::GetRigidBodies()
+{
+    return RigidBodies.GetComponents();
+}
+
+CForceFieldRegistry2D& CPhysicsWorld2D::GetForceFields()
+{
+    return ForceFields;
+}
+
+const CForceFieldRegistry2D& CPhysicsWorld2D::GetForceFields() const
+{
+    return ForceFields;
+}
+
+SJointId2D CPhysicsWorld2D::CreateJoint(const SDistanceJointDef2D& def)
+{
+    LinkJointBodies(def.BodyA, def.BodyB, def.CollideConnected);
+    return Joints.Add(def);
+}
+
+SJointId2D CPhysicsWorld2D::CreateJoint(const SRevoluteJointDef2D& def)
+{
+    LinkJointBodies(def.BodyA, def.BodyB, def.CollideConnected);
+    return Joints.Add(def);
+}
+
+SJointId2D CPhysicsWorld2D::CreateJoint(const SPrismaticJointDef2D& def)
+{
+    LinkJointBodies(def.BodyA, def.BodyB, def.CollideConnected);
+    return Joints.Add(def);
+}
+
+SJointId2D CPhysicsWorld2D::CreateJoint(const SWeldJointDef2D& def)
+{
+    LinkJointBodies(def.BodyA, def.BodyB, def.CollideConnected);
+    return Joints.Add(def);
+}
+
+void CPhysicsWorld2D::DestroyJoint(SJointId2D jointId)
+{
+    const uint32_t INDEX = Joints.GetDenseIndex(jointId);
+    if (INDEX == INVALID_JOINT_ID)
+    {
+        return;
+    }
+
+    const SBodyId2D BODY_A = Joints.GetBodiesA()[INDEX];
+    const SBodyId2D BODY_B = Joints.GetBodiesB()[INDEX];
+
+    // 刚体在同一岛屿中休眠，断开后两侧都需要重新计算
+    WakeRigidBody(BODY_A);
+    WakeRigidBody(BODY_B);
+
+    if (Joints.GetCollideConnected()[INDEX] == 0)
+    {
+        const auto PAIR = std::lower_bound(JointFilterPairs.begin(), JointFilterPairs.end(),
+                                           GetBodyPairKey(BODY_A.Index, BODY_B.Index));
+        JointFilterPairs.erase(PAIR);
+    }
+
+    Joints.Remove(jointId);
+}
+
+const CJointStorage2D& CPhysicsWorld2D::GetJoints() const
+{
+    return Joints;
+}
+
+void CPhysicsWorld2D::SetJointLength(SJointId2D jointId, float length)
+{
+    const uint32_t INDEX = Joints.GetDenseIndex(jointId);
+    if (INDEX == INVALID_JOINT_ID)
+    {
+        return;
+    }
+
+    Joints.SetLength(jointId, length);
+    WakeRigidBody(Joints.GetBodiesA()[INDEX]);
+    WakeRigidBody(Joints.GetBodiesB()[INDEX]);
+}
+
+uint32_t CPhysicsWorld2D::AddCollider(SBodyId2D body, CCollider2D& collider)
+{
+    assert(collider.GetColliderId() == INVALID_COLLIDER_ID);
+    assert(collider.GetShape() != nullptr);
+
+    const auto                   BODY_INDEX = body.Index;
+    const SRigidBodyComponent2D* bodyComponent = GetRigidBody(body);
+    assert(bodyComponent != nullptr);
+
+    uint32_t colliderId = 0;
+    if (FreeColliderIds.empty())
+    {
+        colliderId = static_cast<uint32_t>(Colliders.size());
+        Colliders.emplace_back();
+    }
+    else
+    {
+        colliderId = FreeColliderIds.back();
+        FreeColliderIds.pop_back();
+    }
+
+    const bool IS_DYNAMIC = bodyComponent->Type == PHYE::PhysicsBase::ERigidBodyType::Dynamic;
+
+    SColliderRecord2D& record = Colliders[colliderId];
+    record.Collider = &collider;
+    record.Shape = collider.GetShape();
+    record.ShapeType = record.Shape->GetShapeType();
+    record.BodyIndex = BODY_INDEX;
+    record.CollisionLayers = collider.GetCollisionLayers();
+    record.LocalPose = collider.GetLocalPose();
+    record.Pose = SPose2D(bodyComponent->Position, bodyComponent->Rotation) * record.LocalPose;
+    record.AABB = record.Shape->ComputeAABB(record.Pose);
+    record.ProxyId = BroadPhase->CreateProxy(record.AABB, colliderId, IS_DYNAMIC);
+
+    collider.ColliderId = colliderId;
+    ++StructureVersion;
+
+    return colliderId;
+}
+
+void CPhysicsWorld2D::RemoveCollider(CCollider2D& collider)
+{
+    const uint32_t COLLIDER_ID = collider.GetColliderId();
+    if (COLLIDER_ID >= Colliders.size() || Colliders[COLLIDER_ID].Collider != &collider)
+    {
+        return;
+    }
+
+    // 唤醒与该碰撞体接触的刚体，避免它们停在已不存在的支撑上
+    for (const auto& manifold : ContactManifolds)
+    {
+        if (manifold.ColliderA == COLLIDER_ID || manifold.ColliderB == COLLIDER_ID)
+        {
+            const uint32_t OTHER = manifold.ColliderA == COLLIDER_ID ? manifold.ColliderB : manifold.ColliderA;
+            if (SRigidBodyComponent2D* body = RigidBodies.Get(Colliders[OTHER].BodyIndex); body != nullptr)
+            {
+                WakeBody(*body);
+            }
+        }
+    }
+
+    ReleaseCollider(COLLIDER_ID);
+    collider.ColliderId = INVALID_COLLIDER_ID;
+}
+
+void CPhysicsWorld2D::RefreshCollider(const CCollider2D& collider)
+{
+    const uint32_t COLLIDER_ID = collider.GetColliderId();
+    if (COLLIDER_ID >= Colliders.size() || Colliders[COLLIDER_ID].Collider != &collider)
+    {
+        return;
+    }
+
+    SColliderRecord2D&           record = Colliders[COLLIDER_ID];
+    const SRigidBodyComponent2D* body = RigidBodies.Get(record.BodyIndex);
+    if (body == nullptr)
+    {
+        return;
+    }
+
+    // 换了形状的记录不能再从快照中恢复旧形状
+    if (record.Shape != collider.GetShape())
+    {
+        record.Shape = collider.GetShape();
+        ++StructureVersion;
+    }
+
+    record.ShapeType = record.Shape->GetShapeType();
+    record.CollisionLayers = collider.GetCollisionLayers();
+    record.LocalPose = collider.GetLocalPose();
+    record.Pose = SPose2D(body->Position, body->Rotation) * record.LocalPose;
+    record.AABB = record.Shape->ComputeAABB(record.Pose);
+    BroadPhase->MoveProxy(record.ProxyId, record.AABB, SVector2F(0.0F));
+}
+
+void CPhysicsWorld2D::LoadScene(const CSceneView2D& scene, std::vector<SBodyId2D>& outBodies)
+{
+    SSceneBatch2D batch;
+    PrepareSceneBatch(scene, batch);
+
+    std::vector<uint32_t> colliders;
+    MergeSceneBatch(batch, outBodies, colliders);
+
+    SceneShapes.push_back(std::move(batch.Shapes));
+}
+
+void CPhysicsWorld2D::WriteScene(std::vector<std::byte>& outBytes) const
+{
+    // 刚体槽位 -> 场景中的序号
+    std::vector<uint32_t>     bodyIndices(BodyGenerations.size(), 0);
+    std::vector<SSceneBody2D> bodies;
+    bodies.reserve(RigidBodies.Size());
+
+    for (size_t slot = 0; slot < BodyGenerations.size(); ++slot)
+    {
+        const SRigidBodyComponent2D* body = RigidBodies.Get(static_cast<BodyIndexType>(slot));
+        if (body == nullptr)
+        {
+            continue;
+        }
+
+        bodyIndices[slot] = static_cast<uint32_t>(bodies.size());
+
+        SSceneBody2D& sceneBody = bodies.emplace_back();
+        sceneBody.PositionX = body->Position.X;
+        sceneBody.PositionY = body->Position.Y;
+        sceneBody.Rotation = body->Rotation;
+        sceneBody.VelocityX = body->Velocity.X;
+        sceneBody.VelocityY = body->Velocity.Y;
+        sceneBody.AngularVelocity = body->AngularVelocity;
+        sceneBody.LinearDamping = body->LinearDamping;
+        sceneBody.AngularDamping = body->AngularDamping;
+        sceneBody.GravityScale = body->GravityScale;
+        sceneBody.Mass = body->Mass;
+        sceneBody.Inertia = body->Inertia;
+        sceneBody.Type = static_cast<uint8_t>(body->Type);
+        sceneBody.IsBullet = body->IsBullet ? 1 : 0;
+        sceneBody.ForceGroups = body->ForceGroups;
+    }
+
+    // 树按场景中的顺序插入，与加载时逐个插入得到的树相同
+    CDynamicAABBTree2D            tree;
+    std::vector<SSceneCollider2D> colliders;
+    colliders.reserve(Colliders.size());
+
+    for (const SColliderRecord2D& record : Colliders)
+    {
+        if (record.Shape == nullptr)
+        {
+            continue;
+        }
+
+        SSceneCollider2D& sceneCollider = colliders.emplace_back();
+        sceneCollider.BodyIndex = bodyIndices[record.BodyIndex];
+        sceneCollider.CollisionLayers = record.CollisionLayers;
+        sceneCollider.ProxyId = tree.CreateProxy(record.AABB, static_cast<uint32_t>(colliders.size() - 1));
+        sceneCollider.LocalPositionX = record.LocalPose.Position.X;
+        sceneCollider.LocalPositionY = record.LocalPose.Position.Y;
+        sceneCollider.LocalCos = record.LocalPose.Cos;
+        sceneCollider.LocalSin = record.LocalPose.Sin;
+        EncodeSceneShape(*record.Shape, sceneCollider);
+    }
+
+    std::vector<SSceneTreeNode2D> treeNodes(tree.GetNodes().size());
+    for (size_t index = 0; index < treeNodes.size(); ++index)
+    {
+        const STreeNode2D& node = tree.GetNodes()[index];
+
+        SSceneTreeNode2D& sceneNode = treeNodes[index];
+        sceneNode.MinX = node.AABB.GetMin().X;
+        sceneNode.MinY = node.AABB.GetMin().Y;
+        sceneNode.MaxX = node.AABB.GetMax().X;
+        sceneNode.MaxY = node.AABB.GetMax().Y;
+        sceneNode.UserData = node.UserData;
+        sceneNode.Parent = node.Parent;
+        sceneNode.Child1 = node.Child1;
+        sceneNode.Child2 = node.Child2;
+        sceneNode.Height = node.Height;
+    }
+
+    SerializeScene(bodies, colliders, treeNodes, tree.GetRoot(), outBytes);
+}
+
+uint32_t CPhysicsWorld2D::AddRegion(const std::filesystem::path& scenePath, const CBoundingAABB2D& bounds)
+{
+    if (RegionStreamer == nullptr)
+    {
+        RegionStreamer = std::make_unique<CRegionStreamer2D>();
+    }
+
+    SStreamingRegion2D& region = Regions.emplace_back();
+    region.Path = scenePath;
+    region.Bounds = bounds;
+
+    return static_cast<uint32_t>(Regions.size() - 1);
+}
+
+void CPhysicsWorld2D::LoadRegion(uint32_t regionId)
+{
+    SStreamingRegion2D& region = Regions[regionId];
+    region.IsWanted = true;
+
+    if (region.State == ERegionState2D::Unloaded || region.State == ERegionState2D::Failed)
+    {
+        region.State = ERegionState2D::Loading;
+        RegionStreamer->RequestLoad(regionId, region.Path);
+    }
+}
+
+void CPhysicsWorld2D::UnloadRegion(uint32_t regionId)
+{
+    SStreamingRegion2D& region = Regions[regionId];
+    region.IsWanted = false;
+
+    if (region.State == ERegionState2D::Resident)
+    {
+        ReleaseRegion(region);
+    }
+}
+
+void CPhysicsWorld2D::SetStreamingFocus(const SVector2F& focus, float loadRadius, float unloadRadius)
+{
+    assert(loadRadius <= unloadRadius);
+
+    for (uint32_t regionId = 0; regionId < Regions.size(); ++regionId)
+    {
+        const SStreamingRegion2D& region = Regions[regionId];
+
+        // 焦点到区域包围盒的距离，焦点在区域内时为0
+        const SVector2F& MIN = region.Bounds.GetMin();
+        const SVector2F& MAX = region.Bounds.GetMax();
+        const SVector2F  OFFSET(std::max({MIN.X - focus.X, 0.0F, focus.X - MAX.X}),
+                               std::max({MIN.Y - focus.Y, 0.0F, focus.Y - MAX.Y}));
+        const float      DISTANCE_SQUARED = OFFSET | OFFSET;
+
+        if (!region.IsWanted && region.State != ERegionState2D::Failed &&
+            DISTANCE_SQUARED <= loadRadius * loadRadius)
+        {
+            LoadRegion(regionId);
+        }
+        else if (region.IsWanted && DISTANCE_SQUARED > unloadRadius * unloadRadius)
+        {
+            UnloadRegion(regionId);
+        }
+    }
+}
+
+void CPhysicsWorld2D::FlushRegions()
+{
+    if (RegionStreamer != nullptr)
+    {
+        RegionStreamer->WaitIdle();
+        UpdateRegions();
+    }
+}
+
+ERegionState2D CPhysicsWorld2D::GetRegionState(uint32_t regionId) const
+{
+    return Regions[regionId].State;
+}
+
+std::span<const SBodyId2D> CPhysicsWorld2D::GetRegionBodies(uint32_t regionId) const
+{
+    return Regions[regionId].Bodies;
+}
+
+std::span<const SColliderRecord2D> CPhysicsWorld2D::GetColliders() const
+{
+    return Colliders;
+}
+
+std::span<const SBroadPhasePair2D> CPhysicsWorld2D::GetCandidatePairs() const
+{
+    return CandidatePairs;
+}
+
+std::span<const SContactManifold2D> CPhysicsWorld2D::GetContactManifolds() const
+{
+    return ContactManifolds;
+}
+
+const IBroadPhase2D& CPhysicsWorld2D::GetBroadPhase() const
+{
+    return *BroadPhase;
+}
+
+void CPhysicsWorld2D::RayCastClosest(std::span<const CLine2D> rays, std::span<SRayCastHit2D> outHits,
+                                     uint32_t layerMask) const
+{
+    assert(outHits.size() >= rays.size());
+
+    const auto RAY_COUNT = static_cast<uint32_t>(rays.size());
+    const auto PACKET_COUNT = (RAY_COUNT + RAY_PACKET_SIZE_2D - 1) / RAY_PACKET_SIZE_2D;
+
+    BE::Core::CJobSystem::Get().ParallelFor(
+        PACKET_COUNT, RAY_PACKETS_PER_JOB_2D,
+        [&](uint32_t beginPacket, uint32_t endPacket)
+        {
+            for (uint32_t packetIndex = beginPacket; packetIndex < endPacket; ++packetIndex)
+            {
+                const uint32_t FIRST_RAY = packetIndex * RAY_PACKET_SIZE_2D;
+                const uint32_t LANE_COUNT = std::min(RAY_PACKET_SIZE_2D, RAY_COUNT - FIRST_RAY);
+
+                SRayPacket2D                                    packet;
+                std::array<SRayCastInput2D, RAY_PACKET_SIZE_2D> inputs{};
+
+                for (uint32_t lane = 0; lane < LANE_COUNT; ++lane)
+                {
+                    const CLine2D& ray = rays[FIRST_RAY + lane];
+
+                    inputs[lane].Origin = ray.GetStart().ToVector2F();
+                    inputs[lane].Translation = ray.GetDiagonal();
+                    packet.SetRay(lane, inputs[lane].Origin, inputs[lane].Translation);
+
+                    outHits[FIRST_RAY + lane] = SRayCastHit2D();
+                }
+
+                CClosestRayCastCallback2D callback(Colliders, std::span(inputs.data(), LANE_COUNT),
+                                                   outHits.subspan(FIRST_RAY, LANE_COUNT), layerMask);
+                BroadPhase->RayCast(packet, callback);
+            }
+        });
+}
+
+uint32_t CPhysicsWorld2D::OverlapCircle(const SVector2F& center, float radius, std::span<uint32_t> outColliders,
+                                        uint32_t layerMask) const
+{
+    if (outColliders.empty())
+    {
+        return 0;
+    }
+
+    SDistanceProxy2D proxy;
+    proxy.Vertices[0] = center;
+    proxy.Count = 1;
+    proxy.Radius = radius;
+
+    const CBoundingAABB2D BOUNDS(center - SVector2F(radius), center + SVector2F(radius));
+
+    COverlapQueryCallback2D callback(Colliders, proxy, BOUNDS, layerMask, outColliders);
+    BroadPhase->Query(BOUNDS, callback);
+
+    return callback.GetCount();
+}
+
+uint32_t CPhysicsWorld2D::OverlapBox(const SVector2F& center, const SVector2F& halfExtents, float rotation,
+                                     std::span<uint32_t> outColliders, uint32_t layerMask) const
+{
+    if (outColliders.empty())
+    {
+        return 0;
+    }
+
+    const SPose2D   POSE(center, rotation);
+    const SVector2F EXTENT_X = POSE.Rotate(SVector2F(halfExtents.X, 0.0F));
+    const SVector2F EXTENT_Y = POSE.Rotate(SVector2F(0.0F, halfExtents.Y));
+
+    SDistanceProxy2D proxy;
+    proxy.Vertices[0] = center - EXTENT_X - EXTENT_Y;
+    proxy.Vertices[1] = center + EXTENT_X - EXTENT_Y;
+    proxy.Vertices[2] = center + EXTENT_X + EXTENT_Y;
+    proxy.Vertices[3] = center - EXTENT_X + EXTENT_Y;
+    proxy.Count = 4;
+
+    // 旋转后的半尺寸
+    const SVector2F BOUNDS_EXTENT(std::abs(EXTENT_X.X) + std::abs(EXTENT_Y.X),
+                                  std::abs(EXTENT_X.Y) + std::abs(EXTENT_Y.Y));
+    const CBoundingAABB2D BOUNDS(center - BOUNDS_EXTENT, center + BOUNDS_EXTENT);
+
+    COverlapQueryCallback2D callback(Colliders, proxy, BOUNDS, layerMask, outColliders);
+    BroadPhase->Query(BOUNDS, callback);
+
+    return callback.GetCount();
+}
+
+uint32_t CPhysicsWorld2D::ShapeCast(const CPrimitiveShape2D& shape, const SPose2D& pose, const SVector2F& translation,
+                                    std::span<SShapeCastHit2D> outHits, uint32_t layerMask) const
+{
+    if (outHits.empty())
+    {
+        return 0;
+    }
+
+    // 扫掠只有平移：旋转放进形状的局部位姿
+    const SDistanceProxy2D PROXY = MakeDistanceProxy(shape);
+    const SPose2D          LOCAL_POSE(SVector2F(0.0F), pose.Cos, pose.Sin);
+
+    SSweep2D sweep;
+    sweep.Center0 = pose.Position;
+    sweep.Center1 = pose.Position + translation;
+
+    const CBoundingAABB2D START_BOUNDS = shape.ComputeAABB(pose);
+    const CBoundingAABB2D SWEPT_BOUNDS = CBoundingAABB2D::Union(
+        START_BOUNDS, CBoundingAABB2D(START_BOUNDS.GetMin() + translation, START_BOUNDS.GetMax() + translation));
+
+    CShapeCastCallback2D callback(Colliders, PROXY, LOCAL_POSE, sweep, layerMask, outHits);
+    BroadPhase->Query(SWEPT_BOUNDS, callback);
+
+    return callback.GetCount();
+}
+
+const CIslandBuilder2D& CPhysicsWorld2D::GetIslands() const
+{
+    return Islands;
+}
+
+const CIslandSolver2D& CPhysicsWorld2D::GetIslandSolver() const
+{
+    return IslandSolver;
+}
+
+void CPhysicsWorld2D::SetSettings(const SPhysicsWorldSettings2D& settings)
+{
+    const bool BROAD_PHASE_CHANGED =
+        settings.BroadPhaseType != Settings.BroadPhaseType || settings.GridCellSize != Settings.GridCellSize;
+
+    Settings = settings;
+
+    if (!Settings.EnableSleeping)
+    {
+        for (auto& body : RigidBodies.GetComponents())
+        {
+            WakeBody(body);
+        }
+    }
+
+    if (BROAD_PHASE_CHANGED)
+    {
+        RebuildBroadPhase();
+    }
+}
+
+const SPhysicsWorldSettings2D& CPhysicsWorld2D::GetSettings() const
+{
+    return Settings;
+}
+
+const SPhysicsStepStats2D& CPhysicsWorld2D::GetStepStats() const
+{
+    return StepStats;
+}
+
+uint64_t CPhysicsWorld2D::GetStepIndex() const
+{
+    return StepIndex;
+}
+
+uint64_t CPhysicsWorld2D::GetStateHash() const
+{
+    return StateHash;
+}
+
+void CPhysicsWorld2D::ReserveSnapshots(uint32_t count)
+{
+    assert(count > 0);
+
+    Snapshots.clear();
+    Snapshots.resize(count);
+    NextSnapshot = 0;
+
+    for (auto& snapshot : Snapshots)
+    {
+        snapshot.Bodies.reserve(RigidBodies.Size());
+        snapshot.Colliders.reserve(Colliders.size());
+        snapshot.ContactManifolds.reserve(ContactManifolds.capacity());
+        snapshot.BroadPhaseType = Settings.BroadPhaseType;
+        snapshot.BroadPhase = BroadPhase->Clone();
+    }
+}
+
+uint64_t CPhysicsWorld2D::SaveSnapshot()
+{
+    if (Snapshots.empty())
+    {
+        ReserveSnapshots(DEFAULT_SNAPSHOT_COUNT_2D);
+    }
+
+    SWorldSnapshot2D& snapshot = Snapshots[NextSnapshot];
+    NextSnapshot = (NextSnapshot + 1) % static_cast<uint32_t>(Snapshots.size());
+
+    snapshot.StepIndex = StepIndex;
+    snapshot.StructureVersion = StructureVersion;
+    snapshot.StateHash = StateHash;
+    snapshot.Accumulator = Accumulator;
+
+    const auto BODIES = RigidBodies.GetComponents();
+    snapshot.Bodies.resize(BODIES.size());
+    for (size_t index = 0; index < BODIES.size(); ++index)
+    {
+        SaveRigidBodyState(BODIES[index], snapshot.Bodies[index]);
+    }
+
+    CopyArray(Colliders, snapshot.Colliders);
+
+    // 宽相位类型改变后重新复制一份，否则原地覆盖
+    if (snapshot.BroadPhase == nullptr || snapshot.BroadPhaseType != Settings.BroadPhaseType)
+    {
+        snapshot.BroadPhaseType = Settings.BroadPhaseType;
+        snapshot.BroadPhase = BroadPhase->Clone();
+    }
+    else
+    {
+        snapshot.BroadPhase->CopyFrom(*BroadPhase);
+    }
+
+    CopyArray(ContactManifolds, snapshot.ContactManifolds);
+    snapshot.ContactCache.CopyFrom(ContactCache);
+
+    // 数组按元素赋值，保留缓冲的容量
+    snapshot.Joints = Joints;
+
+    return StepIndex;
+}
+
+bool CPhysicsWorld2D::RestoreSnapshot(uint64_t stepIndex)
+{
+    const auto SNAPSHOT_COUNT = static_cast<uint32_t>(Snapshots.size());
+
+    // 从最新的快照往回找，同一步保存多次时取最后一次
+    uint32_t found = SNAPSHOT_COUNT;
+    for (uint32_t age = 1; age <= SNAPSHOT_COUNT; ++age)
+    {
+        const uint32_t INDEX = (NextSnapshot + SNAPSHOT_COUNT - age) % SNAPSHOT_COUNT;
+        if (Snapshots[INDEX].StepIndex == stepIndex)
+        {
+            found = INDEX;
+            break;
+        }
+    }
+
+    if (found == SNAPSHOT_COUNT)
+    {
+        return false;
+    }
+
+    const SWorldSnapshot2D& snapshot = Snapshots[found];
+
+    // 回滚不重建对象：保存之后创建或销毁过刚体、碰撞体的快照无法恢复
+    if (snapshot.StructureVersion != StructureVersion || snapshot.BroadPhaseType != Settings.BroadPhaseType)
+    {
+        return false;
+    }
+
+    const auto BODIES = RigidBodies.GetComponents();
+    for (size_t index = 0; index < BODIES.size(); ++index)
+    {
+        RestoreRigidBodyState(snapshot.Bodies[index], BODIES[index]);
+    }
+
+    Colliders = snapshot.Colliders;
+    BroadPhase->CopyFrom(*snapshot.BroadPhase);
+    CopyArray(snapshot.ContactManifolds, ContactManifolds);
+    ContactCache.CopyFrom(snapshot.ContactCache);
+
+    Joints = snapshot.Joints;
+    RebuildJointFilter();
+
+    StepIndex = snapshot.StepIndex;
+    StateHash = snapshot.StateHash;
+    Accumulator = snapshot.Accumulator;
+
+    // 更晚的快照属于被回滚掉的时间线
+    for (auto& other : Snapshots)
+    {
+        if (other.StepIndex != INVALID_SNAPSHOT_STEP_2D && other.StepIndex > stepIndex)
+        {
+            other.StepIndex = INVALID_SNAPSHOT_STEP_2D;
+        }
+    }
+
+    NextSnapshot = (found + 1) % SNAPSHOT_COUNT;
+
+    return true;
+}
+
+float CPhysicsWorld2D::GetInterpolationAlpha() const
+{
+    return Settings.FixedTimeStep > 0.0F ? Accumulator / Settings.FixedTimeStep : 0.0F;
+}
+
+void CPhysicsWorld2D::RebuildBroadPhase()
+{
+    BroadPhase = CreateBroadPhase(Settings);
+    CandidatePairs.clear();
+    ContactManifolds.clear();
+
+    for (uint32_t colliderId = 0; colliderId < static_cast<uint32_t>(Colliders.size()); ++colliderId)
+    {
+        SColliderRecord2D& record = Colliders[colliderId];
+        if (record.Shape == nullptr)
+        {
+            continue;
+        }
+
+        const SRigidBodyComponent2D* body = RigidBodies.Get(record.BodyIndex);
+        const bool IS_DYNAMIC = body != nullptr && body->Type == PHYE::PhysicsBase::ERigidBodyType::Dynamic;
+
+        record.ProxyId = BroadPhase->CreateProxy(record.AABB, colliderId, IS_DYNAMIC);
+    }
+
+    // 代理 id 已重新分配
+    ++StructureVersion;
+}
+
+void CPhysicsWorld2D::SubStep(float timeStep)
+{
+    auto& stageTimes = StepStats.StageTimes;
+
+    {
+        SScopedStageTimer timer(stageTimes[static_cast<size_t>(EPhysicsStage2D::IntegrateForces)]);
+        IntegrateForces(timeStep);
+    }
+
+    {
+        SScopedStageTimer timer(stageTimes[static_cast<size_t>(EPhysicsStage2D::BroadPhase)]);
+        UpdateBroadPhase(timeStep);
+    }
+
+    {
+        SScopedStageTimer timer(stageTimes[static_cast<size_t>(EPhysicsStage2D::NarrowPhase)]);
+        UpdateNarrowPhase();
+    }
+
+    {
+        SScopedStageTimer timer(stageTimes[static_cast<size_t>(EPhysicsStage2D::Solve)]);
+        SolveConstraints(timeStep);
+    }
+
+    {
+        SScopedStageTimer timer(stageTimes[static_cast<size_t>(EPhysicsStage2D::IntegratePositions)]);
+        IntegratePositions(timeStep);
+    }
+
+    if (Settings.EnableContinuous)
+    {
+        SScopedStageTimer timer(stageTimes[static_cast<size_t>(EPhysicsStage2D::Continuous)]);
+        SolveContinuous(timeStep);
+    }
+}
+
+void CPhysicsWorld2D::IntegrateForces(float timeStep)
+{
+    Integrator.IntegrateVelocities(timeStep);
+}
+
+void CPhysicsWorld2D::UpdateBroadPhase(float timeStep)
+{
+    // 1. 更新活动刚体上碰撞体的包围盒，静态碰撞体只在 RefreshCollider() 时更新，休眠刚体不会移动
+    for (auto& record : Colliders)
+    {
+        if (record.Shape == nullptr)
+        {
+            continue;
+        }
+
+        const SRigidBodyComponent2D* body = RigidBodies.Get(record.BodyIndex);
+        if (!IsBodyActive(body))
+        {
+            continue;
+        }
+
+        record.Pose = SPose2D(body->Position, body->Rotation) * record.LocalPose;
+        record.AABB = record.Shape->ComputeAABB(record.Pose);
+        BroadPhase->MoveProxy(record.ProxyId, record.AABB, body->Velocity * timeStep);
+    }
+
+    // 2. 收集候选对，并剔除同一刚体上的碰撞体组成的对
+    BroadPhase->UpdatePairs(CandidatePairs);
+
+    std::erase_if(CandidatePairs,
+                  [this](const SBroadPhasePair2D& pair)
+                  {
+                      const BodyIndexType BODY_A = Colliders[pair.ColliderA].BodyIndex;
+                      const BodyIndexType BODY_B = Colliders[pair.ColliderB].BodyIndex;
+
+                      // 关节连接的刚体默认不互相碰撞
+                      return BODY_A == BODY_B ||
+                             (!JointFilterPairs.empty() && std::binary_search(JointFilterPairs.begin(),
+                                                                               JointFilterPairs.end(),
+                                                                               GetBodyPairKey(BODY_A, BODY_B)));
+                  });
+}
+
+void CPhysicsWorld2D::UpdateNarrowPhase()
+{
+    const auto IS_COLLIDER_ACTIVE = [this](uint32_t colliderId)
+    { return IsBodyActive(RigidBodies.Get(Colliders[colliderId].BodyIndex)); };
+
+    // 两侧刚体都不活动(静态或休眠)的候选对不重新计算，移到末尾
+    const auto INACTIVE_BEGIN =
+        std::partition(CandidatePairs.begin(), CandidatePairs.end(), [&](const SBroadPhasePair2D& pair)
+                       { return IS_COLLIDER_ACTIVE(pair.ColliderA) || IS_COLLIDER_ACTIVE(pair.ColliderB); });
+
+    const auto ACTIVE_COUNT = static_cast<size_t>(INACTIVE_BEGIN - CandidatePairs.begin());
+    NarrowPhase.Collide(std::span<const SBroadPhasePair2D>(CandidatePairs).first(ACTIVE_COUNT), Colliders, ContactCache,
+                        ContactManifolds);
+
+    // 休眠刚体之间的流形从缓存中原样保留：它们把休眠的岛屿连在一起，唤醒时也作为热启动的冲量
+    for (auto pair = INACTIVE_BEGIN; pair != CandidatePairs.end(); ++pair)
+    {
+        // 流形中碰撞体的顺序由形状类型决定，两种顺序都需要查找
+        const SContactManifold2D* previous = ContactCache.Find(pair->ColliderA, pair->ColliderB);
+        if (previous == nullptr)
+        {
+            previous = ContactCache.Find(pair->ColliderB, pair->ColliderA);
+        }
+
+        if (previous != nullptr)
+        {
+            ContactManifolds.push_back(*previous);
+        }
+    }
+
+    // 流形按形状类型分组、休眠的流形排在末尾，确定性模式下改为只按碰撞体ID排序，
+    // 着色与求解顺序因此与宽相位的内部结构和休眠历史无关
+    if (Settings.EnableDeterminism)
+    {
+        std::sort(ContactManifolds.begin(), ContactManifolds.end(),
+                  [](const SContactManifold2D& lhs, const SContactManifold2D& rhs)
+                  { return GetManifoldKey(lhs) < GetManifoldKey(rhs); });
+    }
+}
+
+void CPhysicsWorld2D::SolveConstraints(float timeStep)
+{
+    UpdateIslands();
+
+    LoadSolverBodies2D(RigidBodies.GetComponents(), SolverBodies);
+
+    // 只求解活动岛屿的流形，休眠岛屿的流形保持不变
+    const SIslandSolverSettings2D SOLVER_SETTINGS{timeStep, Settings.VelocityIterations, Settings.Friction,
+                                                  Settings.Restitution};
+
+    IslandSolver.Solve(Islands, ContactManifolds, Joints, Colliders, RigidBodies, SolverBodies, SOLVER_SETTINGS,
+                       Settings.EnableParallelSolve ? &BE::Core::CJobSystem::Get() : nullptr);
+
+    StoreSolverBodies2D(SolverBodies, RigidBodies.GetComponents());
+
+    // 记录求解后的冲量，供下一步热启动
+    if (Settings.EnableWarmStarting)
+    {
+        ContactCache.Store(ContactManifolds);
+    }
+    else
+    {
+        ContactCache.Clear();
+        Joints.ResetImpulses();
+    }
+
+    UpdateSleep(timeStep);
+}
+
+void CPhysicsWorld2D::IntegratePositions(float timeStep)
+{
+    Integrator.IntegratePositions(timeStep);
+}
+
+void CPhysicsWorld2D::SolveContinuous(float timeStep)
+{
+    // 1. 收集活动子弹刚体的碰撞体，同一刚体的碰撞体相邻
+    BulletColliders.clear();
+    for (uint32_t colliderId = 0; colliderId < static_cast<uint32_t>(Colliders.size()); ++colliderId)
+    {
+        const SColliderRecord2D& record = Colliders[colliderId];
+        if (record.Shape != nullptr && IsBodyBullet(RigidBodies.Get(record.BodyIndex)))
+        {
+            BulletColliders.push_back(colliderId);
+        }
+    }
+
+    std::stable_sort(BulletColliders.begin(), BulletColliders.end(), [this](uint32_t colliderA, uint32_t colliderB)
+                     { return Colliders[colliderA].BodyIndex < Colliders[colliderB].BodyIndex; });
+
+    // 2. 逐个子弹刚体沿轨迹前进
+    const std::span<const uint32_t> BULLET_COLLIDERS(BulletColliders);
+    for (size_t begin = 0; begin < BULLET_COLLIDERS.size();)
+    {
+        size_t end = begin + 1;
+        while (end < BULLET_COLLIDERS.size() &&
+               Colliders[BULLET_COLLIDERS[end]].BodyIndex == Colliders[BULLET_COLLIDERS[begin]].BodyIndex)
+        {
+            ++end;
+        }
+
+        AdvanceBullet(BULLET_COLLIDERS.subspan(begin, end - begin), timeStep);
+        begin = end;
+    }
+}
+
+void CPhysicsWorld2D::AdvanceBullet(std::span<const uint32_t> colliders, float timeStep)
+{
+    SRigidBodyComponent2D& body = *RigidBodies.Get(Colliders[colliders.front()].BodyIndex);
+
+    // 位置积分已经完成，由速度反推子步开始时的位姿
+    SSweep2D sweep;
+    sweep.Center1 = body.Position;
+    sweep.Angle1 = body.Rotation;
+    sweep.Center0 = body.Position - (body.Velocity * timeStep);
+    sweep.Angle0 = body.Rotation - (body.AngularVelocity * timeStep);
+
+    float remainingTime = timeStep;
+
+    for (uint32_t impact = 0; impact < Settings.MaxContinuousImpacts; ++impact)
+    {
+        SContinuousHit2D hit;
+
+        for (const uint32_t COLLIDER_ID : colliders)
+        {
+            const SColliderRecord2D& record = Colliders[COLLIDER_ID];
+            const SPose2D&           LOCAL_POSE = record.LocalPose;
+            const SDistanceProxy2D   PROXY = MakeDistanceProxy(*record.Shape);
+
+            const CBoundingAABB2D SWEPT_AABB = CBoundingAABB2D::Union(
+                record.Shape->ComputeAABB(sweep.GetPose(0.0F) * LOCAL_POSE),
+                record.Shape->ComputeAABB(sweep.GetPose(hit.Time) * LOCAL_POSE));
+
+            ContinuousCandidates.clear();
+            BroadPhase->Query(SWEPT_AABB, ContinuousCandidates);
+
+            for (const uint32_t OTHER_ID : ContinuousCandidates)
+            {
+                const SColliderRecord2D&     otherRecord = Colliders[OTHER_ID];
+                const SRigidBodyComponent2D* otherBody = RigidBodies.Get(otherRecord.BodyIndex);
+
+                // 子弹之间不做连续检测，高速物体互相穿过的情况交给离散检测
+                if (otherRecord.BodyIndex == record.BodyIndex || otherBody == nullptr || IsBodyBullet(otherBody))
+                {
+                    continue;
+                }
+
+                // 其它刚体停在子步结束时的位姿
+                SSweep2D otherSweep;
+                otherSweep.Center0 = otherBody->Position;
+                otherSweep.Center1 = otherBody->Position;
+                otherSweep.Angle0 = otherBody->Rotation;
+                otherSweep.Angle1 = otherBody->Rotation;
+
+                // 起点已经接触的碰撞体对由离散接触(含预测接触)处理
+                const STOIOutput2D TOI =
+                    ComputeTimeOfImpact(PROXY, LOCAL_POSE, sweep, MakeDistanceProxy(*otherRecord.Shape),
+                                        otherRecord.LocalPose, otherSweep);
+
+                // 同时碰撞时取ID较小的碰撞体，结果与宽相位返回候选的顺序无关
+                const bool IS_EARLIER =
+                    TOI.Time < hit.Time || (TOI.Time == hit.Time && OTHER_ID < hit.Collider);
+
+                if (TOI.State == ETOIState2D::Hit && IS_EARLIER)
+                {
+                    hit.Time = TOI.Time;
+                    hit.Collider = OTHER_ID;
+                    hit.Normal = TOI.Normal;
+                    hit.Point = TOI.Point;
+                }
+            }
+        }
+
+        if (hit.Collider == INVALID_COLLIDER_ID)
+        {
+            body.Position = sweep.Center1;
+            body.Rotation = sweep.Angle1;
+            return;
+        }
+
+        // 停在碰撞时刻，在这一对碰撞体之间施加接触冲量后，用新速度扫掠子步的剩余时间
+        body.Position = sweep.Center0 + ((sweep.Center1 - sweep.Center0) * hit.Time);
+        body.Rotation = sweep.Angle0 + ((sweep.Angle1 - sweep.Angle0) * hit.Time);
+
+        SRigidBodyComponent2D& other = *RigidBodies.Get(Colliders[hit.Collider].BodyIndex);
+        ApplyImpactImpulse(body, other, hit.Normal, hit.Point, Settings.Friction, Settings.Restitution);
+
+        if (other.Type == PHYE::PhysicsBase::ERigidBodyType::Dynamic)
+        {
+            WakeBody(other);
+        }
+
+        remainingTime *= 1.0F - hit.Time;
+
+        sweep.Center0 = body.Position;
+        sweep.Angle0 = body.Rotation;
+        sweep.Center1 = body.Position + (body.Velocity * remainingTime);
+        sweep.Angle1 = body.Rotation + (body.AngularVelocity * remainingTime);
+    }
+
+    // 碰撞次数用尽：停在最后一次碰撞的位置，剩余的运动交给下一步的离散接触
+}
+
+void CPhysicsWorld2D::UpdateIslands()
+{
+    const auto BODIES = RigidBodies.GetComponents();
+
+    const auto TO_ISLAND_BODY = [&](const SRigidBodyComponent2D* body)
+    {
+        return body != nullptr && body->Type == PHYE::PhysicsBase::ERigidBodyType::Dynamic
+                   ? static_cast<uint32_t>(body - BODIES.data())
+                   : STATIC_SOLVER_BODY_2D;
+    };
+
+    // 1. 收集流形与关节连接的刚体；活动刚体(包括运动学刚体)接触到的休眠刚体直接唤醒
+    const size_t MANIFOLD_COUNT = ContactManifolds.size();
+    ConstraintBodies.resize(MANIFOLD_COUNT + Joints.Size());
+
+    for (size_t index = 0; index < ConstraintBodies.size(); ++index)
+    {
+        SRigidBodyComponent2D* bodyA = nullptr;
+        SRigidBodyComponent2D* bodyB = nullptr;
+
+        if (index < MANIFOLD_COUNT)
+        {
+            bodyA = RigidBodies.Get(Colliders[ContactManifolds[index].ColliderA].BodyIndex);
+            bodyB = RigidBodies.Get(Colliders[ContactManifolds[index].ColliderB].BodyIndex);
+        }
+        else
+        {
+            // 按 id 解析(检查世代号)：任一刚体已不存在的关节不再连接任何刚体，也就不会被求解
+            bodyA = GetRigidBody(Joints.GetBodiesA()[index - MANIFOLD_COUNT]);
+            bodyB = GetRigidBody(Joints.GetBodiesB()[index - MANIFOLD_COUNT]);
+            if (bodyA == nullptr || bodyB == nullptr)
+            {
+                ConstraintBodies[index] = {STATIC_SOLVER_BODY_2D, STATIC_SOLVER_BODY_2D};
+                continue;
+            }
+        }
+
+        if (IsBodySleeping(bodyA) && IsBodyActive(bodyB))
+        {
+            WakeBody(*bodyA);
+        }
+        else if (IsBodySleeping(bodyB) && IsBodyActive(bodyA))
+        {
+            WakeBody(*bodyB);
+        }
+
+        ConstraintBodies[index] = {TO_ISLAND_BODY(bodyA), TO_ISLAND_BODY(bodyB)};
+    }
+
+    Islands.Build(ConstraintBodies, BODIES);
+
+    // 2. 岛屿中只要有一个活动刚体，整个岛屿都被唤醒
+    for (size_t island = 0; island < Islands.GetIslandCount(); ++island)
+    {
+        const auto ISLAND_BODIES = Islands.GetIslandBodies(island);
+
+        const bool IS_AWAKE = std::any_of(ISLAND_BODIES.begin(), ISLAND_BODIES.end(),
+                                          [&](uint32_t body) { return BODIES[body].IsAwake; });
+        if (!IS_AWAKE)
+        {
+            continue;
+        }
+
+        for (const uint32_t BODY : ISLAND_BODIES)
+        {
+            WakeBody(BODIES[BODY]);
+        }
+    }
+}
+
+void CPhysicsWorld2D::LinkJointBodies(const SBodyId2D& bodyA, const SBodyId2D& bodyB, bool collideConnected)
+{
+    assert(GetRigidBody(bodyA) != nullptr && GetRigidBody(bodyB) != nullptr && "Joint bodies must exist");
+    assert(!(bodyA == bodyB) && "A joint needs two different bodies");
+
+    WakeRigidBody(bodyA);
+    WakeRigidBody(bodyB);
+
+    if (!collideConnected)
+    {
+        const uint64_t KEY = GetBodyPairKey(bodyA.Index, bodyB.Index);
+        JointFilterPairs.insert(std::upper_bound(JointFilterPairs.begin(), JointFilterPairs.end(), KEY), KEY);
+    }
+}
+
+void CPhysicsWorld2D::RebuildJointFilter()
+{
+    JointFilterPairs.clear();
+
+    const auto BODIES_A = Joints.GetBodiesA();
+    const auto BODIES_B = Joints.GetBodiesB();
+    const auto COLLIDE_CONNECTED = Joints.GetCollideConnected();
+
+    for (uint32_t index = 0; index < Joints.Size(); ++index)
+    {
+        if (COLLIDE_CONNECTED[index] == 0)
+        {
+            JointFilterPairs.push_back(GetBodyPairKey(BODIES_A[index].Index, BODIES_B[index].Index));
+        }
+    }
+
+    std::sort(JointFilterPairs.begin(), JointFilterPairs.end());
+}
+
+void CPhysicsWorld2D::DestroyBodyJoints(std::span<const BodyIndexType> sortedBodyIndices)
+{
+    // 从后往前遍历：删除时移入当前位置的是已经检查过的末尾关节
+    for (uint32_t index = Joints.Size(); index-- > 0;)
+    {
+        if (std::binary_search(sortedBodyIndices.begin(), sortedBodyIndices.end(), Joints.GetBodiesA()[index].Index) ||
+            std::binary_search(sortedBodyIndices.begin(), sortedBodyIndices.end(), Joints.GetBodiesB()[index].Index))
+        {
+            DestroyJoint(Joints.GetIds()[index]);
+        }
+    }
+}
+
+void CPhysicsWorld2D::UpdateSleep(float timeStep)
+{
+    if (!Settings.EnableSleeping)
+    {
+        return;
+    }
+
+    const auto  BODIES = RigidBodies.GetComponents();
+    const float LINEAR_TOLERANCE_SQ = Settings.LinearSleepTolerance * Settings.LinearSleepTolerance;
+    const float ANGULAR_TOLERANCE_SQ = Settings.AngularSleepTolerance * Settings.AngularSleepTolerance;
+
+    for (size_t island = 0; island < Islands.GetIslandCount(); ++island)
+    {
+        const auto ISLAND_BODIES = Islands.GetIslandBodies(island);
+        if (!BODIES[ISLAND_BODIES.front()].IsAwake)
+        {
+            continue;
+        }
+
+        // 岛屿的静止时间取决于最晚静止下来的刚体
+        float minSleepTime = std::numeric_limits<float>::max();
+        for (const uint32_t BODY : ISLAND_BODIES)
+        {
+            SRigidBodyComponent2D& body = BODIES[BODY];
+
+            const bool IS_RESTING = (body.Velocity | body.Velocity) <= LINEAR_TOLERANCE_SQ &&
+                                    body.AngularVelocity * body.AngularVelocity <= ANGULAR_TOLERANCE_SQ;
+
+            body.SleepTime = IS_RESTING ? body.SleepTime + timeStep : 0.0F;
+            minSleepTime = std::min(minSleepTime, body.SleepTime);
+        }
+
+        if (minSleepTime < Settings.TimeToSleep)
+        {
+            continue;
+        }
+
+        for (const uint32_t BODY : ISLAND_BODIES)
+        {
+            SRigidBodyComponent2D& body = BODIES[BODY];
+            body.IsAwake = false;
+            body.Velocity = SVector2F(0.0F);
+            body.AngularVelocity = 0.0F;
+        }
+    }
+}
+
+void CPhysicsWorld2D::UpdateStateHash()
+{
+    uint64_t hash = HashWord(StateHash, static_cast<uint32_t>(StepIndex));
+
+    // 按刚体ID而不是紧凑数组的顺序遍历，紧凑顺序取决于删除刚体的历史
+    for (size_t index = 0; index < BodyGenerations.size(); ++index)
+    {
+        const SRigidBodyComponent2D* body = RigidBodies.Get(static_cast<BodyIndexType>(index));
+        if (body == nullptr)
+        {
+            continue;
+        }
+
+        hash = HashWord(hash, static_cast<uint32_t>(index));
+        hash = HashFloat(hash, body->Position.X);
+        hash = HashFloat(hash, body->Position.Y);
+        hash = HashFloat(hash, body->Rotation);
+        hash = HashFloat(hash, body->Velocity.X);
+        hash = HashFloat(hash, body->Velocity.Y);
+        hash = HashFloat(hash, body->AngularVelocity);
+        hash = HashWord(hash, body->IsAwake ? 1U : 0U);
+    }
+
+    StateHash = hash;
+}
+
+void CPhysicsWorld2D::MergeSceneBatch(SSceneBatch2D& batch, std::vector<SBodyId2D>& outBodies,
+                                      std::vector<uint32_t>& outColliders)
+{
+    const std::span<const SSceneBody2D>     SCENE_BODIES = batch.Scene.GetBodies();
+    const std::span<const SSceneCollider2D> SCENE_COLLIDERS = batch.Scene.GetColliders();
+
+    // 1. 刚体，新组件追加在紧凑数组的末尾
+    const size_t FIRST_BODY = outBodies.size();
+    outBodies.reserve(FIRST_BODY + SCENE_BODIES.size());
+    RigidBodies.Reserve(RigidBodies.Size() + SCENE_BODIES.size());
+
+    for (const SSceneBody2D& sceneBody : SCENE_BODIES)
+    {
+        const SBodyId2D BODY = CreateRigidBody(static_cast<PHYE::PhysicsBase::ERigidBodyType>(sceneBody.Type),
+                                               sceneBody.Mass, sceneBody.Inertia);
+
+        SRigidBodyComponent2D& body = *RigidBodies.Get(BODY.Index);
+        body.Position = SVector2F(sceneBody.PositionX, sceneBody.PositionY);
+        body.Rotation = sceneBody.Rotation;
+        body.Velocity = SVector2F(sceneBody.VelocityX, sceneBody.VelocityY);
+        body.AngularVelocity = sceneBody.AngularVelocity;
+        body.LinearDamping = sceneBody.LinearDamping;
+        body.AngularDamping = sceneBody.AngularDamping;
+        body.GravityScale = sceneBody.GravityScale;
+        body.IsBullet = sceneBody.IsBullet != 0;
+        body.ForceGroups = sceneBody.ForceGroups;
+
+        outBodies.push_back(BODY);
+    }
+
+    SyncTransforms2D(RigidBodies.GetComponents().last(SCENE_BODIES.size()));
+
+    // 2. 碰撞体记录，位姿与包围盒已在准备阶段算好
+    const size_t FIRST_COLLIDER = outColliders.size();
+    outColliders.reserve(FIRST_COLLIDER + SCENE_COLLIDERS.size());
+
+    if (SCENE_COLLIDERS.size() > FreeColliderIds.size())
+    {
+        Colliders.reserve(Colliders.size() + SCENE_COLLIDERS.size() - FreeColliderIds.size());
+    }
+
+    for (size_t index = 0; index < SCENE_COLLIDERS.size(); ++index)
+    {
+        uint32_t colliderId = 0;
+        if (FreeColliderIds.empty())
+        {
+            colliderId = static_cast<uint32_t>(Colliders.size());
+            Colliders.emplace_back();
+        }
+        else
+        {
+            colliderId = FreeColliderIds.back();
+            FreeColliderIds.pop_back();
+        }
+
+        SColliderRecord2D& record = Colliders[colliderId];
+        record.Shape = batch.ColliderShapes[index];
+        record.ShapeType = record.Shape->GetShapeType();
+        record.BodyIndex = outBodies[FIRST_BODY + SCENE_COLLIDERS[index].BodyIndex].Index;
+        record.CollisionLayers = SCENE_COLLIDERS[index].CollisionLayers;
+        record.LocalPose = batch.LocalPoses[index];
+        record.Pose = batch.Poses[index];
+        record.AABB = batch.AABBs[index];
+
+        outColliders.push_back(colliderId);
+    }
+
+    // 3. 一次性插入宽相位，AABB 树直接嫁接场景中预先构建的子树
+    const std::span<const uint32_t> COLLIDER_IDS = std::span<const uint32_t>(outColliders).subspan(FIRST_COLLIDER);
+
+    SBroadPhaseBatch2D broadPhaseBatch;
+    broadPhaseBatch.AABBs = batch.AABBs;
+    broadPhaseBatch.ColliderIds = COLLIDER_IDS;
+    broadPhaseBatch.IsDynamic = batch.IsDynamic;
+    broadPhaseBatch.TreeNodes = batch.TreeNodes;
+    broadPhaseBatch.TreeRoot = batch.Scene.GetTreeRoot();
+
+    std::vector<int32_t> proxyIds(COLLIDER_IDS.size());
+    BroadPhase->CreateProxies(broadPhaseBatch, proxyIds);
+
+    for (size_t index = 0; index < COLLIDER_IDS.size(); ++index)
+    {
+        Colliders[COLLIDER_IDS[index]].ProxyId = proxyIds[index];
+    }
+}
+
+void CPhysicsWorld2D::ReleaseCollider(uint32_t colliderId)
+{
+    SColliderRecord2D& record = Colliders[colliderId];
+    BroadPhase->DestroyProxy(record.ProxyId);
+    record = SColliderRecord2D();
+
+    FreeColliderIds.push_back(colliderId);
+    ++StructureVersion;
+}
+
+void CPhysicsWorld2D::UpdateRegions()
+{
+    if (RegionStreamer == nullptr)
+    {
+        return;
+    }
+
+    PreparedRegions.clear();
+    RegionStreamer->TakePrepared(PreparedRegions);
+
+    for (auto& prepared : PreparedRegions)
+    {
+        SStreamingRegion2D& region = Regions[prepared->RegionId];
+        if (!prepared->IsValid)
+        {
+            region.State = ERegionState2D::Failed;
+            region.IsWanted = false;
+            continue;
+        }
+
+        // 加载期间被卸载的区域直接丢弃
+        if (!region.IsWanted)
+        {
+            region.State = ERegionState2D::Unloaded;
+            continue;
+        }
+
+        MergeSceneBatch(prepared->Batch, region.Bodies, region.Colliders);
+        region.Shapes = std::move(prepared->Batch.Shapes);
+        region.State = ERegionState2D::Resident;
+
+        InvalidateSnapshots();
+    }
+
+    PreparedRegions.clear();
+}
+
+void CPhysicsWorld2D::ReleaseRegion(SStreamingRegion2D& region)
+{
+    for (const uint32_t COLLIDER_ID : region.Colliders)
+    {
+        ReleaseCollider(COLLIDER_ID);
+    }
+
+    // 一次遍历唤醒所有与被移除碰撞体接触的刚体
+    for (const auto& manifold : ContactManifolds)
+    {
+        const SColliderRecord2D& recordA = Colliders[manifold.ColliderA];
+        const SColliderRecord2D& recordB = Colliders[manifold.ColliderB];
+        if ((recordA.Shape == nullptr) == (recordB.Shape == nullptr))
+        {
+            continue;
+        }
+
+        const SColliderRecord2D& remaining = recordA.Shape != nullptr ? recordA : recordB;
+        if (SRigidBodyComponent2D* body = RigidBodies.Get(remaining.BodyIndex); body != nullptr)
+        {
+            WakeBody(*body);
+        }
+    }
+
+    // 游戏可能在区域的刚体上创建了关节：一次遍历销毁它们，再销毁刚体
+    RegionBodyIndices.clear();
+    for (const SBodyId2D BODY : region.Bodies)
+    {
+        RegionBodyIndices.push_back(BODY.Index);
+    }
+
+    std::sort(RegionBodyIndices.begin(), RegionBodyIndices.end());
+    DestroyBodyJoints(RegionBodyIndices);
+
+    for (const SBodyId2D BODY : region.Bodies)
+    {
+        RemoveRigidBody(BODY);
+    }
+
+    region.Bodies.clear();
+    region.Colliders.clear();
+    region.Shapes.reset();
+    region.State = ERegionState2D::Unloaded;
+
+    // 快照中的碰撞体记录仍指向刚释放的形状
+    InvalidateSnapshots();
+}
+
+void CPhysicsWorld2D::InvalidateSnapshots()
+{
+    for (auto& snapshot : Snapshots)
+    {
+        snapshot.StepIndex = INVALID_SNAPSHOT_STEP_2D;
+    }
+}
+
+void CPhysicsWorld2D::WakeBody(SRigidBodyComponent2D& body)
+{
+    if (!body.IsAwake)
+    {
+        body.IsAwake = true;
+        body.SleepTime = 0.0F;
+    }
 }
 
-NAMESPACE_END() // namespace PHYE::Physics2D
\ No newline at end of file
+NAMESPACE_END() // namespace PHYE::Physics2D
@@ -0,0 +1,59 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#include <PhysicsWorld2D/WorldSnapshot2D.hpp>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+void SaveRigidBodyState(const SRigidBodyComponent2D& body, SRigidBodyState2D& outState)
+{
+    outState.Type = body.Type;
+    outState.Transform = body.Transform;
+    outState.Position = body.Position;
+    outState.Rotation = body.Rotation;
+    outState.Velocity = body.Velocity;
+    outState.AngularVelocity = body.AngularVelocity;
+    outState.Force = body.Force;
+    outState.Torque = body.Torque;
+    outState.LinearDamping = body.LinearDamping;
+    outState.AngularDamping = body.AngularDamping;
+    outState.GravityScale = body.GravityScale;
+    outState.Mass = body.Mass;
+    outState.InverseMass = body.InverseMass;
+    outState.Inertia = body.Inertia;
+    outState.InverseInertia = body.InverseInertia;
+    outState.IsAwake = body.IsAwake;
+    outState.SleepTime = body.SleepTime;
+    outState.IsBullet = body.IsBullet;
+    outState.ForceGroups = body.ForceGroups;
+}
+
+void RestoreRigidBodyState(const SRigidBodyState2D& state, SRigidBodyComponent2D& outBody)
+{
+    outBody.Type = state.Type;
+    outBody.Transform = state.Transform;
+    outBody.Position = state.Position;
+    outBody.Rotation = state.Rotation;
+    outBody.Velocity = state.Velocity;
+    outBody.AngularVelocity = state.AngularVelocity;
+    outBody.Force = state.Force;
+    outBody.Torque = state.Torque;
+    outBody.LinearDamping = state.LinearDamping;
+    outBody.AngularDamping = state.AngularDamping;
+    outBody.GravityScale = state.GravityScale;
+    outBody.Mass = state.Mass;
+    outBody.InverseMass = state.InverseMass;
+    outBody.Inertia = state.Inertia;
+    outBody.InverseInertia = state.InverseInertia;
+    outBody.IsAwake = state.IsAwake;
+    outBody.SleepTime = state.SleepTime;
+    outBody.IsBullet = state.IsBullet;
+    outBody.ForceGroups = state.ForceGroups;
+}
+
+NAMESPACE_END() // namespace PHYE::Physics2D
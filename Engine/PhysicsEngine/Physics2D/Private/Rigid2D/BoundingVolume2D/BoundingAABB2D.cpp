@@ -6,4 +6,75 @@
  * For more detail, please refer to the LICENSE file in the root directory of this project.
  */
 
-#include <Rigid2D/BoundingVolume2D/BoundingAABB2D.hpp>
\ No newline at end of file
+#include <Rigid2D/BoundingVolume2D/BoundingAABB2D.hpp>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+CBoundingAABB2D::CBoundingAABB2D() : Min(0.0F), Max(0.0F)
+{}
+
+CBoundingAABB2D::CBoundingAABB2D(const SVector2F& min, const SVector2F& max) : Min(min), Max(max)
+{}
+
+CBoundingAABB2D CBoundingAABB2D::FromCenter(const SVector2F& center, const SVector2F& halfExtents)
+{
+    return CBoundingAABB2D(center - halfExtents, center + halfExtents);
+}
+
+SVector2F CBoundingAABB2D::GetCenter() const
+{
+    return (Min + Max) * 0.5F;
+}
+
+SVector2F CBoundingAABB2D::GetHalfExtents() const
+{
+    return (Max - Min) * 0.5F;
+}
+
+float CBoundingAABB2D::Area() const
+{
+    return (Max.X - Min.X) * (Max.Y - Min.Y);
+}
+
+bool CBoundingAABB2D::IsValid() const
+{
+    return Min.X <= Max.X && Min.Y <= Max.Y;
+}
+
+bool CBoundingAABB2D::Contains(const SVector2F& point) const
+{
+    return Min.X <= point.X && point.X <= Max.X && Min.Y <= point.Y && point.Y <= Max.Y;
+}
+
+CBoundingAABB2D CBoundingAABB2D::Fattened(float margin) const
+{
+    const SVector2F MARGIN(margin, margin);
+    return CBoundingAABB2D(Min - MARGIN, Max + MARGIN);
+}
+
+CBoundingAABB2D CBoundingAABB2D::Swept(const SVector2F& displacement) const
+{
+    CBoundingAABB2D result(*this);
+
+    if (displacement.X < 0.0F)
+    {
+        result.Min.X += displacement.X;
+    }
+    else
+    {
+        result.Max.X += displacement.X;
+    }
+
+    if (displacement.Y < 0.0F)
+    {
+        result.Min.Y += displacement.Y;
+    }
+    else
+    {
+        result.Max.Y += displacement.Y;
+    }
+
+    return result;
+}
+
+NAMESPACE_END() // namespace PHYE::Physics2D
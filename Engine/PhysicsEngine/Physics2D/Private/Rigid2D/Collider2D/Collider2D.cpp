@@ -6,4 +6,67 @@
  * For more detail, please refer to the LICENSE file in the root directory of this project.
  */
 
+#include <Rigid2D/BoundingVolume2D/BoundingAABB2D.hpp>
 #include <Rigid2D/Collider2D/Collider2D.hpp>
+#include <Rigid2D/Geometry2D/PrimitiveShape2D.hpp>
+#include <cassert>
+#include <utility>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+CCollider2D::CCollider2D(std::unique_ptr<CPrimitiveShape2D> shape, const STransform2D& localTransform)
+    : PrimitiveShape(std::move(shape))
+{
+    SetLocalTransform(localTransform);
+}
+
+CCollider2D::~CCollider2D() = default;
+
+CBoundingAABB2D CCollider2D::ComputeAABB(const SPose2D& bodyPose) const
+{
+    assert(PrimitiveShape != nullptr);
+    return PrimitiveShape->ComputeAABB(bodyPose * LocalPose);
+}
+
+const CPrimitiveShape2D* CCollider2D::GetShape() const
+{
+    return PrimitiveShape.get();
+}
+
+const STransform2D& CCollider2D::GetLocalTransform() const
+{
+    return LocalTransform;
+}
+
+const SPose2D& CCollider2D::GetLocalPose() const
+{
+    return LocalPose;
+}
+
+uint32_t CCollider2D::GetColliderId() const
+{
+    return ColliderId;
+}
+
+uint32_t CCollider2D::GetCollisionLayers() const
+{
+    return CollisionLayers;
+}
+
+void CCollider2D::SetShape(std::unique_ptr<CPrimitiveShape2D> shape)
+{
+    PrimitiveShape = std::move(shape);
+}
+
+void CCollider2D::SetLocalTransform(const STransform2D& localTransform)
+{
+    LocalTransform = localTransform;
+    LocalPose = SPose2D(LocalTransform.GetTranslation(), BE::Math::DegreesToRadians(LocalTransform.GetRotation()));
+}
+
+void CCollider2D::SetCollisionLayers(uint32_t collisionLayers)
+{
+    CollisionLayers = collisionLayers;
+}
+
+NAMESPACE_END() // namespace PHYE::Physics2D
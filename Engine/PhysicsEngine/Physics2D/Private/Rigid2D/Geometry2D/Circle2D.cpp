@@ -6,17 +6,20 @@
  * For more detail, please refer to the LICENSE file in the root directory of this project.
  */
 
+#include <Rigid2D/BoundingVolume2D/BoundingAABB2D.hpp>
 #include <Rigid2D/Geometry2D/Circle2D.hpp>
+#include <Rigid2D/Geometry2D/Pose2D.hpp>
 
 #include <cassert>
 #include <utility>
 
 NAMESPACE_BEGIN(PHYE::Physics2D)
 
-CCircle2D::CCircle2D() : Center(0.0F), Radius(1.0F)
+CCircle2D::CCircle2D() : CPrimitiveShape2D(EShapeType2D::Circle), Center(0.0F), Radius(1.0F)
 {}
 
-CCircle2D::CCircle2D(CPoint2D center, float radius) : Center(std::move(center)), Radius(radius)
+CCircle2D::CCircle2D(CPoint2D center, float radius)
+    : CPrimitiveShape2D(EShapeType2D::Circle), Center(std::move(center)), Radius(radius)
 {
     // Make sure radius > 0
     assert(radius > 0.0F);
@@ -27,4 +30,9 @@ CPoint2D CCircle2D::GetCenter() const
     return Center;
 }
 
+CBoundingAABB2D CCircle2D::ComputeAABB(const SPose2D& pose) const
+{
+    return CBoundingAABB2D::FromCenter(pose.TransformPoint(Center.ToVector2F()), SVector2F(Radius, Radius));
+}
+
 NAMESPACE_END() // namespace PHYE::Physics2D
\ No newline at end of file
@@ -6,15 +6,22 @@
  * For more detail, please refer to the LICENSE file in the root directory of this project.
  */
 
+#include <Rigid2D/BoundingVolume2D/BoundingAABB2D.hpp>
 #include <Rigid2D/Geometry2D/Line2D.hpp>
+#include <Rigid2D/Geometry2D/Pose2D.hpp>
 #include <utility>
 
 NAMESPACE_BEGIN(PHYE::Physics2D)
 
-CLine2D::CLine2D(CPoint2D start, CPoint2D end) : Start(std::move(start)), End(std::move(end))
+CLine2D::CLine2D() : CPrimitiveShape2D(EShapeType2D::Line), Start(0.0F), End(0.0F)
 {}
 
-CLine2D::CLine2D(CPoint2D start, const SVector2F& extend) : Start(std::move(start)), End(std::move(start + extend))
+CLine2D::CLine2D(CPoint2D start, CPoint2D end)
+    : CPrimitiveShape2D(EShapeType2D::Line), Start(std::move(start)), End(std::move(end))
+{}
+
+CLine2D::CLine2D(CPoint2D start, const SVector2F& extend)
+    : CPrimitiveShape2D(EShapeType2D::Line), Start(std::move(start)), End(std::move(start + extend))
 {}
 
 bool CLine2D::operator==(const CLine2D& other) const
@@ -54,4 +61,14 @@ SVector2F CLine2D::GetDiagonal() const
     return End - Start;
 }
 
+CBoundingAABB2D CLine2D::ComputeAABB(const SPose2D& pose) const
+{
+    const auto WORLD_START = pose.TransformPoint(Start.ToVector2F());
+    const auto WORLD_END = pose.TransformPoint(End.ToVector2F());
+
+    return CBoundingAABB2D(
+        SVector2F(BE::Math::Min(WORLD_START.X, WORLD_END.X), BE::Math::Min(WORLD_START.Y, WORLD_END.Y)),
+        SVector2F(BE::Math::Max(WORLD_START.X, WORLD_END.X), BE::Math::Max(WORLD_START.Y, WORLD_END.Y)));
+}
+
 NAMESPACE_END() // namespace PHYE::Physics2D
\ No newline at end of file
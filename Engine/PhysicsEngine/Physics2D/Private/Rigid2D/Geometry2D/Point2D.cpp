@@ -6,15 +6,17 @@
  * For more detail, please refer to the LICENSE file in the root directory of this project.
  */
 
+#include <Rigid2D/BoundingVolume2D/BoundingAABB2D.hpp>
 #include <Rigid2D/Geometry2D/Point2D.hpp>
+#include <Rigid2D/Geometry2D/Pose2D.hpp>
 #include <utility>
 
 NAMESPACE_BEGIN(PHYE::Physics2D)
 
-constexpr CPoint2D::CPoint2D() : Position(0.0F)
+constexpr CPoint2D::CPoint2D() : CPrimitiveShape2D(EShapeType2D::Point), Position(0.0F)
 {}
 
-CPoint2D::CPoint2D(SVector2F vector2f) : Position(std::move(vector2f))
+CPoint2D::CPoint2D(SVector2F vector2f) : CPrimitiveShape2D(EShapeType2D::Point), Position(std::move(vector2f))
 {}
 
 CPoint2D& CPoint2D::operator=(const SVector2F& vector2f)
@@ -81,4 +83,10 @@ void CPoint2D::Set(const SVector2F& vector)
     Position = vector;
 }
 
+CBoundingAABB2D CPoint2D::ComputeAABB(const SPose2D& pose) const
+{
+    const auto WORLD_POSITION = pose.TransformPoint(Position);
+    return CBoundingAABB2D(WORLD_POSITION, WORLD_POSITION);
+}
+
 NAMESPACE_END() // namespace PHYE::Physics2D
\ No newline at end of file
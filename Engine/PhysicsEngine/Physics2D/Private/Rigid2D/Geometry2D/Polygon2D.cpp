@@ -0,0 +1,262 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#include <MathUtility/MathUtilities.hpp>
+#include <Rigid2D/BoundingVolume2D/BoundingAABB2D.hpp>
+#include <Rigid2D/Geometry2D/Polygon2D.hpp>
+#include <Rigid2D/Geometry2D/Pose2D.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+namespace
+{
+
+// Points closer than this are welded together when building the hull
+constexpr float HULL_WELD_DISTANCE = 1.0E-4F;
+
+// A hull whose area is not above this is degenerate(all points coincident or collinear)
+constexpr float HULL_MIN_AREA = HULL_WELD_DISTANCE * HULL_WELD_DISTANCE;
+
+using FHullPoints = std::array<SVector2F, (2 * MAX_POLYGON_VERTICES_2D) + 1>;
+
+// Cross product of (b - a) and (c - a), positive when a -> b -> c turns counter-clockwise
+float Orientation(const SVector2F& a, const SVector2F& b, const SVector2F& c)
+{
+    return (b - a) ^ (c - a);
+}
+
+// Convex hull of at most MAX_POLYGON_VERTICES_2D points(counter-clockwise), returns its vertex count
+size_t BuildHull(std::span<const SVector2F> points, FHullPoints& hull)
+{
+    // 1. 按 (X, Y) 排序并焊接重合的点
+    std::array<SVector2F, MAX_POLYGON_VERTICES_2D> sorted;
+    const size_t POINT_COUNT = BE::Math::Min(points.size(), static_cast<size_t>(MAX_POLYGON_VERTICES_2D));
+    std::copy_n(points.begin(), POINT_COUNT, sorted.begin());
+    std::sort(sorted.begin(), sorted.begin() + POINT_COUNT, [](const SVector2F& lhs, const SVector2F& rhs) {
+        return lhs.X < rhs.X || (lhs.X == rhs.X && lhs.Y < rhs.Y);
+    });
+
+    size_t uniqueCount = 0;
+    for (size_t index = 0; index < POINT_COUNT; ++index)
+    {
+        bool isUnique = true;
+        for (size_t other = 0; other < uniqueCount; ++other)
+        {
+            const SVector2F DELTA = sorted[index] - sorted[other];
+            if ((DELTA | DELTA) < HULL_WELD_DISTANCE * HULL_WELD_DISTANCE)
+            {
+                isUnique = false;
+                break;
+            }
+        }
+
+        if (isUnique)
+        {
+            sorted[uniqueCount++] = sorted[index];
+        }
+    }
+
+    // 2. Andrew 单调链求凸包(逆时针)，共线点被剔除
+    size_t hullCount = 0;
+
+    for (size_t index = 0; index < uniqueCount; ++index)
+    {
+        while (hullCount >= 2 && Orientation(hull[hullCount - 2], hull[hullCount - 1], sorted[index]) <= 0.0F)
+        {
+            --hullCount;
+        }
+        hull[hullCount++] = sorted[index];
+    }
+
+    const size_t LOWER_COUNT = hullCount + 1;
+    for (size_t index = uniqueCount; index-- > 0;)
+    {
+        while (hullCount >= LOWER_COUNT && Orientation(hull[hullCount - 2], hull[hullCount - 1], sorted[index]) <= 0.0F)
+        {
+            --hullCount;
+        }
+        hull[hullCount++] = sorted[index];
+    }
+
+    // 最后一个点与第一个点重复
+    return hullCount > 0 ? hullCount - 1 : 0;
+}
+
+float HullArea(const FHullPoints& hull, size_t hullCount)
+{
+    float area = 0.0F;
+    for (size_t index = 1; index + 1 < hullCount; ++index)
+    {
+        area += (hull[index] - hull[0]) ^ (hull[index + 1] - hull[0]);
+    }
+
+    return 0.5F * area;
+}
+
+bool IsHullValid(const FHullPoints& hull, size_t hullCount)
+{
+    return hullCount >= 3 && HullArea(hull, hullCount) > HULL_MIN_AREA;
+}
+
+} // namespace
+
+CPolygon2D::CPolygon2D() : CPrimitiveShape2D(EShapeType2D::Polygon), Centroid(0.0F, 0.0F), VertexCount(4)
+{
+    Vertices[0] = SVector2F(-0.5F, -0.5F);
+    Vertices[1] = SVector2F(0.5F, -0.5F);
+    Vertices[2] = SVector2F(0.5F, 0.5F);
+    Vertices[3] = SVector2F(-0.5F, 0.5F);
+
+    Normals[0] = SVector2F(0.0F, -1.0F);
+    Normals[1] = SVector2F(1.0F, 0.0F);
+    Normals[2] = SVector2F(0.0F, 1.0F);
+    Normals[3] = SVector2F(-1.0F, 0.0F);
+}
+
+CPolygon2D::CPolygon2D(std::span<const SVector2F> points)
+    : CPrimitiveShape2D(EShapeType2D::Polygon), Centroid(0.0F, 0.0F), VertexCount(0)
+{
+    assert(points.size() <= MAX_POLYGON_VERTICES_2D);
+
+    FHullPoints  hull;
+    const size_t HULL_COUNT = BuildHull(points, hull);
+
+    if (IsHullValid(hull, HULL_COUNT))
+    {
+        VertexCount = static_cast<uint32_t>(HULL_COUNT);
+        std::copy_n(hull.begin(), HULL_COUNT, Vertices.begin());
+    }
+    else
+    {
+        // 退化的点集(重合或共线)没有面积：退化为沿最远两点连线的细长矩形，法线与质心始终有效
+        SVector2F start(0.0F, 0.0F);
+        SVector2F end(0.0F, 0.0F);
+        float     maxDistanceSquared = -1.0F;
+        for (size_t first = 0; first < HULL_COUNT; ++first)
+        {
+            for (size_t second = first; second < HULL_COUNT; ++second)
+            {
+                const SVector2F DELTA = hull[second] - hull[first];
+                if ((DELTA | DELTA) > maxDistanceSquared)
+                {
+                    maxDistanceSquared = DELTA | DELTA;
+                    start = hull[first];
+                    end = hull[second];
+                }
+            }
+        }
+
+        const float     LENGTH = std::sqrt((end - start) | (end - start));
+        const SVector2F DIRECTION =
+            LENGTH > HULL_WELD_DISTANCE ? (end - start) * (1.0F / LENGTH) : SVector2F(1.0F, 0.0F);
+        const SVector2F NORMAL(-DIRECTION.Y, DIRECTION.X);
+
+        float halfWidth = HULL_WELD_DISTANCE;
+        for (size_t index = 0; index < HULL_COUNT; ++index)
+        {
+            halfWidth = BE::Math::Max(halfWidth, std::fabs((hull[index] - start) | NORMAL));
+        }
+
+        // 两端各延长焊接距离，重合的点也得到一个极小的正方形
+        const SVector2F SIDE = NORMAL * halfWidth;
+        const SVector2F FIRST = start - (DIRECTION * HULL_WELD_DISTANCE);
+        const SVector2F LAST = end + (DIRECTION * HULL_WELD_DISTANCE);
+
+        VertexCount = 4;
+        Vertices[0] = FIRST - SIDE;
+        Vertices[1] = LAST - SIDE;
+        Vertices[2] = LAST + SIDE;
+        Vertices[3] = FIRST + SIDE;
+    }
+
+    // 3. 边的外法线
+    for (uint32_t index = 0; index < VertexCount; ++index)
+    {
+        const uint32_t  NEXT = (index + 1 < VertexCount) ? index + 1 : 0;
+        const SVector2F EDGE = Vertices[NEXT] - Vertices[index];
+        const float     LENGTH = std::sqrt(EDGE | EDGE);
+
+        Normals[index] = SVector2F(EDGE.Y, -EDGE.X) * (1.0F / LENGTH);
+    }
+
+    // 4. 面积加权的质心，相对第一个顶点计算以减少精度损失
+    const SVector2F ORIGIN = Vertices[0];
+
+    float     area = 0.0F;
+    SVector2F weightedSum(0.0F, 0.0F);
+    for (uint32_t index = 1; index + 1 < VertexCount; ++index)
+    {
+        const SVector2F EDGE1 = Vertices[index] - ORIGIN;
+        const SVector2F EDGE2 = Vertices[index + 1] - ORIGIN;
+        const float     TRIANGLE_AREA = 0.5F * (EDGE1 ^ EDGE2);
+
+        area += TRIANGLE_AREA;
+        weightedSum += (EDGE1 + EDGE2) * (TRIANGLE_AREA / 3.0F);
+    }
+
+    Centroid = ORIGIN + (weightedSum * (1.0F / area));
+}
+
+bool CPolygon2D::IsValidHull(std::span<const SVector2F> points)
+{
+    if (points.size() < 3 || points.size() > MAX_POLYGON_VERTICES_2D)
+    {
+        return false;
+    }
+
+    FHullPoints  hull;
+    const size_t HULL_COUNT = BuildHull(points, hull);
+    return IsHullValid(hull, HULL_COUNT);
+}
+
+std::span<const SVector2F> CPolygon2D::GetVertices() const
+{
+    return {Vertices.data(), VertexCount};
+}
+
+std::span<const SVector2F> CPolygon2D::GetNormals() const
+{
+    return {Normals.data(), VertexCount};
+}
+
+SVector2F CPolygon2D::GetCentroid() const
+{
+    return Centroid;
+}
+
+float CPolygon2D::Area() const
+{
+    float area = 0.0F;
+    for (uint32_t index = 1; index + 1 < VertexCount; ++index)
+    {
+        area += (Vertices[index] - Vertices[0]) ^ (Vertices[index + 1] - Vertices[0]);
+    }
+
+    return 0.5F * area;
+}
+
+CBoundingAABB2D CPolygon2D::ComputeAABB(const SPose2D& pose) const
+{
+    SVector2F lower = pose.TransformPoint(Vertices[0]);
+    SVector2F upper = lower;
+
+    for (uint32_t index = 1; index < VertexCount; ++index)
+    {
+        const SVector2F VERTEX = pose.TransformPoint(Vertices[index]);
+
+        lower = SVector2F(BE::Math::Min(lower.X, VERTEX.X), BE::Math::Min(lower.Y, VERTEX.Y));
+        upper = SVector2F(BE::Math::Max(upper.X, VERTEX.X), BE::Math::Max(upper.Y, VERTEX.Y));
+    }
+
+    return CBoundingAABB2D(lower, upper);
+}
+
+NAMESPACE_END() // namespace PHYE::Physics2D
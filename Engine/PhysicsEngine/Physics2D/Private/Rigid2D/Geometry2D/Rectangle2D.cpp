@@ -6,20 +6,40 @@
  * For more detail, please refer to the LICENSE file in the root directory of this project.
  */
 
+#include <Rigid2D/BoundingVolume2D/BoundingAABB2D.hpp>
+#include <Rigid2D/Geometry2D/Pose2D.hpp>
 #include <Rigid2D/Geometry2D/Rectangle2D.hpp>
 #include <cmath>
 #include <utility>
 
 NAMESPACE_BEGIN(PHYE::Physics2D)
 
-CRectangle2D::CRectangle2D() : Origin(0.0F), End(1.0F)
+namespace
+{
+
+// AABB of a box with the given center and half extents, rotated by (cos, sin)
+CBoundingAABB2D ComputeBoxAABB(const SVector2F& center, const SVector2F& halfExtents, float cos, float sin)
+{
+    const float ABS_COS = std::abs(cos);
+    const float ABS_SIN = std::abs(sin);
+
+    const SVector2F WORLD_EXTENTS((ABS_COS * halfExtents.X) + (ABS_SIN * halfExtents.Y),
+                                  (ABS_SIN * halfExtents.X) + (ABS_COS * halfExtents.Y));
+
+    return CBoundingAABB2D::FromCenter(center, WORLD_EXTENTS);
+}
+
+} // namespace
+
+CRectangle2D::CRectangle2D() : CPrimitiveShape2D(EShapeType2D::Rectangle), Origin(0.0F), End(1.0F)
 {}
 
-CRectangle2D::CRectangle2D(CPoint2D origin, CPoint2D end) : Origin(std::move(origin)), End(std::move(end))
+CRectangle2D::CRectangle2D(CPoint2D origin, CPoint2D end)
+    : CPrimitiveShape2D(EShapeType2D::Rectangle), Origin(std::move(origin)), End(std::move(end))
 {}
 
 CRectangle2D::CRectangle2D(CPoint2D origin, const SVector2F& extend)
-    : Origin(std::move(origin)), End(std::move(origin + extend))
+    : CPrimitiveShape2D(EShapeType2D::Rectangle), Origin(std::move(origin)), End(std::move(origin + extend))
 {}
 
 CPoint2D CRectangle2D::GetOrigin() const
@@ -62,17 +82,27 @@ float CRectangle2D::DiagonalLength() const
     return (End - Origin).Magnitude();
 }
 
+CBoundingAABB2D CRectangle2D::ComputeAABB(const SPose2D& pose) const
+{
+    const auto LOCAL_CENTER = (Origin.ToVector2F() + End.ToVector2F()) * 0.5F;
+    const SVector2F HALF_EXTENTS(Width() * 0.5F, Height() * 0.5F);
+
+    return ComputeBoxAABB(pose.TransformPoint(LOCAL_CENTER), HALF_EXTENTS, pose.Cos, pose.Sin);
+}
+
 NAMESPACE_END() // namespace PHYE::Physics2D
 
 
 
 NAMESPACE_BEGIN(PHYE::Physics2D)
 
-COrientedRectangle2D::COrientedRectangle2D() : Center{0.0F}, HalfExtents{0.5F, 0.5F}, Angle{0.0F}
+COrientedRectangle2D::COrientedRectangle2D()
+    : CPrimitiveShape2D(EShapeType2D::OrientedRectangle), Center{0.0F}, HalfExtents{0.5F, 0.5F}, Angle{0.0F}
 {}
 
 COrientedRectangle2D::COrientedRectangle2D(CPoint2D center, SVector2F halfExtents, float angle)
-    : Center(std::move(center)), HalfExtents(std::move(halfExtents)), Angle(angle)
+    : CPrimitiveShape2D(EShapeType2D::OrientedRectangle), Center(std::move(center)),
+      HalfExtents(std::move(halfExtents)), Angle(angle)
 {}
 
 CPoint2D COrientedRectangle2D::GetCenter() const
@@ -85,4 +115,12 @@ SVector2F COrientedRectangle2D::GetHalfExtents() const
     return HalfExtents;
 }
 
+CBoundingAABB2D COrientedRectangle2D::ComputeAABB(const SPose2D& pose) const
+{
+    // 形状自身的旋转与位姿的旋转叠加
+    const SPose2D WORLD_POSE = pose * SPose2D(Center.ToVector2F(), BE::Math::DegreesToRadians(Angle));
+
+    return ComputeBoxAABB(WORLD_POSE.Position, HalfExtents, WORLD_POSE.Cos, WORLD_POSE.Sin);
+}
+
 NAMESPACE_END() // namespace PHYE::Physics2D
\ No newline at end of file
@@ -6,18 +6,72 @@
  * For more detail, please refer to the LICENSE file in the root directory of this project.
  */
 
+#include <PhysicsWorld2D/PhysicsWorld2D.hpp>
+#include <Rigid2D/Collider2D/Collider2D.hpp>
 #include <Rigid2D/RigidBody2D/RigidBody2D.hpp>
-#include <NekiraECS/Core/Coordinator/Coordinator.hpp>
+#include <algorithm>
+#include <utility>
 
 NAMESPACE_BEGIN(PHYE::Physics2D)
 
-CRigidBody2D::CRigidBody2D() : RigidBodyEntity(NekiraECS::Coordinator::CreateEntity())
+CRigidBody2D::CRigidBody2D(CPhysicsWorld2D& world, PHYE::PhysicsBase::ERigidBodyType type, float mass, float inertia)
+    : World(&world), BodyId(world.CreateRigidBody(type, mass, inertia))
+{}
+
+CRigidBody2D::~CRigidBody2D()
 {
+    for (const auto& collider : Colliders)
+    {
+        World->RemoveCollider(*collider);
+    }
+
+    World->DestroyRigidBody(BodyId);
 }
 
-CRigidBody2D::~CRigidBody2D()
+SBodyId2D CRigidBody2D::GetBodyId() const
+{
+    return BodyId;
+}
+
+CPhysicsWorld2D& CRigidBody2D::GetWorld() const
+{
+    return *World;
+}
+
+CCollider2D* CRigidBody2D::AddCollider(std::unique_ptr<CCollider2D> collider)
+{
+    if (collider == nullptr)
+    {
+        return nullptr;
+    }
+
+    World->AddCollider(BodyId, *collider);
+
+    Colliders.push_back(std::move(collider));
+    return Colliders.back().get();
+}
+
+void CRigidBody2D::RemoveCollider(const CCollider2D* collider)
+{
+    const auto IT = std::find_if(Colliders.begin(), Colliders.end(),
+                                 [collider](const auto& attached) { return attached.get() == collider; });
+    if (IT == Colliders.end())
+    {
+        return;
+    }
+
+    World->RemoveCollider(**IT);
+    Colliders.erase(IT);
+}
+
+const std::vector<std::unique_ptr<CCollider2D>>& CRigidBody2D::GetColliders() const
+{
+    return Colliders;
+}
+
+SRigidBodyComponent2D* CRigidBody2D::GetComponent() const
 {
-    NekiraECS::Coordinator::DestroyEntity(RigidBodyEntity);
+    return World->GetRigidBody(BodyId);
 }
 
 NAMESPACE_END() // namespace PHYE::Physics2D
\ No newline at end of file
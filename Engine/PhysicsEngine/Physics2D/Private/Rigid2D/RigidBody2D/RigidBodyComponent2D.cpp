@@ -11,8 +11,10 @@
 NAMESPACE_BEGIN(PHYE::Physics2D)
 
 SRigidBodyComponent2D::SRigidBodyComponent2D()
-    : Type(PHYE::PhysicsBase::ERigidBodyType::Static), Velocity(0.0F), AngularVelocity(0.0F), Mass(1.0F),
-      InverseMass(1.0F), Inertia(1.0F), InverseInertia(1.0F)
+    : Type(PHYE::PhysicsBase::ERigidBodyType::Static), Position(0.0F), Rotation(0.0F), Velocity(0.0F),
+      AngularVelocity(0.0F), Force(0.0F), Torque(0.0F), LinearDamping(0.0F), AngularDamping(0.0F), GravityScale(1.0F),
+      Mass(1.0F), InverseMass(1.0F), Inertia(1.0F), InverseInertia(1.0F), IsAwake(true), SleepTime(0.0F),
+      IsBullet(false), ForceGroups(DEFAULT_FORCE_GROUPS)
 {
     // Static body has infinite mass and inertia
     if(Type == PHYE::PhysicsBase::ERigidBodyType::Static)
@@ -25,9 +27,11 @@ SRigidBodyComponent2D::SRigidBodyComponent2D()
 }
 
 SRigidBodyComponent2D::SRigidBodyComponent2D(PHYE::PhysicsBase::ERigidBodyType rigidBodyType, float mass, float inertia)
-    : Type(rigidBodyType), Velocity(0.0F), AngularVelocity(0.0F), Mass(mass),
+    : Type(rigidBodyType), Position(0.0F), Rotation(0.0F), Velocity(0.0F), AngularVelocity(0.0F), Force(0.0F),
+      Torque(0.0F), LinearDamping(0.0F), AngularDamping(0.0F), GravityScale(1.0F), Mass(mass),
       InverseMass(mass > 0.0F ? 1.0F / mass : 0.0F), Inertia(inertia),
-      InverseInertia(inertia > 0.0F ? 1.0F / inertia : 0.0F)
+      InverseInertia(inertia > 0.0F ? 1.0F / inertia : 0.0F), IsAwake(true), SleepTime(0.0F),
+      IsBullet(false), ForceGroups(DEFAULT_FORCE_GROUPS)
 {
     // Static body has infinite mass and inertia
     if(Type == PHYE::PhysicsBase::ERigidBodyType::Static)
@@ -0,0 +1,93 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#include <Scene2D/RegionStreamer2D.hpp>
+#include <iterator>
+#include <utility>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+CRegionStreamer2D::CRegionStreamer2D()
+    : PendingCount(0), IsStopping(false), Thread(&CRegionStreamer2D::ThreadMain, this)
+{}
+
+CRegionStreamer2D::~CRegionStreamer2D()
+{
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        IsStopping = true;
+    }
+
+    RequestCondition.notify_one();
+    Thread.join();
+}
+
+void CRegionStreamer2D::RequestLoad(uint32_t regionId, const std::filesystem::path& path)
+{
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        Requests.push_back({regionId, path});
+        ++PendingCount;
+    }
+
+    RequestCondition.notify_one();
+}
+
+void CRegionStreamer2D::TakePrepared(std::vector<std::unique_ptr<SPreparedRegion2D>>& outRegions)
+{
+    std::lock_guard<std::mutex> lock(Mutex);
+
+    outRegions.insert(outRegions.end(), std::make_move_iterator(Prepared.begin()),
+                      std::make_move_iterator(Prepared.end()));
+    Prepared.clear();
+}
+
+void CRegionStreamer2D::WaitIdle()
+{
+    std::unique_lock<std::mutex> lock(Mutex);
+    IdleCondition.wait(lock, [this] { return PendingCount == 0; });
+}
+
+void CRegionStreamer2D::ThreadMain()
+{
+    while (true)
+    {
+        SLoadRequest request;
+        {
+            std::unique_lock<std::mutex> lock(Mutex);
+            RequestCondition.wait(lock, [this] { return IsStopping || !Requests.empty(); });
+
+            if (IsStopping)
+            {
+                return;
+            }
+
+            request = std::move(Requests.front());
+            Requests.pop_front();
+        }
+
+        // 映射、校验并准备区域，缺页与形状构建都发生在本线程
+        auto region = std::make_unique<SPreparedRegion2D>();
+        region->RegionId = request.RegionId;
+        region->IsValid = region->File.Open(request.Path);
+        if (region->IsValid)
+        {
+            PrepareSceneBatch(region->File.GetView(), region->Batch);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(Mutex);
+            Prepared.push_back(std::move(region));
+            --PendingCount;
+        }
+
+        IdleCondition.notify_all();
+    }
+}
+
+NAMESPACE_END() // namespace PHYE::Physics2D
@@ -0,0 +1,68 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#include <RigidBodyType.hpp>
+#include <Scene2D/SceneBatch2D.hpp>
+#include <cassert>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+void PrepareSceneBatch(const CSceneView2D& scene, SSceneBatch2D& outBatch)
+{
+    assert(scene.IsValid());
+
+    const std::span<const SSceneBody2D>     BODIES = scene.GetBodies();
+    const std::span<const SSceneCollider2D> COLLIDERS = scene.GetColliders();
+    const std::span<const SSceneTreeNode2D> TREE_NODES = scene.GetTreeNodes();
+
+    outBatch.Scene = scene;
+    outBatch.Shapes = std::make_unique<CSceneShapes2D>(COLLIDERS);
+
+    outBatch.ColliderShapes.clear();
+    outBatch.LocalPoses.clear();
+    outBatch.Poses.clear();
+    outBatch.AABBs.clear();
+    outBatch.IsDynamic.clear();
+    outBatch.TreeNodes.clear();
+
+    outBatch.ColliderShapes.reserve(COLLIDERS.size());
+    outBatch.LocalPoses.reserve(COLLIDERS.size());
+    outBatch.Poses.reserve(COLLIDERS.size());
+    outBatch.AABBs.reserve(COLLIDERS.size());
+    outBatch.IsDynamic.reserve(COLLIDERS.size());
+    outBatch.TreeNodes.reserve(TREE_NODES.size());
+
+    for (const SSceneCollider2D& collider : COLLIDERS)
+    {
+        const SSceneBody2D& body = BODIES[collider.BodyIndex];
+
+        const CPrimitiveShape2D* shape = outBatch.Shapes->Create(collider);
+        const SPose2D&           localPose = outBatch.LocalPoses.emplace_back(
+            SVector2F(collider.LocalPositionX, collider.LocalPositionY), collider.LocalCos, collider.LocalSin);
+        const SPose2D& pose =
+            outBatch.Poses.emplace_back(SPose2D(SVector2F(body.PositionX, body.PositionY), body.Rotation) * localPose);
+
+        outBatch.ColliderShapes.push_back(shape);
+        outBatch.AABBs.push_back(shape->ComputeAABB(pose));
+        outBatch.IsDynamic.push_back(body.Type == static_cast<uint8_t>(PHYE::PhysicsBase::ERigidBodyType::Dynamic));
+    }
+
+    for (const SSceneTreeNode2D& sceneNode : TREE_NODES)
+    {
+        STreeNode2D& node = outBatch.TreeNodes.emplace_back();
+        node.AABB =
+            CBoundingAABB2D(SVector2F(sceneNode.MinX, sceneNode.MinY), SVector2F(sceneNode.MaxX, sceneNode.MaxY));
+        node.UserData = sceneNode.UserData;
+        node.Parent = sceneNode.Parent;
+        node.Child1 = sceneNode.Child1;
+        node.Child2 = sceneNode.Child2;
+        node.Height = sceneNode.Height;
+    }
+}
+
+NAMESPACE_END() // namespace PHYE::Physics2D
@@ -0,0 +1,45 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#include <Scene2D/SceneFile2D.hpp>
+#include <fstream>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+bool CSceneFile2D::Open(const std::filesystem::path& path)
+{
+    View.Reset();
+
+    if (!File.Open(path) || !View.Attach(File.GetData()))
+    {
+        File.Close();
+        return false;
+    }
+
+    return true;
+}
+
+void CSceneFile2D::Close()
+{
+    View.Reset();
+    File.Close();
+}
+
+bool CSceneFile2D::Save(const std::filesystem::path& path, std::span<const std::byte> bytes)
+{
+    std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+    if (!stream)
+    {
+        return false;
+    }
+
+    stream.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    return stream.good();
+}
+
+NAMESPACE_END() // namespace PHYE::Physics2D
@@ -0,0 +1,386 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#include <Rigid2D/Geometry2D/Circle2D.hpp>
+#include <Rigid2D/Geometry2D/Line2D.hpp>
+#include <Rigid2D/Geometry2D/Point2D.hpp>
+#include <Rigid2D/Geometry2D/Rectangle2D.hpp>
+#include <RigidBodyType.hpp>
+#include <Scene2D/SceneFormat2D.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+namespace
+{
+
+// 段必须按 SCENE_SECTION_ALIGNMENT_2D 对齐且完整地位于文件内
+template <typename T>
+bool GetSection(std::span<const std::byte> bytes, const SSceneSection2D& section, std::span<const T>& outRecords)
+{
+    if (section.Count == 0)
+    {
+        outRecords = {};
+        return true;
+    }
+
+    if (section.Offset % SCENE_SECTION_ALIGNMENT_2D != 0 || section.Offset > bytes.size() ||
+        section.Count > (bytes.size() - section.Offset) / sizeof(T))
+    {
+        return false;
+    }
+
+    outRecords = std::span<const T>(reinterpret_cast<const T*>(bytes.data() + section.Offset),
+                                    static_cast<size_t>(section.Count));
+    return true;
+}
+
+bool IsNodeInRange(int32_t node, size_t nodeCount)
+{
+    return node == NULL_TREE_NODE || (node >= 0 && static_cast<size_t>(node) < nodeCount);
+}
+
+bool IsFinite(float value)
+{
+    return std::isfinite(value);
+}
+
+bool IsBodyValid(const SSceneBody2D& body)
+{
+    const std::array<float, 11> VALUES = {body.PositionX,     body.PositionY,      body.Rotation,
+                                          body.VelocityX,     body.VelocityY,      body.AngularVelocity,
+                                          body.LinearDamping, body.AngularDamping, body.GravityScale,
+                                          body.Mass,          body.Inertia};
+
+    return body.Type <= static_cast<uint8_t>(PHYE::PhysicsBase::ERigidBodyType::Kinematic) &&
+           std::all_of(VALUES.begin(), VALUES.end(), IsFinite) && body.Mass >= 0.0F && body.Inertia >= 0.0F;
+}
+
+// 形状参数必须有限，半径与半边长不能为负，多边形必须有面积
+bool IsShapeValid(const SSceneCollider2D& collider)
+{
+    if (!IsFinite(collider.LocalPositionX) || !IsFinite(collider.LocalPositionY) || !IsFinite(collider.LocalCos) ||
+        !IsFinite(collider.LocalSin) || !IsFinite(collider.Scalar) ||
+        !std::all_of(collider.Points.begin(), collider.Points.end(), IsFinite))
+    {
+        return false;
+    }
+
+    switch (static_cast<EShapeType2D>(collider.ShapeType))
+    {
+        case EShapeType2D::Circle:
+            return collider.Scalar >= 0.0F;
+        case EShapeType2D::OrientedRectangle:
+            return collider.Points[2] >= 0.0F && collider.Points[3] >= 0.0F;
+        case EShapeType2D::Polygon:
+        {
+            if (collider.VertexCount < 3 || collider.VertexCount > MAX_POLYGON_VERTICES_2D)
+            {
+                return false;
+            }
+
+            // 重合或共线的顶点没有面积，无法构建多边形
+            std::array<SVector2F, MAX_POLYGON_VERTICES_2D> vertices;
+            for (uint32_t index = 0; index < collider.VertexCount; ++index)
+            {
+                vertices[index] = SVector2F(collider.Points[2 * index], collider.Points[(2 * index) + 1]);
+            }
+            return CPolygon2D::IsValidHull(std::span<const SVector2F>(vertices.data(), collider.VertexCount));
+        }
+        default:
+            return true;
+    }
+}
+
+/**
+ * @brief Walk the tree from its root: every used node must be reached exactly once, with a finite AABB, links that
+ * agree in both directions, and the height of a leaf(0) or one more than its highest child. Free nodes(Height -1) may
+ * be present but not reachable. Node indices must already be in range.
+ */
+bool IsTreeValid(std::span<const SSceneTreeNode2D> nodes, int32_t root)
+{
+    if (nodes.empty())
+    {
+        return true;
+    }
+
+    if (nodes[root].Parent != NULL_TREE_NODE)
+    {
+        return false;
+    }
+
+    std::vector<uint8_t> visited(nodes.size(), 0);
+    std::vector<int32_t> stack;
+    stack.push_back(root);
+
+    size_t visitedCount = 0;
+    while (!stack.empty())
+    {
+        const int32_t NODE_ID = stack.back();
+        stack.pop_back();
+
+        // 同一节点被访问两次说明有环或共享子树
+        const SSceneTreeNode2D& node = nodes[NODE_ID];
+        if (visited[NODE_ID] != 0 || node.Height < 0)
+        {
+            return false;
+        }
+
+        visited[NODE_ID] = 1;
+        ++visitedCount;
+
+        if (!IsFinite(node.MinX) || !IsFinite(node.MinY) || !IsFinite(node.MaxX) || !IsFinite(node.MaxY) ||
+            node.MinX > node.MaxX || node.MinY > node.MaxY)
+        {
+            return false;
+        }
+
+        if (node.Height == 0)
+        {
+            if (node.Child1 != NULL_TREE_NODE || node.Child2 != NULL_TREE_NODE)
+            {
+                return false;
+            }
+            continue;
+        }
+
+        if (node.Child1 == NULL_TREE_NODE || node.Child2 == NULL_TREE_NODE || node.Child1 == node.Child2)
+        {
+            return false;
+        }
+
+        const SSceneTreeNode2D& child1 = nodes[node.Child1];
+        const SSceneTreeNode2D& child2 = nodes[node.Child2];
+        if (child1.Parent != NODE_ID || child2.Parent != NODE_ID ||
+            node.Height != 1 + std::max(child1.Height, child2.Height))
+        {
+            return false;
+        }
+
+        stack.push_back(node.Child1);
+        stack.push_back(node.Child2);
+    }
+
+    // 所有使用中的节点都必须在树中
+    const auto USED_COUNT = static_cast<size_t>(
+        std::count_if(nodes.begin(), nodes.end(), [](const SSceneTreeNode2D& node) { return node.Height >= 0; }));
+
+    return visitedCount == USED_COUNT;
+}
+
+size_t AlignSectionOffset(size_t offset)
+{
+    return (offset + SCENE_SECTION_ALIGNMENT_2D - 1) & ~(SCENE_SECTION_ALIGNMENT_2D - 1);
+}
+
+template <typename T>
+void WriteSection(std::span<const T> records, size_t& offset, SSceneSection2D& outSection,
+                  std::vector<std::byte>& outBytes)
+{
+    offset = AlignSectionOffset(offset);
+    outSection.Offset = records.empty() ? 0 : offset;
+    outSection.Count = records.size();
+
+    if (!records.empty())
+    {
+        std::memcpy(outBytes.data() + offset, records.data(), records.size_bytes());
+        offset += records.size_bytes();
+    }
+}
+
+void SetPoint(SSceneCollider2D& collider, uint32_t index, float x, float y)
+{
+    collider.Points[2 * index] = x;
+    collider.Points[(2 * index) + 1] = y;
+}
+
+} // namespace
+
+bool CSceneView2D::Attach(std::span<const std::byte> bytes)
+{
+    Reset();
+
+    if (bytes.size() < sizeof(SSceneHeader2D) ||
+        reinterpret_cast<uintptr_t>(bytes.data()) % alignof(SSceneHeader2D) != 0)
+    {
+        return false;
+    }
+
+    const auto* header = reinterpret_cast<const SSceneHeader2D*>(bytes.data());
+    if (header->Magic != SCENE_MAGIC_2D || header->Version != SCENE_VERSION_2D ||
+        header->EndianTag != SCENE_ENDIAN_TAG_2D || header->HeaderSize != sizeof(SSceneHeader2D))
+    {
+        return false;
+    }
+
+    std::span<const SSceneBody2D>     bodies;
+    std::span<const SSceneCollider2D> colliders;
+    std::span<const SSceneTreeNode2D> treeNodes;
+    if (!GetSection(bytes, header->Bodies, bodies) || !GetSection(bytes, header->Colliders, colliders) ||
+        !GetSection(bytes, header->TreeNodes, treeNodes))
+    {
+        return false;
+    }
+
+    // 之后按记录中的序号直接访问，这里检查它们都在范围内
+    if (!std::all_of(bodies.begin(), bodies.end(), IsBodyValid))
+    {
+        return false;
+    }
+
+    if (treeNodes.empty() ? header->TreeRoot != NULL_TREE_NODE
+                          : header->TreeRoot == NULL_TREE_NODE || !IsNodeInRange(header->TreeRoot, treeNodes.size()))
+    {
+        return false;
+    }
+
+    for (const SSceneTreeNode2D& node : treeNodes)
+    {
+        if (!IsNodeInRange(node.Parent, treeNodes.size()) || !IsNodeInRange(node.Child1, treeNodes.size()) ||
+            !IsNodeInRange(node.Child2, treeNodes.size()) || node.Height < -1 ||
+            (node.Height == 0 && node.UserData >= colliders.size()))
+        {
+            return false;
+        }
+    }
+
+    // 树会被原样嫁接到宽相位，结构错误会让之后的遍历死循环或越界
+    if (!IsTreeValid(treeNodes, header->TreeRoot))
+    {
+        return false;
+    }
+
+    for (size_t index = 0; index < colliders.size(); ++index)
+    {
+        const SSceneCollider2D& collider = colliders[index];
+        if (collider.BodyIndex >= bodies.size() || collider.ShapeType >= SHAPE_TYPE_COUNT_2D)
+        {
+            return false;
+        }
+
+        if (!IsShapeValid(collider))
+        {
+            return false;
+        }
+
+        // 叶子与碰撞体互相引用
+        if (!treeNodes.empty() &&
+            (collider.ProxyId < 0 || static_cast<size_t>(collider.ProxyId) >= treeNodes.size() ||
+             treeNodes[collider.ProxyId].Height != 0 || treeNodes[collider.ProxyId].UserData != index))
+        {
+            return false;
+        }
+    }
+
+    Header = header;
+    Bodies = bodies;
+    Colliders = colliders;
+    TreeNodes = treeNodes;
+
+    return true;
+}
+
+void CSceneView2D::Reset()
+{
+    Header = nullptr;
+    Bodies = {};
+    Colliders = {};
+    TreeNodes = {};
+}
+
+void EncodeSceneShape(const CPrimitiveShape2D& shape, SSceneCollider2D& outCollider)
+{
+    outCollider.ShapeType = static_cast<uint8_t>(shape.GetShapeType());
+    outCollider.VertexCount = 0;
+    outCollider.Scalar = 0.0F;
+    outCollider.Points.fill(0.0F);
+
+    switch (shape.GetShapeType())
+    {
+        case EShapeType2D::Point:
+        {
+            const auto& point = static_cast<const CPoint2D&>(shape);
+            SetPoint(outCollider, 0, point.X(), point.Y());
+            break;
+        }
+        case EShapeType2D::Circle:
+        {
+            const auto& circle = static_cast<const CCircle2D&>(shape);
+            SetPoint(outCollider, 0, circle.GetCenter().X(), circle.GetCenter().Y());
+            outCollider.Scalar = circle.GetRadius();
+            break;
+        }
+        case EShapeType2D::Line:
+        {
+            const auto& line = static_cast<const CLine2D&>(shape);
+            SetPoint(outCollider, 0, line.GetStart().X(), line.GetStart().Y());
+            SetPoint(outCollider, 1, line.GetEnd().X(), line.GetEnd().Y());
+            break;
+        }
+        case EShapeType2D::Rectangle:
+        {
+            const auto& rectangle = static_cast<const CRectangle2D&>(shape);
+            SetPoint(outCollider, 0, rectangle.GetOrigin().X(), rectangle.GetOrigin().Y());
+            SetPoint(outCollider, 1, rectangle.GetEnd().X(), rectangle.GetEnd().Y());
+            break;
+        }
+        case EShapeType2D::OrientedRectangle:
+        {
+            const auto& rectangle = static_cast<const COrientedRectangle2D&>(shape);
+            SetPoint(outCollider, 0, rectangle.GetCenter().X(), rectangle.GetCenter().Y());
+            SetPoint(outCollider, 1, rectangle.GetHalfExtents().X, rectangle.GetHalfExtents().Y);
+            outCollider.Scalar = rectangle.GetAngle();
+            break;
+        }
+        case EShapeType2D::Polygon:
+        {
+            const auto& polygon = static_cast<const CPolygon2D&>(shape);
+            const auto  VERTICES = polygon.GetVertices();
+            for (uint32_t index = 0; index < VERTICES.size(); ++index)
+            {
+                SetPoint(outCollider, index, VERTICES[index].X, VERTICES[index].Y);
+            }
+            outCollider.VertexCount = static_cast<uint8_t>(VERTICES.size());
+            break;
+        }
+        default:
+            assert(false && "Unknown shape type");
+            break;
+    }
+}
+
+void SerializeScene(std::span<const SSceneBody2D> bodies, std::span<const SSceneCollider2D> colliders,
+                    std::span<const SSceneTreeNode2D> treeNodes, int32_t treeRoot, std::vector<std::byte>& outBytes)
+{
+    assert(treeNodes.empty() == (treeRoot == NULL_TREE_NODE));
+
+    // 先计算每个段的位置再一次性分配
+    size_t size = sizeof(SSceneHeader2D);
+    size = AlignSectionOffset(size) + bodies.size_bytes();
+    size = AlignSectionOffset(size) + colliders.size_bytes();
+    size = AlignSectionOffset(size) + treeNodes.size_bytes();
+
+    outBytes.assign(size, std::byte{0});
+
+    SSceneHeader2D header;
+    header.HeaderSize = sizeof(SSceneHeader2D);
+    header.TreeRoot = treeRoot;
+
+    size_t offset = sizeof(SSceneHeader2D);
+    WriteSection(bodies, offset, header.Bodies, outBytes);
+    WriteSection(colliders, offset, header.Colliders, outBytes);
+    WriteSection(treeNodes, offset, header.TreeNodes, outBytes);
+
+    std::memcpy(outBytes.data(), &header, sizeof(SSceneHeader2D));
+}
+
+NAMESPACE_END() // namespace PHYE::Physics2D
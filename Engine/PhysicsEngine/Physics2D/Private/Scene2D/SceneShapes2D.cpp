@@ -0,0 +1,70 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#include <Scene2D/SceneShapes2D.hpp>
+#include <array>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+namespace
+{
+
+SVector2F GetPoint(const SSceneCollider2D& collider, uint32_t index)
+{
+    return SVector2F(collider.Points[2 * index], collider.Points[(2 * index) + 1]);
+}
+
+} // namespace
+
+CSceneShapes2D::CSceneShapes2D(std::span<const SSceneCollider2D> colliders)
+{
+    std::array<size_t, SHAPE_TYPE_COUNT_2D> counts{};
+    for (const SSceneCollider2D& collider : colliders)
+    {
+        ++counts[collider.ShapeType];
+    }
+
+    Points.reserve(counts[static_cast<size_t>(EShapeType2D::Point)]);
+    Circles.reserve(counts[static_cast<size_t>(EShapeType2D::Circle)]);
+    Lines.reserve(counts[static_cast<size_t>(EShapeType2D::Line)]);
+    Rectangles.reserve(counts[static_cast<size_t>(EShapeType2D::Rectangle)]);
+    OrientedRectangles.reserve(counts[static_cast<size_t>(EShapeType2D::OrientedRectangle)]);
+    Polygons.reserve(counts[static_cast<size_t>(EShapeType2D::Polygon)]);
+}
+
+const CPrimitiveShape2D* CSceneShapes2D::Create(const SSceneCollider2D& collider)
+{
+    switch (static_cast<EShapeType2D>(collider.ShapeType))
+    {
+        case EShapeType2D::Point:
+            return Emplace(Points, GetPoint(collider, 0));
+        case EShapeType2D::Circle:
+            return Emplace(Circles, CPoint2D(GetPoint(collider, 0)), collider.Scalar);
+        case EShapeType2D::Line:
+            return Emplace(Lines, CPoint2D(GetPoint(collider, 0)), CPoint2D(GetPoint(collider, 1)));
+        case EShapeType2D::Rectangle:
+            return Emplace(Rectangles, CPoint2D(GetPoint(collider, 0)), CPoint2D(GetPoint(collider, 1)));
+        case EShapeType2D::OrientedRectangle:
+            return Emplace(OrientedRectangles, CPoint2D(GetPoint(collider, 0)), GetPoint(collider, 1),
+                           collider.Scalar);
+        case EShapeType2D::Polygon:
+        {
+            std::array<SVector2F, MAX_POLYGON_VERTICES_2D> vertices;
+            for (uint32_t index = 0; index < collider.VertexCount; ++index)
+            {
+                vertices[index] = GetPoint(collider, index);
+            }
+            return Emplace(Polygons, std::span<const SVector2F>(vertices.data(), collider.VertexCount));
+        }
+        default:
+            assert(false && "Unknown shape type");
+            return nullptr;
+    }
+}
+
+NAMESPACE_END() // namespace PHYE::Physics2D
@@ -0,0 +1,127 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#include <Solver2D/ConstraintGraph2D.hpp>
+#include <algorithm>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+namespace
+{
+
+constexpr uint32_t OVERFLOW_COLOR = MAX_GRAPH_COLORS_2D;
+
+bool IsBodyUsed(const std::vector<uint64_t>& bodySet, uint32_t body)
+{
+    return body != STATIC_SOLVER_BODY_2D && (bodySet[body >> 6] & (1ULL << (body & 63U))) != 0;
+}
+
+void MarkBody(std::vector<uint64_t>& bodySet, uint32_t body)
+{
+    if (body != STATIC_SOLVER_BODY_2D)
+    {
+        bodySet[body >> 6] |= 1ULL << (body & 63U);
+    }
+}
+
+void ClearBody(std::vector<uint64_t>& bodySet, uint32_t body)
+{
+    if (body != STATIC_SOLVER_BODY_2D)
+    {
+        bodySet[body >> 6] = 0;
+    }
+}
+
+} // namespace
+
+void CConstraintGraph2D::Build(std::span<const SConstraintBodies2D> constraints, uint32_t bodyCount)
+{
+    // 位集合在两次构建之间保持全零，只在刚体数量增加时扩大
+    const size_t WORD_COUNT = (static_cast<size_t>(bodyCount) + 63) / 64;
+    for (auto& bodySet : ColorBodySets)
+    {
+        if (bodySet.size() < WORD_COUNT)
+        {
+            bodySet.resize(WORD_COUNT, 0);
+        }
+    }
+
+    // 1. 贪心着色：选择两个刚体都未被占用的第一种颜色
+    ConstraintColors.resize(constraints.size());
+    ColorStarts.fill(0);
+
+    for (size_t index = 0; index < constraints.size(); ++index)
+    {
+        const SConstraintBodies2D& bodies = constraints[index];
+
+        uint32_t color = 0;
+        for (; color < MAX_GRAPH_COLORS_2D; ++color)
+        {
+            auto& bodySet = ColorBodySets[color];
+            if (!IsBodyUsed(bodySet, bodies.BodyA) && !IsBodyUsed(bodySet, bodies.BodyB))
+            {
+                MarkBody(bodySet, bodies.BodyA);
+                MarkBody(bodySet, bodies.BodyB);
+                break;
+            }
+        }
+
+        ConstraintColors[index] = static_cast<uint8_t>(color);
+        ++ColorStarts[color + 1];
+    }
+
+    // 只清除本次标记过的字，代价与约束数量成正比而与世界的刚体数量无关
+    for (size_t index = 0; index < constraints.size(); ++index)
+    {
+        const uint32_t COLOR = ConstraintColors[index];
+        if (COLOR != OVERFLOW_COLOR)
+        {
+            ClearBody(ColorBodySets[COLOR], constraints[index].BodyA);
+            ClearBody(ColorBodySets[COLOR], constraints[index].BodyB);
+        }
+    }
+
+    // 2. 计数排序：按颜色分组
+    for (uint32_t color = 0; color <= OVERFLOW_COLOR; ++color)
+    {
+        ColorStarts[color + 1] += ColorStarts[color];
+    }
+
+    std::array<uint32_t, MAX_GRAPH_COLORS_2D + 1> cursors{};
+    std::copy(ColorStarts.begin(), ColorStarts.end() - 1, cursors.begin());
+
+    ColorConstraints.resize(constraints.size());
+    for (size_t index = 0; index < constraints.size(); ++index)
+    {
+        ColorConstraints[cursors[ConstraintColors[index]]++] = static_cast<uint32_t>(index);
+    }
+}
+
+std::span<const uint32_t> CConstraintGraph2D::GetColor(uint32_t color) const
+{
+    return std::span<const uint32_t>(ColorConstraints).subspan(ColorStarts[color],
+                                                               ColorStarts[color + 1] - ColorStarts[color]);
+}
+
+std::span<const uint32_t> CConstraintGraph2D::GetOverflow() const
+{
+    return GetColor(OVERFLOW_COLOR);
+}
+
+uint32_t CConstraintGraph2D::GetActiveColorCount() const
+{
+    uint32_t count = 0;
+    for (uint32_t color = 0; color < MAX_GRAPH_COLORS_2D; ++color)
+    {
+        count += ColorStarts[color + 1] > ColorStarts[color] ? 1 : 0;
+    }
+
+    return count;
+}
+
+NAMESPACE_END() // namespace PHYE::Physics2D
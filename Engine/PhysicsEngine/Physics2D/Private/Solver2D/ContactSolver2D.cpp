@@ -0,0 +1,707 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#include <MathUtility/MathUtilities.hpp>
+#include <Rigid2D/Geometry2D/Pose2D.hpp>
+#include <Solver2D/ContactSolver2D.hpp>
+#include <algorithm>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+namespace
+{
+
+constexpr uint32_t INVALID_MANIFOLD_INDEX = UINT32_MAX;
+
+// Velocities of the bodies of every lane
+struct SWideBodyVelocity2D
+{
+    SWideFloat2D LinearX;
+    SWideFloat2D LinearY;
+    SWideFloat2D Angular;
+};
+
+SWideBodyVelocity2D GatherVelocities(std::span<const SSolverBody2D> solverBodies, const TWideIndexArray2D& bodyIndices)
+{
+    alignas(SIMD_ALIGNMENT_2D) TWideArray2D linearX;
+    alignas(SIMD_ALIGNMENT_2D) TWideArray2D linearY;
+    alignas(SIMD_ALIGNMENT_2D) TWideArray2D angular;
+
+    for (uint32_t lane = 0; lane < SIMD_WIDTH_2D; ++lane)
+    {
+        const SSolverBody2D& body = solverBodies[bodyIndices[lane]];
+        linearX[lane] = body.LinearVelocity.X;
+        linearY[lane] = body.LinearVelocity.Y;
+        angular[lane] = body.AngularVelocity;
+    }
+
+    return {WideLoad(linearX), WideLoad(linearY), WideLoad(angular)};
+}
+
+// 只写回可移动的刚体：静态/运动学刚体与填充用的虚拟刚体可能在同一批次的多个通道中出现
+void ScatterVelocities(std::span<SSolverBody2D> solverBodies, const TWideIndexArray2D& bodyIndices,
+                       const SWideBodyVelocity2D& velocity)
+{
+    alignas(SIMD_ALIGNMENT_2D) TWideArray2D linearX;
+    alignas(SIMD_ALIGNMENT_2D) TWideArray2D linearY;
+    alignas(SIMD_ALIGNMENT_2D) TWideArray2D angular;
+
+    WideStore(linearX, velocity.LinearX);
+    WideStore(linearY, velocity.LinearY);
+    WideStore(angular, velocity.Angular);
+
+    for (uint32_t lane = 0; lane < SIMD_WIDTH_2D; ++lane)
+    {
+        SSolverBody2D& body = solverBodies[bodyIndices[lane]];
+        if (body.IsMovable())
+        {
+            body.LinearVelocity = SVector2F(linearX[lane], linearY[lane]);
+            body.AngularVelocity = angular[lane];
+        }
+    }
+}
+
+// Apply the impulse (impulseX, impulseY) at the anchors: A receives it negated
+void ApplyImpulse(const SContactBatch2D& batch, const SContactBatchPoint2D& point, SWideFloat2D impulseX,
+                  SWideFloat2D impulseY, SWideBodyVelocity2D& velocityA, SWideBodyVelocity2D& velocityB)
+{
+    const SWideFloat2D INVERSE_MASS_A = WideLoad(batch.InverseMassA);
+    const SWideFloat2D INVERSE_INERTIA_A = WideLoad(batch.InverseInertiaA);
+    const SWideFloat2D INVERSE_MASS_B = WideLoad(batch.InverseMassB);
+    const SWideFloat2D INVERSE_INERTIA_B = WideLoad(batch.InverseInertiaB);
+
+    const SWideFloat2D ANCHOR_AX = WideLoad(point.AnchorAX);
+    const SWideFloat2D ANCHOR_AY = WideLoad(point.AnchorAY);
+    const SWideFloat2D ANCHOR_BX = WideLoad(point.AnchorBX);
+    const SWideFloat2D ANCHOR_BY = WideLoad(point.AnchorBY);
+
+    velocityA.LinearX = velocityA.LinearX - (INVERSE_MASS_A * impulseX);
+    velocityA.LinearY = velocityA.LinearY - (INVERSE_MASS_A * impulseY);
+    velocityA.Angular =
+        velocityA.Angular - (INVERSE_INERTIA_A * ((ANCHOR_AX * impulseY) - (ANCHOR_AY * impulseX)));
+
+    velocityB.LinearX = velocityB.LinearX + (INVERSE_MASS_B * impulseX);
+    velocityB.LinearY = velocityB.LinearY + (INVERSE_MASS_B * impulseY);
+    velocityB.Angular =
+        velocityB.Angular + (INVERSE_INERTIA_B * ((ANCHOR_BX * impulseY) - (ANCHOR_BY * impulseX)));
+}
+
+// Relative velocity of B with respect to A at the anchors
+void ComputeRelativeVelocity(const SContactBatchPoint2D& point, const SWideBodyVelocity2D& velocityA,
+                             const SWideBodyVelocity2D& velocityB, SWideFloat2D& outX, SWideFloat2D& outY)
+{
+    // v + w x r = (vx - w * ry, vy + w * rx)
+    outX = (velocityB.LinearX - (velocityB.Angular * WideLoad(point.AnchorBY))) -
+           (velocityA.LinearX - (velocityA.Angular * WideLoad(point.AnchorAY)));
+    outY = (velocityB.LinearY + (velocityB.Angular * WideLoad(point.AnchorBX))) -
+           (velocityA.LinearY + (velocityA.Angular * WideLoad(point.AnchorAX)));
+}
+
+void SolveBatch(SContactBatch2D& batch, std::span<SSolverBody2D> solverBodies)
+{
+    SWideBodyVelocity2D velocityA = GatherVelocities(solverBodies, batch.BodyA);
+    SWideBodyVelocity2D velocityB = GatherVelocities(solverBodies, batch.BodyB);
+
+    const SWideFloat2D ZERO = WideSplat(0.0F);
+    const SWideFloat2D NORMAL_X = WideLoad(batch.NormalX);
+    const SWideFloat2D NORMAL_Y = WideLoad(batch.NormalY);
+
+    // 1. 法向：累积冲量不小于0
+    for (auto& point : batch.Points)
+    {
+        SWideFloat2D relativeX;
+        SWideFloat2D relativeY;
+        ComputeRelativeVelocity(point, velocityA, velocityB, relativeX, relativeY);
+
+        const SWideFloat2D NORMAL_VELOCITY = (relativeX * NORMAL_X) + (relativeY * NORMAL_Y);
+
+        const SWideFloat2D OLD_IMPULSE = WideLoad(point.NormalImpulse);
+        const SWideFloat2D NEW_IMPULSE =
+            WideMax(OLD_IMPULSE + (WideLoad(point.NormalMass) * (WideLoad(point.Bias) - NORMAL_VELOCITY)), ZERO);
+        WideStore(point.NormalImpulse, NEW_IMPULSE);
+
+        const SWideFloat2D LAMBDA = NEW_IMPULSE - OLD_IMPULSE;
+        ApplyImpulse(batch, point, LAMBDA * NORMAL_X, LAMBDA * NORMAL_Y, velocityA, velocityB);
+    }
+
+    // 2. 切向：库仑摩擦，限制在 [-Friction * NormalImpulse, Friction * NormalImpulse]
+    const SWideFloat2D FRICTION = WideLoad(batch.Friction);
+    const SWideFloat2D TANGENT_X = NORMAL_Y;
+    const SWideFloat2D TANGENT_Y = ZERO - NORMAL_X;
+
+    for (auto& point : batch.Points)
+    {
+        SWideFloat2D relativeX;
+        SWideFloat2D relativeY;
+        ComputeRelativeVelocity(point, velocityA, velocityB, relativeX, relativeY);
+
+        const SWideFloat2D TANGENT_VELOCITY = (relativeX * TANGENT_X) + (relativeY * TANGENT_Y);
+        const SWideFloat2D MAX_FRICTION = FRICTION * WideLoad(point.NormalImpulse);
+
+        const SWideFloat2D OLD_IMPULSE = WideLoad(point.TangentImpulse);
+        const SWideFloat2D NEW_IMPULSE =
+            WideMin(WideMax(OLD_IMPULSE - (WideLoad(point.TangentMass) * TANGENT_VELOCITY), ZERO - MAX_FRICTION),
+                    MAX_FRICTION);
+        WideStore(point.TangentImpulse, NEW_IMPULSE);
+
+        const SWideFloat2D LAMBDA = NEW_IMPULSE - OLD_IMPULSE;
+        ApplyImpulse(batch, point, LAMBDA * TANGENT_X, LAMBDA * TANGENT_Y, velocityA, velocityB);
+    }
+
+    ScatterVelocities(solverBodies, batch.BodyA, velocityA);
+    ScatterVelocities(solverBodies, batch.BodyB, velocityB);
+}
+
+void WarmStartBatch(const SContactBatch2D& batch, std::span<SSolverBody2D> solverBodies)
+{
+    SWideBodyVelocity2D velocityA = GatherVelocities(solverBodies, batch.BodyA);
+    SWideBodyVelocity2D velocityB = GatherVelocities(solverBodies, batch.BodyB);
+
+    const SWideFloat2D NORMAL_X = WideLoad(batch.NormalX);
+    const SWideFloat2D NORMAL_Y = WideLoad(batch.NormalY);
+
+    for (const auto& point : batch.Points)
+    {
+        const SWideFloat2D NORMAL_IMPULSE = WideLoad(point.NormalImpulse);
+        const SWideFloat2D TANGENT_IMPULSE = WideLoad(point.TangentImpulse);
+
+        // P = Pn * n + Pt * t，t = (n.y, -n.x)
+        const SWideFloat2D IMPULSE_X = (NORMAL_IMPULSE * NORMAL_X) + (TANGENT_IMPULSE * NORMAL_Y);
+        const SWideFloat2D IMPULSE_Y = (NORMAL_IMPULSE * NORMAL_Y) - (TANGENT_IMPULSE * NORMAL_X);
+
+        ApplyImpulse(batch, point, IMPULSE_X, IMPULSE_Y, velocityA, velocityB);
+    }
+
+    ScatterVelocities(solverBodies, batch.BodyA, velocityA);
+    ScatterVelocities(solverBodies, batch.BodyB, velocityB);
+}
+
+// Relative velocity of a joint row: d . (vB - vA) + AngularB * wB - AngularA * wA
+SWideFloat2D ComputeRowVelocity(const SJointBatchRow2D& row, const SWideBodyVelocity2D& velocityA,
+                                const SWideBodyVelocity2D& velocityB)
+{
+    return (WideLoad(row.DirectionX) * (velocityB.LinearX - velocityA.LinearX)) +
+           (WideLoad(row.DirectionY) * (velocityB.LinearY - velocityA.LinearY)) +
+           (WideLoad(row.AngularB) * velocityB.Angular) - (WideLoad(row.AngularA) * velocityA.Angular);
+}
+
+// Apply the impulse of a joint row: A receives it negated
+void ApplyRowImpulse(const SJointBatch2D& batch, const SJointBatchRow2D& row, SWideFloat2D impulse,
+                     SWideBodyVelocity2D& velocityA, SWideBodyVelocity2D& velocityB)
+{
+    const SWideFloat2D INVERSE_MASS_A = WideLoad(batch.InverseMassA);
+    const SWideFloat2D INVERSE_MASS_B = WideLoad(batch.InverseMassB);
+
+    const SWideFloat2D IMPULSE_X = WideLoad(row.DirectionX) * impulse;
+    const SWideFloat2D IMPULSE_Y = WideLoad(row.DirectionY) * impulse;
+
+    velocityA.LinearX = velocityA.LinearX - (INVERSE_MASS_A * IMPULSE_X);
+    velocityA.LinearY = velocityA.LinearY - (INVERSE_MASS_A * IMPULSE_Y);
+    velocityA.Angular = velocityA.Angular - (WideLoad(batch.InverseInertiaA) * WideLoad(row.AngularA) * impulse);
+
+    velocityB.LinearX = velocityB.LinearX + (INVERSE_MASS_B * IMPULSE_X);
+    velocityB.LinearY = velocityB.LinearY + (INVERSE_MASS_B * IMPULSE_Y);
+    velocityB.Angular = velocityB.Angular + (WideLoad(batch.InverseInertiaB) * WideLoad(row.AngularB) * impulse);
+}
+
+// 关节的行是等式约束，冲量不做限制；各行依次求解(Gauss-Seidel)
+void SolveJointBatch(SJointBatch2D& batch, std::span<SSolverBody2D> solverBodies)
+{
+    SWideBodyVelocity2D velocityA = GatherVelocities(solverBodies, batch.BodyA);
+    SWideBodyVelocity2D velocityB = GatherVelocities(solverBodies, batch.BodyB);
+
+    for (auto& row : batch.Rows)
+    {
+        const SWideFloat2D VELOCITY = ComputeRowVelocity(row, velocityA, velocityB);
+        const SWideFloat2D LAMBDA = WideLoad(row.Mass) * (WideLoad(row.Bias) - VELOCITY);
+        WideStore(row.Impulse, WideLoad(row.Impulse) + LAMBDA);
+
+        ApplyRowImpulse(batch, row, LAMBDA, velocityA, velocityB);
+    }
+
+    ScatterVelocities(solverBodies, batch.BodyA, velocityA);
+    ScatterVelocities(solverBodies, batch.BodyB, velocityB);
+}
+
+void WarmStartJointBatch(const SJointBatch2D& batch, std::span<SSolverBody2D> solverBodies)
+{
+    SWideBodyVelocity2D velocityA = GatherVelocities(solverBodies, batch.BodyA);
+    SWideBodyVelocity2D velocityB = GatherVelocities(solverBodies, batch.BodyB);
+
+    for (const auto& row : batch.Rows)
+    {
+        ApplyRowImpulse(batch, row, WideLoad(row.Impulse), velocityA, velocityB);
+    }
+
+    ScatterVelocities(solverBodies, batch.BodyA, velocityA);
+    ScatterVelocities(solverBodies, batch.BodyB, velocityB);
+}
+
+} // namespace
+
+void CContactSolver2D::Prepare(std::span<const SContactManifold2D> manifolds,
+                               std::span<const uint32_t> manifoldIndices, const CJointStorage2D& joints,
+                               std::span<const uint32_t> jointIndices, std::span<const SColliderRecord2D> colliders,
+                               const TComponentStorage2D<SRigidBodyComponent2D>& bodies,
+                               std::span<const SSolverBody2D> solverBodies, float friction, float restitution,
+                               float timeStep)
+{
+    const auto     DUMMY_BODY = static_cast<uint32_t>(solverBodies.size() - 1);
+    const float    INVERSE_TIME_STEP = timeStep > 0.0F ? 1.0F / timeStep : 0.0F;
+    const uint32_t MANIFOLD_COUNT = static_cast<uint32_t>(manifoldIndices.size());
+    const uint32_t CONSTRAINT_COUNT = MANIFOLD_COUNT + static_cast<uint32_t>(jointIndices.size());
+
+    // 1. 查找每个约束的两个求解刚体：先是流形(按 manifoldIndices 中的位置编号)，然后是关节
+    ConstraintBodies.resize(CONSTRAINT_COUNT);
+    ColoringBodies.resize(CONSTRAINT_COUNT);
+
+    const auto TO_SOLVER_BODY = [&](BodyIndexType bodyIndex) {
+        const size_t DENSE_INDEX = bodies.GetDenseIndex(bodyIndex);
+        return DENSE_INDEX < DUMMY_BODY ? static_cast<uint32_t>(DENSE_INDEX) : DUMMY_BODY;
+    };
+
+    const auto JOINT_BODIES_A = joints.GetBodiesA();
+    const auto JOINT_BODIES_B = joints.GetBodiesB();
+
+    for (uint32_t index = 0; index < CONSTRAINT_COUNT; ++index)
+    {
+        uint32_t bodyA = DUMMY_BODY;
+        uint32_t bodyB = DUMMY_BODY;
+
+        if (index < MANIFOLD_COUNT)
+        {
+            const SContactManifold2D& manifold = manifolds[manifoldIndices[index]];
+            bodyA = TO_SOLVER_BODY(colliders[manifold.ColliderA].BodyIndex);
+            bodyB = TO_SOLVER_BODY(colliders[manifold.ColliderB].BodyIndex);
+        }
+        else
+        {
+            // 岛屿只包含两个刚体都存在的关节(见 CPhysicsWorld2D::UpdateIslands)，槽位号即对应正确的刚体
+            const uint32_t JOINT = jointIndices[index - MANIFOLD_COUNT];
+            bodyA = TO_SOLVER_BODY(JOINT_BODIES_A[JOINT].Index);
+            bodyB = TO_SOLVER_BODY(JOINT_BODIES_B[JOINT].Index);
+        }
+
+        ConstraintBodies[index] = {bodyA, bodyB};
+        ColoringBodies[index] = {solverBodies[bodyA].IsMovable() ? bodyA : STATIC_SOLVER_BODY_2D,
+                                 solverBodies[bodyB].IsMovable() ? bodyB : STATIC_SOLVER_BODY_2D};
+    }
+
+    // 2. 流形与关节一起着色，每种颜色先打包流形再打包关节，溢出的约束每个单独一批
+    Graph.Build(ColoringBodies, DUMMY_BODY);
+
+    Batches.clear();
+    JointBatches.clear();
+    const auto BODY_COMPONENTS = bodies.GetComponents();
+
+    for (uint32_t color = 0; color < MAX_GRAPH_COLORS_2D; ++color)
+    {
+        ContactBatchStarts[color] = static_cast<uint32_t>(Batches.size());
+        JointBatchStarts[color] = static_cast<uint32_t>(JointBatches.size());
+
+        // 颜色内的约束按编号递增，流形在前
+        const auto   COLOR = Graph.GetColor(color);
+        const size_t CONTACT_COUNT =
+            static_cast<size_t>(std::lower_bound(COLOR.begin(), COLOR.end(), MANIFOLD_COUNT) - COLOR.begin());
+
+        for (size_t begin = 0; begin < CONTACT_COUNT; begin += SIMD_WIDTH_2D)
+        {
+            const size_t COUNT = BE::Math::Min(CONTACT_COUNT - begin, static_cast<size_t>(SIMD_WIDTH_2D));
+            AddBatch(COLOR.subspan(begin, COUNT), manifolds, manifoldIndices, BODY_COMPONENTS, solverBodies,
+                     friction, restitution, INVERSE_TIME_STEP);
+        }
+
+        for (size_t begin = CONTACT_COUNT; begin < COLOR.size(); begin += SIMD_WIDTH_2D)
+        {
+            const size_t COUNT = BE::Math::Min(COLOR.size() - begin, static_cast<size_t>(SIMD_WIDTH_2D));
+            AddJointBatch(COLOR.subspan(begin, COUNT), joints, jointIndices, MANIFOLD_COUNT, BODY_COMPONENTS,
+                          solverBodies, INVERSE_TIME_STEP);
+        }
+    }
+
+    ContactBatchStarts[MAX_GRAPH_COLORS_2D] = static_cast<uint32_t>(Batches.size());
+    JointBatchStarts[MAX_GRAPH_COLORS_2D] = static_cast<uint32_t>(JointBatches.size());
+
+    const auto OVERFLOW = Graph.GetOverflow();
+    for (size_t index = 0; index < OVERFLOW.size(); ++index)
+    {
+        if (OVERFLOW[index] < MANIFOLD_COUNT)
+        {
+            AddBatch(OVERFLOW.subspan(index, 1), manifolds, manifoldIndices, BODY_COMPONENTS, solverBodies, friction,
+                     restitution, INVERSE_TIME_STEP);
+        }
+        else
+        {
+            AddJointBatch(OVERFLOW.subspan(index, 1), joints, jointIndices, MANIFOLD_COUNT, BODY_COMPONENTS,
+                          solverBodies, INVERSE_TIME_STEP);
+        }
+    }
+
+    ContactBatchStarts[MAX_GRAPH_COLORS_2D + 1] = static_cast<uint32_t>(Batches.size());
+    JointBatchStarts[MAX_GRAPH_COLORS_2D + 1] = static_cast<uint32_t>(JointBatches.size());
+}
+
+template <typename TFunction>
+void CContactSolver2D::ForEachBatchRange(uint32_t begin, uint32_t end, TFunction&& function) const
+{
+    for (uint32_t color = 0; color <= MAX_GRAPH_COLORS_2D && begin < end; ++color)
+    {
+        const auto     RANGE = GetColorBatches(color);
+        const uint32_t RANGE_END = std::min(end, RANGE.second);
+        if (begin >= RANGE_END)
+        {
+            continue;
+        }
+
+        // 颜色内先是接触批次，再是关节批次
+        const uint32_t JOINT_BEGIN = RANGE.first + (ContactBatchStarts[color + 1] - ContactBatchStarts[color]);
+        const uint32_t CONTACT_END = std::min(RANGE_END, JOINT_BEGIN);
+        const uint32_t JOINT_START = std::max(begin, JOINT_BEGIN);
+
+        function(std::min(begin, CONTACT_END) - JointBatchStarts[color], CONTACT_END - JointBatchStarts[color],
+                 std::min(JOINT_START, RANGE_END) - ContactBatchStarts[color + 1],
+                 RANGE_END - ContactBatchStarts[color + 1]);
+
+        begin = RANGE_END;
+    }
+}
+
+void CContactSolver2D::WarmStart(std::span<SSolverBody2D> solverBodies) const
+{
+    WarmStartBatches(solverBodies, 0, static_cast<uint32_t>(GetBatchCount()));
+}
+
+void CContactSolver2D::SolveVelocities(std::span<SSolverBody2D> solverBodies)
+{
+    SolveBatches(solverBodies, 0, static_cast<uint32_t>(GetBatchCount()));
+}
+
+void CContactSolver2D::WarmStartBatches(std::span<SSolverBody2D> solverBodies, uint32_t begin, uint32_t end) const
+{
+    ForEachBatchRange(begin, end,
+                      [&](uint32_t contactBegin, uint32_t contactEnd, uint32_t jointBegin, uint32_t jointEnd)
+                      {
+                          for (uint32_t index = contactBegin; index < contactEnd; ++index)
+                          {
+                              WarmStartBatch(Batches[index], solverBodies);
+                          }
+
+                          for (uint32_t index = jointBegin; index < jointEnd; ++index)
+                          {
+                              WarmStartJointBatch(JointBatches[index], solverBodies);
+                          }
+                      });
+}
+
+void CContactSolver2D::SolveBatches(std::span<SSolverBody2D> solverBodies, uint32_t begin, uint32_t end)
+{
+    ForEachBatchRange(begin, end,
+                      [&](uint32_t contactBegin, uint32_t contactEnd, uint32_t jointBegin, uint32_t jointEnd)
+                      {
+                          for (uint32_t index = contactBegin; index < contactEnd; ++index)
+                          {
+                              SolveBatch(Batches[index], solverBodies);
+                          }
+
+                          for (uint32_t index = jointBegin; index < jointEnd; ++index)
+                          {
+                              SolveJointBatch(JointBatches[index], solverBodies);
+                          }
+                      });
+}
+
+void CContactSolver2D::StoreImpulses(std::span<SContactManifold2D> manifolds, CJointStorage2D& joints) const
+{
+    for (const auto& batch : Batches)
+    {
+        for (uint32_t lane = 0; lane < SIMD_WIDTH_2D; ++lane)
+        {
+            const uint32_t MANIFOLD_INDEX = batch.ManifoldIndex[lane];
+            if (MANIFOLD_INDEX == INVALID_MANIFOLD_INDEX)
+            {
+                continue;
+            }
+
+            SContactManifold2D& manifold = manifolds[MANIFOLD_INDEX];
+            for (uint32_t index = 0; index < manifold.PointCount; ++index)
+            {
+                manifold.Points[index].NormalImpulse = batch.Points[index].NormalImpulse[lane];
+                manifold.Points[index].TangentImpulse = batch.Points[index].TangentImpulse[lane];
+            }
+        }
+    }
+
+    for (const auto& batch : JointBatches)
+    {
+        for (uint32_t lane = 0; lane < SIMD_WIDTH_2D; ++lane)
+        {
+            const uint32_t JOINT_INDEX = batch.JointIndex[lane];
+            if (JOINT_INDEX == INVALID_JOINT_ID)
+            {
+                continue;
+            }
+
+            for (uint32_t row = 0; row < MAX_JOINT_ROWS_2D; ++row)
+            {
+                joints.GetImpulses(row)[JOINT_INDEX] = batch.Rows[row].Impulse[lane];
+            }
+        }
+    }
+}
+
+uint32_t CContactSolver2D::GetActiveColorCount() const
+{
+    return Graph.GetActiveColorCount();
+}
+
+std::pair<uint32_t, uint32_t> CContactSolver2D::GetColorBatches(uint32_t color) const
+{
+    return {ContactBatchStarts[color] + JointBatchStarts[color],
+            ContactBatchStarts[color + 1] + JointBatchStarts[color + 1]};
+}
+
+size_t CContactSolver2D::GetBatchCount() const
+{
+    return Batches.size() + JointBatches.size();
+}
+
+size_t CContactSolver2D::GetJointBatchCount() const
+{
+    return JointBatches.size();
+}
+
+size_t CContactSolver2D::GetOverflowCount() const
+{
+    return Graph.GetOverflow().size();
+}
+
+void CContactSolver2D::AddBatch(std::span<const uint32_t> constraints,
+                                std::span<const SContactManifold2D> manifolds,
+                                std::span<const uint32_t> manifoldIndices,
+                                std::span<const SRigidBodyComponent2D> bodies,
+                                std::span<const SSolverBody2D> solverBodies, float friction, float restitution,
+                                float inverseTimeStep)
+{
+    const auto DUMMY_BODY = static_cast<uint32_t>(solverBodies.size() - 1);
+
+    // 值初始化：未使用的通道质量为0，不产生冲量
+    SContactBatch2D& batch = Batches.emplace_back();
+    batch.BodyA.fill(DUMMY_BODY);
+    batch.BodyB.fill(DUMMY_BODY);
+    batch.ManifoldIndex.fill(INVALID_MANIFOLD_INDEX);
+
+    for (uint32_t lane = 0; lane < constraints.size(); ++lane)
+    {
+        const uint32_t            MANIFOLD_INDEX = manifoldIndices[constraints[lane]];
+        const SContactManifold2D& manifold = manifolds[MANIFOLD_INDEX];
+        const SConstraintBodies2D BODIES = ConstraintBodies[constraints[lane]];
+
+        const SSolverBody2D& solverBodyA = solverBodies[BODIES.BodyA];
+        const SSolverBody2D& solverBodyB = solverBodies[BODIES.BodyB];
+
+        // 虚拟刚体位于原点
+        const SVector2F CENTER_A = BODIES.BodyA < DUMMY_BODY ? bodies[BODIES.BodyA].Position : SVector2F(0.0F);
+        const SVector2F CENTER_B = BODIES.BodyB < DUMMY_BODY ? bodies[BODIES.BodyB].Position : SVector2F(0.0F);
+
+        batch.BodyA[lane] = BODIES.BodyA;
+        batch.BodyB[lane] = BODIES.BodyB;
+        batch.ManifoldIndex[lane] = MANIFOLD_INDEX;
+
+        const SVector2F& normal = manifold.Normal;
+        const SVector2F  TANGENT(normal.Y, -normal.X);
+
+        batch.NormalX[lane] = normal.X;
+        batch.NormalY[lane] = normal.Y;
+        batch.Friction[lane] = friction;
+
+        const float INVERSE_MASS_A = solverBodyA.InverseMass;
+        const float INVERSE_INERTIA_A = solverBodyA.InverseInertia;
+        const float INVERSE_MASS_B = solverBodyB.InverseMass;
+        const float INVERSE_INERTIA_B = solverBodyB.InverseInertia;
+
+        batch.InverseMassA[lane] = INVERSE_MASS_A;
+        batch.InverseInertiaA[lane] = INVERSE_INERTIA_A;
+        batch.InverseMassB[lane] = INVERSE_MASS_B;
+        batch.InverseInertiaB[lane] = INVERSE_INERTIA_B;
+
+        for (uint32_t index = 0; index < manifold.PointCount; ++index)
+        {
+            const SContactPoint2D& contact = manifold.Points[index];
+            SContactBatchPoint2D&  point = batch.Points[index];
+
+            const SVector2F ANCHOR_A = contact.Position - CENTER_A;
+            const SVector2F ANCHOR_B = contact.Position - CENTER_B;
+
+            point.AnchorAX[lane] = ANCHOR_A.X;
+            point.AnchorAY[lane] = ANCHOR_A.Y;
+            point.AnchorBX[lane] = ANCHOR_B.X;
+            point.AnchorBY[lane] = ANCHOR_B.Y;
+
+            // 有效质量 K = mA + mB + iA * (rA x d)^2 + iB * (rB x d)^2
+            const float RN_A = ANCHOR_A ^ normal;
+            const float RN_B = ANCHOR_B ^ normal;
+            const float NORMAL_K = INVERSE_MASS_A + INVERSE_MASS_B + (INVERSE_INERTIA_A * RN_A * RN_A) +
+                                   (INVERSE_INERTIA_B * RN_B * RN_B);
+
+            const float RT_A = ANCHOR_A ^ TANGENT;
+            const float RT_B = ANCHOR_B ^ TANGENT;
+            const float TANGENT_K = INVERSE_MASS_A + INVERSE_MASS_B + (INVERSE_INERTIA_A * RT_A * RT_A) +
+                                    (INVERSE_INERTIA_B * RT_B * RT_B);
+
+            point.NormalMass[lane] = NORMAL_K > 0.0F ? 1.0F / NORMAL_K : 0.0F;
+            point.TangentMass[lane] = TANGENT_K > 0.0F ? 1.0F / TANGENT_K : 0.0F;
+
+            point.NormalImpulse[lane] = contact.NormalImpulse;
+            point.TangentImpulse[lane] = contact.TangentImpulse;
+
+            // 推测接触允许在本步内闭合间隙，穿透超过容差的部分按 Baumgarte 系数推开
+            const float SEPARATION = contact.Separation;
+            float       bias = 0.0F;
+            if (SEPARATION > 0.0F)
+            {
+                bias = -SEPARATION * inverseTimeStep;
+            }
+            else
+            {
+                bias = BE::Math::Min(CONTACT_BAUMGARTE_2D * inverseTimeStep *
+                                         BE::Math::Max(-(SEPARATION + LINEAR_SLOP_2D), 0.0F),
+                                     MAX_CONTACT_CORRECTION_VELOCITY_2D);
+            }
+
+            // 恢复系数：以求解前的接近速度为目标反弹速度
+            const SVector2F RELATIVE_VELOCITY =
+                (solverBodyB.LinearVelocity +
+                 SVector2F(-solverBodyB.AngularVelocity * ANCHOR_B.Y, solverBodyB.AngularVelocity * ANCHOR_B.X)) -
+                (solverBodyA.LinearVelocity +
+                 SVector2F(-solverBodyA.AngularVelocity * ANCHOR_A.Y, solverBodyA.AngularVelocity * ANCHOR_A.X));
+            const float APPROACH_VELOCITY = RELATIVE_VELOCITY | normal;
+
+            if (restitution > 0.0F && APPROACH_VELOCITY < -RESTITUTION_VELOCITY_THRESHOLD_2D)
+            {
+                bias = BE::Math::Max(bias, -restitution * APPROACH_VELOCITY);
+            }
+
+            point.Bias[lane] = bias;
+        }
+    }
+}
+
+void CContactSolver2D::AddJointBatch(std::span<const uint32_t> constraints, const CJointStorage2D& joints,
+                                     std::span<const uint32_t> jointIndices, uint32_t manifoldCount,
+                                     std::span<const SRigidBodyComponent2D> bodies,
+                                     std::span<const SSolverBody2D> solverBodies, float inverseTimeStep)
+{
+    const auto DUMMY_BODY = static_cast<uint32_t>(solverBodies.size() - 1);
+
+    // 值初始化：未使用的通道与行质量为0，不产生冲量
+    SJointBatch2D& batch = JointBatches.emplace_back();
+    batch.BodyA.fill(DUMMY_BODY);
+    batch.BodyB.fill(DUMMY_BODY);
+    batch.JointIndex.fill(INVALID_JOINT_ID);
+
+    const SVector2F AXIS_X(1.0F, 0.0F);
+    const SVector2F AXIS_Y(0.0F, 1.0F);
+    const SVector2F NO_DIRECTION(0.0F);
+
+    for (uint32_t lane = 0; lane < constraints.size(); ++lane)
+    {
+        const uint32_t            JOINT = jointIndices[constraints[lane] - manifoldCount];
+        const SConstraintBodies2D BODIES = ConstraintBodies[constraints[lane]];
+
+        const SSolverBody2D& solverBodyA = solverBodies[BODIES.BodyA];
+        const SSolverBody2D& solverBodyB = solverBodies[BODIES.BodyB];
+
+        batch.BodyA[lane] = BODIES.BodyA;
+        batch.BodyB[lane] = BODIES.BodyB;
+        batch.JointIndex[lane] = JOINT;
+
+        const float INVERSE_MASS_A = solverBodyA.InverseMass;
+        const float INVERSE_INERTIA_A = solverBodyA.InverseInertia;
+        const float INVERSE_MASS_B = solverBodyB.InverseMass;
+        const float INVERSE_INERTIA_B = solverBodyB.InverseInertia;
+
+        batch.InverseMassA[lane] = INVERSE_MASS_A;
+        batch.InverseInertiaA[lane] = INVERSE_INERTIA_A;
+        batch.InverseMassB[lane] = INVERSE_MASS_B;
+        batch.InverseInertiaB[lane] = INVERSE_INERTIA_B;
+
+        // 虚拟刚体位于原点
+        const SPose2D POSE_A = BODIES.BodyA < DUMMY_BODY
+                                   ? SPose2D(bodies[BODIES.BodyA].Position, bodies[BODIES.BodyA].Rotation)
+                                   : SPose2D();
+        const SPose2D POSE_B = BODIES.BodyB < DUMMY_BODY
+                                   ? SPose2D(bodies[BODIES.BodyB].Position, bodies[BODIES.BodyB].Rotation)
+                                   : SPose2D();
+
+        // B 相对 A 的转角
+        const float ANGLE = (BODIES.BodyB < DUMMY_BODY ? bodies[BODIES.BodyB].Rotation : 0.0F) -
+                            (BODIES.BodyA < DUMMY_BODY ? bodies[BODIES.BodyA].Rotation : 0.0F);
+
+        const SVector2F ANCHOR_A = POSE_A.Rotate(joints.GetLocalAnchorsA()[JOINT]);
+        const SVector2F ANCHOR_B = POSE_B.Rotate(joints.GetLocalAnchorsB()[JOINT]);
+
+        // 从A的锚点指向B的锚点
+        const SVector2F SEPARATION = (POSE_B.Position + ANCHOR_B) - (POSE_A.Position + ANCHOR_A);
+
+        // 有效质量 K = (mA + mB) * |d|^2 + iA * aA^2 + iB * aB^2，偏置速度消除 JOINT_BAUMGARTE_2D 的位置误差
+        const auto SET_ROW = [&](uint32_t rowIndex, const SVector2F& direction, float angularA, float angularB,
+                                 float positionError)
+        {
+            SJointBatchRow2D& row = batch.Rows[rowIndex];
+
+            const float K = ((INVERSE_MASS_A + INVERSE_MASS_B) * (direction | direction)) +
+                            (INVERSE_INERTIA_A * angularA * angularA) + (INVERSE_INERTIA_B * angularB * angularB);
+
+            row.DirectionX[lane] = direction.X;
+            row.DirectionY[lane] = direction.Y;
+            row.AngularA[lane] = angularA;
+            row.AngularB[lane] = angularB;
+            row.Mass[lane] = K > 0.0F ? 1.0F / K : 0.0F;
+            row.Bias[lane] = -JOINT_BAUMGARTE_2D * inverseTimeStep * positionError;
+            row.Impulse[lane] = joints.GetImpulses(rowIndex)[JOINT];
+        };
+
+        switch (joints.GetTypes()[JOINT])
+        {
+        case EJointType2D::Distance:
+        {
+            // 两个锚点重合时方向不确定，本步不约束
+            const float LENGTH = SEPARATION.Magnitude();
+            if (LENGTH > 0.0F)
+            {
+                const SVector2F DIRECTION = SEPARATION * (1.0F / LENGTH);
+                SET_ROW(0, DIRECTION, ANCHOR_A ^ DIRECTION, ANCHOR_B ^ DIRECTION,
+                        LENGTH - joints.GetLengths()[JOINT]);
+            }
+            break;
+        }
+        case EJointType2D::Revolute:
+            SET_ROW(0, AXIS_X, ANCHOR_A ^ AXIS_X, ANCHOR_B ^ AXIS_X, SEPARATION.X);
+            SET_ROW(1, AXIS_Y, ANCHOR_A ^ AXIS_Y, ANCHOR_B ^ AXIS_Y, SEPARATION.Y);
+            break;
+        case EJointType2D::Prismatic:
+        {
+            // 轴固定在A上，A转动时轴也转动：A的力臂取到B的锚点(rA + 间距)
+            const SVector2F AXIS = POSE_A.Rotate(joints.GetLocalAxes()[JOINT]);
+            const SVector2F NORMAL(-AXIS.Y, AXIS.X);
+            SET_ROW(0, NORMAL, (ANCHOR_A + SEPARATION) ^ NORMAL, ANCHOR_B ^ NORMAL, SEPARATION | NORMAL);
+            SET_ROW(1, NO_DIRECTION, 1.0F, 1.0F, ANGLE - joints.GetReferenceAngles()[JOINT]);
+            break;
+        }
+        case EJointType2D::Weld:
+            SET_ROW(0, AXIS_X, ANCHOR_A ^ AXIS_X, ANCHOR_B ^ AXIS_X, SEPARATION.X);
+            SET_ROW(1, AXIS_Y, ANCHOR_A ^ AXIS_Y, ANCHOR_B ^ AXIS_Y, SEPARATION.Y);
+            SET_ROW(2, NO_DIRECTION, 1.0F, 1.0F, ANGLE - joints.GetReferenceAngles()[JOINT]);
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+NAMESPACE_END() // namespace PHYE::Physics2D
@@ -0,0 +1,147 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#include <Rigid2D/RigidBody2D/RigidBodyComponent2D.hpp>
+#include <Solver2D/IslandBuilder2D.hpp>
+#include <numeric>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+void CIslandBuilder2D::Build(std::span<const SConstraintBodies2D> constraints,
+                             std::span<const SRigidBodyComponent2D> bodies)
+{
+    const auto BODY_COUNT = static_cast<uint32_t>(bodies.size());
+
+    // 1. 合并：每个连接两个 Dynamic 刚体的约束把它们并入同一棵树
+    Parents.resize(BODY_COUNT);
+    std::iota(Parents.begin(), Parents.end(), 0U);
+
+    for (const auto& constraint : constraints)
+    {
+        if (constraint.BodyA != STATIC_SOLVER_BODY_2D && constraint.BodyB != STATIC_SOLVER_BODY_2D)
+        {
+            Link(constraint.BodyA, constraint.BodyB);
+        }
+    }
+
+    // 2. 编号：按根节点首次出现的顺序分配岛屿，并统计每个岛屿的刚体数
+    Islands.clear();
+    BodyIslands.assign(BODY_COUNT, INVALID_ISLAND_2D);
+
+    for (uint32_t body = 0; body < BODY_COUNT; ++body)
+    {
+        if (bodies[body].Type == PHYE::PhysicsBase::ERigidBodyType::Static)
+        {
+            continue;
+        }
+
+        // 根节点是树中索引最小的刚体，总是先于树中其它刚体被访问
+        const uint32_t ROOT = FindRoot(body);
+        if (ROOT == body)
+        {
+            BodyIslands[body] = static_cast<uint32_t>(Islands.size());
+            Islands.emplace_back();
+        }
+        else
+        {
+            BodyIslands[body] = BodyIslands[ROOT];
+        }
+
+        ++Islands[BodyIslands[body]].BodyCount;
+    }
+
+    // 3. 约束归入其 Dynamic 一侧刚体所在的岛屿，两侧都不是 Dynamic 的约束不属于任何岛屿
+    ConstraintIslands.resize(constraints.size());
+
+    for (size_t index = 0; index < constraints.size(); ++index)
+    {
+        const SConstraintBodies2D& constraint = constraints[index];
+        const uint32_t BODY = constraint.BodyA != STATIC_SOLVER_BODY_2D ? constraint.BodyA : constraint.BodyB;
+
+        ConstraintIslands[index] = BODY != STATIC_SOLVER_BODY_2D ? BodyIslands[BODY] : INVALID_ISLAND_2D;
+        if (ConstraintIslands[index] != INVALID_ISLAND_2D)
+        {
+            ++Islands[ConstraintIslands[index]].ConstraintCount;
+        }
+    }
+
+    // 4. 计数排序：按岛屿分组刚体与约束
+    uint32_t bodyStart = 0;
+    uint32_t constraintStart = 0;
+    for (auto& island : Islands)
+    {
+        island.BodyStart = bodyStart;
+        island.ConstraintStart = constraintStart;
+        bodyStart += island.BodyCount;
+        constraintStart += island.ConstraintCount;
+
+        island.BodyCount = 0;
+        island.ConstraintCount = 0;
+    }
+
+    IslandBodies.resize(bodyStart);
+    for (uint32_t body = 0; body < BODY_COUNT; ++body)
+    {
+        if (BodyIslands[body] != INVALID_ISLAND_2D)
+        {
+            SIsland2D& island = Islands[BodyIslands[body]];
+            IslandBodies[island.BodyStart + island.BodyCount++] = body;
+        }
+    }
+
+    IslandConstraints.resize(constraintStart);
+    for (size_t index = 0; index < constraints.size(); ++index)
+    {
+        if (ConstraintIslands[index] != INVALID_ISLAND_2D)
+        {
+            SIsland2D& island = Islands[ConstraintIslands[index]];
+            IslandConstraints[island.ConstraintStart + island.ConstraintCount++] = static_cast<uint32_t>(index);
+        }
+    }
+}
+
+std::span<const uint32_t> CIslandBuilder2D::GetIslandBodies(size_t island) const
+{
+    return std::span<const uint32_t>(IslandBodies).subspan(Islands[island].BodyStart, Islands[island].BodyCount);
+}
+
+std::span<const uint32_t> CIslandBuilder2D::GetIslandConstraints(size_t island) const
+{
+    return std::span<const uint32_t>(IslandConstraints)
+        .subspan(Islands[island].ConstraintStart, Islands[island].ConstraintCount);
+}
+
+uint32_t CIslandBuilder2D::FindRoot(uint32_t body)
+{
+    // 路径减半
+    while (Parents[body] != body)
+    {
+        Parents[body] = Parents[Parents[body]];
+        body = Parents[body];
+    }
+
+    return body;
+}
+
+void CIslandBuilder2D::Link(uint32_t bodyA, uint32_t bodyB)
+{
+    const uint32_t ROOT_A = FindRoot(bodyA);
+    const uint32_t ROOT_B = FindRoot(bodyB);
+
+    // 索引较小的根作为新根，使岛屿编号只取决于刚体顺序
+    if (ROOT_A < ROOT_B)
+    {
+        Parents[ROOT_B] = ROOT_A;
+    }
+    else if (ROOT_B < ROOT_A)
+    {
+        Parents[ROOT_A] = ROOT_B;
+    }
+}
+
+NAMESPACE_END() // namespace PHYE::Physics2D
@@ -0,0 +1,220 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#include <MathUtility/MathUtilities.hpp>
+#include <Solver2D/IslandSolver2D.hpp>
+#include <algorithm>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+namespace
+{
+
+/**
+ * @brief One pass(warm start or velocity iteration) over the batches of a solver, color by color.
+ * @details The batches of a color are split over the workers, the overflow batches run on the calling thread.
+ */
+void SolvePassColorParallel(CContactSolver2D& solver, std::span<SSolverBody2D> solverBodies, bool isWarmStart,
+                            BE::Core::CJobSystem& jobSystem)
+{
+    for (uint32_t color = 0; color <= MAX_GRAPH_COLORS_2D; ++color)
+    {
+        const auto     RANGE = solver.GetColorBatches(color);
+        const uint32_t BEGIN = RANGE.first;
+        const uint32_t END = RANGE.second;
+        if (BEGIN == END)
+        {
+            continue;
+        }
+
+        // 溢出组的批次可能写同一个刚体，只能按顺序求解
+        if (color == MAX_GRAPH_COLORS_2D)
+        {
+            if (isWarmStart)
+            {
+                solver.WarmStartBatches(solverBodies, BEGIN, END);
+            }
+            else
+            {
+                solver.SolveBatches(solverBodies, BEGIN, END);
+            }
+            continue;
+        }
+
+        // 同一颜色的批次互不共享刚体，按批次范围交给任务系统拆分
+        jobSystem.ParallelFor(END - BEGIN, SOLVER_BATCHES_PER_JOB_2D,
+                              [&](uint32_t jobBegin, uint32_t jobEnd)
+                              {
+                                  if (isWarmStart)
+                                  {
+                                      solver.WarmStartBatches(solverBodies, BEGIN + jobBegin, BEGIN + jobEnd);
+                                  }
+                                  else
+                                  {
+                                      solver.SolveBatches(solverBodies, BEGIN + jobBegin, BEGIN + jobEnd);
+                                  }
+                              });
+    }
+}
+
+} // namespace
+
+void CIslandSolver2D::Solve(const CIslandBuilder2D& islands, std::span<SContactManifold2D> manifolds,
+                            CJointStorage2D& joints, std::span<const SColliderRecord2D> colliders,
+                            const TComponentStorage2D<SRigidBodyComponent2D>& bodies,
+                            std::span<SSolverBody2D> solverBodies, const SIslandSolverSettings2D& settings,
+                            BE::Core::CJobSystem* jobSystem)
+{
+    const uint32_t THREAD_COUNT = jobSystem != nullptr ? jobSystem->GetWorkerCount() + 1 : 1;
+    BuildTasks(islands, bodies.GetComponents(), static_cast<uint32_t>(manifolds.size()), THREAD_COUNT);
+
+    const auto SOLVE_TASK = [&](uint32_t taskIndex)
+    {
+        SSolverTask2D& task = Tasks[taskIndex];
+        task.Solver.Prepare(manifolds, task.Manifolds, joints, task.Joints, colliders, bodies, solverBodies,
+                            settings.Friction, settings.Restitution, settings.TimeStep);
+
+        // 关闭热启动时缓存为空，流形的累积冲量均为0
+        if (task.IsColorParallel && jobSystem != nullptr)
+        {
+            SolvePassColorParallel(task.Solver, solverBodies, true, *jobSystem);
+            for (uint32_t iteration = 0; iteration < settings.VelocityIterations; ++iteration)
+            {
+                SolvePassColorParallel(task.Solver, solverBodies, false, *jobSystem);
+            }
+        }
+        else
+        {
+            task.Solver.WarmStart(solverBodies);
+            for (uint32_t iteration = 0; iteration < settings.VelocityIterations; ++iteration)
+            {
+                task.Solver.SolveVelocities(solverBodies);
+            }
+        }
+
+        task.Solver.StoreImpulses(manifolds, joints);
+    };
+
+    // 各任务的可移动刚体互不相交，可以同时求解
+    if (jobSystem != nullptr)
+    {
+        jobSystem->ParallelFor(TaskCount, 1,
+                               [&](uint32_t begin, uint32_t end)
+                               {
+                                   for (uint32_t task = begin; task < end; ++task)
+                                   {
+                                       SOLVE_TASK(task);
+                                   }
+                               });
+    }
+    else
+    {
+        for (uint32_t task = 0; task < TaskCount; ++task)
+        {
+            SOLVE_TASK(task);
+        }
+    }
+}
+
+uint32_t CIslandSolver2D::GetTaskCount() const
+{
+    return TaskCount;
+}
+
+const CContactSolver2D& CIslandSolver2D::GetTaskSolver(uint32_t task) const
+{
+    return Tasks[task].Solver;
+}
+
+bool CIslandSolver2D::IsTaskColorParallel(uint32_t task) const
+{
+    return Tasks[task].IsColorParallel;
+}
+
+void CIslandSolver2D::BuildTasks(const CIslandBuilder2D& islands, std::span<const SRigidBodyComponent2D> bodies,
+                                 uint32_t manifoldCount, uint32_t threadCount)
+{
+    // 岛屿中的刚体同时休眠或唤醒，看第一个即可
+    const auto IS_SOLVED = [&](size_t island)
+    {
+        return islands.GetIsland(island).ConstraintCount > 0 &&
+               bodies[islands.GetIslandBodies(island).front()].IsAwake;
+    };
+
+    uint32_t constraintCount = 0;
+    for (size_t island = 0; island < islands.GetIslandCount(); ++island)
+    {
+        constraintCount += IS_SOLVED(island) ? islands.GetIsland(island).ConstraintCount : 0;
+    }
+
+    // 每个线程大约分到4个任务，以便负载不均时可以互相窃取
+    const uint32_t TASK_CONSTRAINTS =
+        BE::Math::Max(MIN_SOLVER_TASK_CONSTRAINTS_2D, constraintCount / (threadCount * 4));
+
+    TaskCount = 0;
+    uint32_t mergedTask = UINT32_MAX;
+
+    for (size_t island = 0; island < islands.GetIslandCount(); ++island)
+    {
+        if (!IS_SOLVED(island))
+        {
+            continue;
+        }
+
+        const auto ISLAND_CONSTRAINTS = islands.GetIslandConstraints(island);
+
+        // 大岛屿单独成为一个任务，并按颜色拆分到多个线程
+        if (ISLAND_CONSTRAINTS.size() > TASK_CONSTRAINTS)
+        {
+            SSolverTask2D& task = AddTask();
+            AddConstraints(task, ISLAND_CONSTRAINTS, manifoldCount);
+            task.IsColorParallel = threadCount > 1;
+            continue;
+        }
+
+        // 小岛屿合并到当前任务，任务足够大后开始新的任务
+        if (mergedTask == UINT32_MAX ||
+            Tasks[mergedTask].Manifolds.size() + Tasks[mergedTask].Joints.size() >= TASK_CONSTRAINTS)
+        {
+            AddTask();
+            mergedTask = TaskCount - 1;
+        }
+
+        AddConstraints(Tasks[mergedTask], ISLAND_CONSTRAINTS, manifoldCount);
+    }
+}
+
+CIslandSolver2D::SSolverTask2D& CIslandSolver2D::AddTask()
+{
+    if (TaskCount == Tasks.size())
+    {
+        Tasks.emplace_back();
+    }
+
+    SSolverTask2D& task = Tasks[TaskCount++];
+    task.Manifolds.clear();
+    task.Joints.clear();
+    task.IsColorParallel = false;
+
+    return task;
+}
+
+void CIslandSolver2D::AddConstraints(SSolverTask2D& task, std::span<const uint32_t> constraints,
+                                     uint32_t manifoldCount)
+{
+    // 岛屿的约束编号中流形在前、关节在后，且按编号递增
+    const auto JOINT_BEGIN = std::lower_bound(constraints.begin(), constraints.end(), manifoldCount);
+
+    task.Manifolds.insert(task.Manifolds.end(), constraints.begin(), JOINT_BEGIN);
+    for (auto constraint = JOINT_BEGIN; constraint != constraints.end(); ++constraint)
+    {
+        task.Joints.push_back(*constraint - manifoldCount);
+    }
+}
+
+NAMESPACE_END() // namespace PHYE::Physics2D
@@ -0,0 +1,51 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#include <Rigid2D/RigidBody2D/RigidBodyComponent2D.hpp>
+#include <Solver2D/SolverBody2D.hpp>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+uint32_t LoadSolverBodies2D(std::span<const SRigidBodyComponent2D> bodies, std::vector<SSolverBody2D>& outSolverBodies)
+{
+    outSolverBodies.resize(bodies.size() + 1);
+
+    for (size_t index = 0; index < bodies.size(); ++index)
+    {
+        const SRigidBodyComponent2D& body = bodies[index];
+        SSolverBody2D&               solverBody = outSolverBodies[index];
+
+        solverBody.LinearVelocity = body.Velocity;
+        solverBody.AngularVelocity = body.AngularVelocity;
+
+        // 只有 Dynamic 刚体会被约束改变速度
+        const bool IS_DYNAMIC = body.Type == PHYE::PhysicsBase::ERigidBodyType::Dynamic;
+        solverBody.InverseMass = IS_DYNAMIC ? body.InverseMass : 0.0F;
+        solverBody.InverseInertia = IS_DYNAMIC ? body.InverseInertia : 0.0F;
+    }
+
+    outSolverBodies.back() = SSolverBody2D();
+
+    return static_cast<uint32_t>(bodies.size());
+}
+
+void StoreSolverBodies2D(std::span<const SSolverBody2D> solverBodies, std::span<SRigidBodyComponent2D> bodies)
+{
+    for (size_t index = 0; index < bodies.size(); ++index)
+    {
+        if (!solverBodies[index].IsMovable())
+        {
+            continue;
+        }
+
+        bodies[index].Velocity = solverBodies[index].LinearVelocity;
+        bodies[index].AngularVelocity = solverBodies[index].AngularVelocity;
+    }
+}
+
+NAMESPACE_END() // namespace PHYE::Physics2D
@@ -0,0 +1,68 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <BroadPhase2D/BroadPhase2D.hpp>
+#include <BroadPhase2D/DynamicAABBTree2D.hpp>
+#include <span>
+#include <vector>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+/**
+ * @brief AABBTreeBroadPhase2D
+ * @details Broadphase backed by CDynamicAABBTree2D. Every dynamic proxy queries the tree with its fattened AABB.
+ * Moving proxies rarely touch the tree thanks to the fattened leaves, which makes it a good default for scenes with
+ * many static colliders and objects of very different sizes.
+ */
+class PHYSICS2D_API CAABBTreeBroadPhase2D final : public IBroadPhase2D
+{
+public:
+    explicit CAABBTreeBroadPhase2D(float aabbMargin = CDynamicAABBTree2D::DEFAULT_AABB_MARGIN);
+    ~CAABBTreeBroadPhase2D() override = default;
+
+    CAABBTreeBroadPhase2D(const CAABBTreeBroadPhase2D&) = default;
+    CAABBTreeBroadPhase2D(CAABBTreeBroadPhase2D&&) noexcept = default;
+
+    CAABBTreeBroadPhase2D& operator=(const CAABBTreeBroadPhase2D&) = default;
+    CAABBTreeBroadPhase2D& operator=(CAABBTreeBroadPhase2D&&) noexcept = default;
+
+    int32_t CreateProxy(const CBoundingAABB2D& aabb, uint32_t colliderId, bool isDynamic) override;
+    void    DestroyProxy(int32_t proxyId) override;
+    void    MoveProxy(int32_t proxyId, const CBoundingAABB2D& aabb, const SVector2F& displacement) override;
+    void    UpdatePairs(std::vector<SBroadPhasePair2D>& outPairs) override;
+    void    Query(const CBoundingAABB2D& aabb, std::vector<uint32_t>& outColliders) const override;
+    void    Query(const CBoundingAABB2D& aabb, IBroadPhaseQueryCallback2D& callback) const override;
+    void    RayCast(SRayPacket2D& packet, IRayPacketCallback2D& callback) const override;
+
+    [[nodiscard]] CBoundingAABB2D GetFatAABB(int32_t proxyId) const override;
+    [[nodiscard]] size_t          GetProxyCount() const override;
+
+    [[nodiscard]] std::unique_ptr<IBroadPhase2D> Clone() const override;
+    void                                         CopyFrom(const IBroadPhase2D& other) override;
+
+    [[nodiscard]] const CDynamicAABBTree2D& GetTree() const;
+
+    // Grafts the prebuilt tree of the batch with CDynamicAABBTree2D::InsertSubtree() when it has one
+    void CreateProxies(const SBroadPhaseBatch2D& batch, std::span<int32_t> outProxyIds) override;
+
+private:
+    [[nodiscard]] bool IsDynamicProxy(int32_t proxyId) const;
+
+private:
+    CDynamicAABBTree2D Tree;
+
+    // Proxies that search for pairs
+    std::vector<int32_t> DynamicProxies;
+
+    // ProxyId -> index in DynamicProxies, INVALID_PROXY_ID for static/kinematic proxies
+    std::vector<int32_t> DynamicProxyIndices;
+};
+
+NAMESPACE_END() // namespace PHYE::Physics2D
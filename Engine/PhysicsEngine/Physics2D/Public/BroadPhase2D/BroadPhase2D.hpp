@@ -0,0 +1,174 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <BroadPhase2D/DynamicAABBTree2D.hpp>
+#include <BroadPhase2D/RayPacket2D.hpp>
+#include <CoreMacros.hpp>
+#include <Physics2D.hpp>
+#include <Rigid2D/BoundingVolume2D/BoundingAABB2D.hpp>
+#include <Vectors/Vectors.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+// Proxy id returned for nothing
+constexpr int32_t INVALID_PROXY_ID = -1;
+
+/**
+ * @brief Broadphase implementations selectable in SPhysicsWorldSettings2D.
+ */
+enum class EBroadPhaseType2D : uint8_t
+{
+    // Dynamic AABB tree, good default for mixed sizes and many static colliders
+    AABBTree = 0,
+
+    // Uniform grid rebuilt every step, for dense scenes of similar-size colliders
+    SpatialHash,
+
+    // Sort and sweep along one axis, for worlds spread mostly along one direction
+    SweepAndPrune,
+};
+
+/**
+ * @brief Candidate pair produced by a broadphase, ColliderA < ColliderB.
+ */
+struct SBroadPhasePair2D final
+{
+    uint32_t ColliderA;
+    uint32_t ColliderB;
+
+    bool operator==(const SBroadPhasePair2D& other) const
+    {
+        return ColliderA == other.ColliderA && ColliderB == other.ColliderB;
+    }
+
+    bool operator<(const SBroadPhasePair2D& other) const
+    {
+        return ColliderA < other.ColliderA || (ColliderA == other.ColliderA && ColliderB < other.ColliderB);
+    }
+};
+
+/**
+ * @brief Colliders handed to a broadphase together, e.g. the colliders of a streamed region.
+ */
+struct SBroadPhaseBatch2D final
+{
+    // Tight world AABB, collider id and IsDynamic of CreateProxy() for every collider
+    std::span<const CBoundingAABB2D> AABBs;
+    std::span<const uint32_t>        ColliderIds;
+    std::span<const uint8_t>         IsDynamic;
+
+    // Optional tree prebuilt over the colliders, the user data of a leaf is the index of its collider in the batch
+    std::span<const STreeNode2D> TreeNodes;
+    int32_t                      TreeRoot = NULL_TREE_NODE;
+};
+
+/**
+ * @brief Receives the proxies found by IBroadPhase2D::Query().
+ */
+class PHYSICS2D_API IBroadPhaseQueryCallback2D
+{
+public:
+    IBroadPhaseQueryCallback2D() = default;
+    virtual ~IBroadPhaseQueryCallback2D() = default;
+
+    IBroadPhaseQueryCallback2D(const IBroadPhaseQueryCallback2D&) = default;
+    IBroadPhaseQueryCallback2D(IBroadPhaseQueryCallback2D&&) noexcept = default;
+
+    IBroadPhaseQueryCallback2D& operator=(const IBroadPhaseQueryCallback2D&) = default;
+    IBroadPhaseQueryCallback2D& operator=(IBroadPhaseQueryCallback2D&&) noexcept = default;
+
+    // Return false to stop the query
+    virtual bool ReportCollider(uint32_t colliderId) = 0;
+};
+
+/**
+ * @brief BroadPhase2D
+ * @details Common interface of the broadphases used by CPhysicsWorld2D.
+ * A broadphase stores one proxy per collider. Proxies of dynamic bodies are the only ones that look for pairs, so
+ * static and kinematic proxies never pair with each other. UpdatePairs() outputs every pair whose (fattened) bounds
+ * overlap, sorted so that the pair list is stable frame to frame.
+ */
+class PHYSICS2D_API IBroadPhase2D
+{
+public:
+    IBroadPhase2D() = default;
+    virtual ~IBroadPhase2D() = default;
+
+    IBroadPhase2D(IBroadPhase2D&&) noexcept = default;
+    IBroadPhase2D& operator=(IBroadPhase2D&&) noexcept = default;
+
+    /**
+     * @brief Create a proxy for a collider.
+     * @param aabb Tight world AABB of the collider.
+     * @param colliderId Id reported in the pairs.
+     * @param isDynamic Whether the proxy searches for pairs.
+     * @return Proxy id used by the other calls.
+     */
+    virtual int32_t CreateProxy(const CBoundingAABB2D& aabb, uint32_t colliderId, bool isDynamic) = 0;
+
+    /**
+     * @brief Create the proxies of many colliders at once.
+     * @details The default creates them one by one, broadphases that can do better override it.
+     * @param outProxyIds Proxy of every collider of the batch, at least batch.AABBs.size() elements.
+     */
+    virtual void CreateProxies(const SBroadPhaseBatch2D& batch, std::span<int32_t> outProxyIds);
+
+    virtual void DestroyProxy(int32_t proxyId) = 0;
+
+    /**
+     * @brief Update the bounds of a proxy.
+     * @param aabb New tight world AABB.
+     * @param displacement Expected motion until the next update, used to predict the fattened bounds.
+     */
+    virtual void MoveProxy(int32_t proxyId, const CBoundingAABB2D& aabb, const SVector2F& displacement) = 0;
+
+    // Clear outPairs and fill it with every overlapping pair that involves a dynamic proxy
+    virtual void UpdatePairs(std::vector<SBroadPhasePair2D>& outPairs) = 0;
+
+    // Append the collider id of every proxy whose bounds overlap the box
+    virtual void Query(const CBoundingAABB2D& aabb, std::vector<uint32_t>& outColliders) const = 0;
+
+    // Report the collider id of every proxy whose bounds overlap the box, without collecting them
+    virtual void Query(const CBoundingAABB2D& aabb, IBroadPhaseQueryCallback2D& callback) const = 0;
+
+    /**
+     * @brief Report every proxy whose bounds are crossed by at least one active ray of the packet.
+     * @details The packet is traversed once for all of its rays: a box is visited when any lane passes the slab test,
+     * and the callback gets the mask of those lanes. Proxies may be reported in any order.
+     */
+    virtual void RayCast(SRayPacket2D& packet, IRayPacketCallback2D& callback) const = 0;
+
+    // Bounds stored for the proxy
+    [[nodiscard]] virtual CBoundingAABB2D GetFatAABB(int32_t proxyId) const = 0;
+
+    [[nodiscard]] virtual size_t GetProxyCount() const = 0;
+
+    // Copy of this broadphase, with the same proxy ids
+    [[nodiscard]] virtual std::unique_ptr<IBroadPhase2D> Clone() const = 0;
+
+    /**
+     * @brief Overwrite this broadphase with the state of another one of the same type.
+     * @details Broadphases only hold flat arrays, so once the capacities are large enough this is a copy of every
+     * array without allocation.
+     */
+    virtual void CopyFrom(const IBroadPhase2D& other) = 0;
+
+protected:
+    // Copies go through Clone()/CopyFrom(), never through the interface
+    IBroadPhase2D(const IBroadPhase2D&) = default;
+    IBroadPhase2D& operator=(const IBroadPhase2D&) = default;
+};
+
+NAMESPACE_END() // namespace PHYE::Physics2D
@@ -0,0 +1,299 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <BroadPhase2D/RayPacket2D.hpp>
+#include <CoreMacros.hpp>
+#include <Physics2D.hpp>
+#include <Rigid2D/BoundingVolume2D/BoundingAABB2D.hpp>
+#include <Vectors/Vectors.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+// Index of no node
+constexpr int32_t NULL_TREE_NODE = -1;
+
+/**
+ * @brief Node of CDynamicAABBTree2D, leaves are the proxies.
+ */
+struct STreeNode2D final
+{
+    // Leaves store the fattened AABB, internal nodes the union of their children
+    CBoundingAABB2D AABB;
+
+    // User data of a leaf
+    uint32_t UserData = 0;
+
+    // Parent node, or the next free node while the node is in the free list
+    int32_t Parent = NULL_TREE_NODE;
+
+    int32_t Child1 = NULL_TREE_NODE;
+    int32_t Child2 = NULL_TREE_NODE;
+
+    // Leaf = 0, free node = -1
+    int32_t Height = -1;
+
+    [[nodiscard]] bool IsLeaf() const
+    {
+        return Child1 == NULL_TREE_NODE;
+    }
+};
+
+/**
+ * @brief Traversal stack of the tree queries.
+ * @details Lives on the caller's stack so that concurrent queries do not share state, it only allocates when the
+ * traversal goes deeper than the inline capacity.
+ */
+class CTreeStack2D final
+{
+public:
+    void Push(int32_t node)
+    {
+        if (Count < INLINE_CAPACITY)
+        {
+            Inline[Count] = node;
+        }
+        else
+        {
+            Overflow.push_back(node);
+        }
+        ++Count;
+    }
+
+    int32_t Pop()
+    {
+        --Count;
+        if (Count < INLINE_CAPACITY)
+        {
+            return Inline[Count];
+        }
+
+        const int32_t NODE = Overflow.back();
+        Overflow.pop_back();
+        return NODE;
+    }
+
+    [[nodiscard]] bool IsEmpty() const
+    {
+        return Count == 0;
+    }
+
+private:
+    static constexpr size_t INLINE_CAPACITY = 256;
+
+    std::array<int32_t, INLINE_CAPACITY> Inline;
+    std::vector<int32_t>                 Overflow;
+    size_t                               Count = 0;
+};
+
+/**
+ * @brief Dynamic AABB Tree 2D
+ * @details A binary bounding volume hierarchy whose leaves are proxies with fattened AABBs.
+ * - Leaves are inserted next to the sibling that minimizes the perimeter growth of the tree(surface area heuristic).
+ * - Every insertion and removal rebalances the path to the root with AVL-style rotations.
+ * - A leaf stores its AABB grown by a margin and extended along the predicted displacement, so MoveProxy() only
+ *   touches the tree when the object leaves its fattened box.
+ * Nodes live in one array and are referenced by index, proxy ids stay valid until the proxy is destroyed.
+ */
+class PHYSICS2D_API CDynamicAABBTree2D final
+{
+public:
+    // Margin added around every leaf AABB
+    static constexpr float DEFAULT_AABB_MARGIN = 0.1F;
+
+    // The leaf AABB is extended by displacement * multiplier to predict the motion
+    static constexpr float DEFAULT_DISPLACEMENT_MULTIPLIER = 4.0F;
+
+    explicit CDynamicAABBTree2D(float aabbMargin = DEFAULT_AABB_MARGIN,
+                                float displacementMultiplier = DEFAULT_DISPLACEMENT_MULTIPLIER);
+    ~CDynamicAABBTree2D() = default;
+
+    CDynamicAABBTree2D(const CDynamicAABBTree2D&) = default;
+    CDynamicAABBTree2D(CDynamicAABBTree2D&&) noexcept = default;
+
+    CDynamicAABBTree2D& operator=(const CDynamicAABBTree2D&) = default;
+    CDynamicAABBTree2D& operator=(CDynamicAABBTree2D&&) noexcept = default;
+
+    // Create a leaf for the tight AABB, returns the proxy id
+    int32_t CreateProxy(const CBoundingAABB2D& aabb, uint32_t userData);
+
+    void DestroyProxy(int32_t proxyId);
+
+    /**
+     * @brief Move a proxy to a new tight AABB.
+     * @return Whether the leaf was reinserted(the AABB left the fattened box, or the box became too loose).
+     */
+    bool MoveProxy(int32_t proxyId, const CBoundingAABB2D& aabb, const SVector2F& displacement);
+
+    // Remove every proxy
+    void Clear();
+
+    /**
+     * @brief Graft a prebuilt subtree, e.g. the tree of a streamed region, with a single insertion.
+     * @details Every node is copied into a node of this tree, then the subtree root is inserted like a leaf and the
+     * path above it rebalanced. Past the copy, the cost does not grow with the size of the subtree.
+     * @param userData New user data of the leaves, indexed by the user data they have in nodes.
+     * @param outNodeIds Index of every node in this tree, the proxy id for a leaf.
+     */
+    void InsertSubtree(std::span<const STreeNode2D> nodes, int32_t root, std::span<const uint32_t> userData,
+                       std::span<int32_t> outNodeIds);
+
+    // Getters
+    [[nodiscard]] const CBoundingAABB2D& GetFatAABB(int32_t proxyId) const
+    {
+        return Nodes[proxyId].AABB;
+    }
+
+    [[nodiscard]] uint32_t GetUserData(int32_t proxyId) const
+    {
+        return Nodes[proxyId].UserData;
+    }
+
+    [[nodiscard]] int32_t GetRoot() const
+    {
+        return Root;
+    }
+
+    [[nodiscard]] const std::vector<STreeNode2D>& GetNodes() const
+    {
+        return Nodes;
+    }
+
+    [[nodiscard]] size_t GetProxyCount() const
+    {
+        return ProxyCount;
+    }
+
+    // Height of the tree, 0 for a single leaf
+    [[nodiscard]] int32_t GetHeight() const;
+
+    // Largest height difference between two siblings
+    [[nodiscard]] int32_t GetMaxBalance() const;
+
+    // Sum of the node perimeters divided by the root perimeter, lower is a tighter tree
+    [[nodiscard]] float GetAreaRatio() const;
+
+    // Assert the structure and the cached heights/AABBs(debug builds only)
+    void Validate() const;
+
+    /**
+     * @brief Visit every proxy whose fattened AABB overlaps the box.
+     * @param callback bool(int32_t proxyId), return false to stop the query.
+     */
+    template <typename TCallback>
+    void Query(const CBoundingAABB2D& aabb, TCallback&& callback) const
+    {
+        CTreeStack2D stack;
+        stack.Push(Root);
+
+        while (!stack.IsEmpty())
+        {
+            const int32_t NODE_ID = stack.Pop();
+            if (NODE_ID == NULL_TREE_NODE)
+            {
+                continue;
+            }
+
+            const STreeNode2D& node = Nodes[NODE_ID];
+            if (!node.AABB.Overlaps(aabb))
+            {
+                continue;
+            }
+
+            if (node.IsLeaf())
+            {
+                if (!callback(NODE_ID))
+                {
+                    return;
+                }
+            }
+            else
+            {
+                stack.Push(node.Child1);
+                stack.Push(node.Child2);
+            }
+        }
+    }
+
+    /**
+     * @brief Visit every proxy whose fattened AABB is crossed by an active ray of the packet.
+     * @details One traversal serves the whole packet: a node is opened while any lane passes its slab test, so rays
+     * that travel close together share the node visits. The callback may lower packet.MaxFraction to cull the nodes
+     * beyond the closest hit found so far.
+     * @param callback void(int32_t proxyId, uint32_t laneMask), laneMask holds the lanes crossing the leaf.
+     */
+    template <typename TCallback>
+    void RayCast(SRayPacket2D& packet, TCallback&& callback) const
+    {
+        CTreeStack2D stack;
+        stack.Push(Root);
+
+        while (!stack.IsEmpty() && packet.ActiveMask != 0)
+        {
+            const int32_t NODE_ID = stack.Pop();
+            if (NODE_ID == NULL_TREE_NODE)
+            {
+                continue;
+            }
+
+            const STreeNode2D& node = Nodes[NODE_ID];
+            const uint32_t     LANE_MASK = RayPacketOverlaps(packet, node.AABB);
+            if (LANE_MASK == 0)
+            {
+                continue;
+            }
+
+            if (node.IsLeaf())
+            {
+                callback(NODE_ID, LANE_MASK);
+            }
+            else
+            {
+                stack.Push(node.Child1);
+                stack.Push(node.Child2);
+            }
+        }
+    }
+
+private:
+    int32_t AllocateNode();
+    void    FreeNode(int32_t nodeId);
+
+    void InsertLeaf(int32_t leaf);
+    void RemoveLeaf(int32_t leaf);
+
+    // Refit the AABBs and heights from the node up to the root, rebalancing on the way
+    void Refit(int32_t nodeId);
+
+    // Rotate the subtree rooted at nodeId if it is unbalanced, returns the new subtree root
+    int32_t Balance(int32_t nodeId);
+
+    [[nodiscard]] int32_t ComputeHeight(int32_t nodeId) const;
+    void                  ValidateNode(int32_t nodeId) const;
+
+private:
+    std::vector<STreeNode2D> Nodes;
+
+    int32_t Root;
+
+    // Head of the free node list(linked through STreeNode2D::Parent)
+    int32_t FreeList;
+
+    size_t ProxyCount;
+
+    float AABBMargin;
+    float DisplacementMultiplier;
+};
+
+NAMESPACE_END() // namespace PHYE::Physics2D
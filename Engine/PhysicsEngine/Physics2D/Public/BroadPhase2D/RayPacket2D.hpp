@@ -0,0 +1,117 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <CoreMacros.hpp>
+#include <Physics2D.hpp>
+#include <Rigid2D/BoundingVolume2D/BoundingAABB2D.hpp>
+#include <Solver2D/WideFloat2D.hpp>
+#include <Vectors/Vectors.hpp>
+#include <cmath>
+#include <cstdint>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+// Rays traversing a broadphase together, one per SIMD lane
+constexpr uint32_t RAY_PACKET_SIZE_2D = SIMD_WIDTH_2D;
+
+// Below this length a ray translation component is treated as parallel to the slab
+constexpr float RAY_PARALLEL_EPSILON_2D = 1.0E-12F;
+
+/**
+ * @brief Segments cast against the broadphase bounds together, in SoA layout.
+ * @details A ray goes from Origin to Origin + Translation, fractions are in units of the translation. The inverse
+ * translation of a parallel axis is a large finite value instead of infinity, so that the slab test never computes
+ * 0 * inf.
+ */
+struct alignas(SIMD_ALIGNMENT_2D) SRayPacket2D final
+{
+    TWideArray2D OriginX{};
+    TWideArray2D OriginY{};
+    TWideArray2D InverseTranslationX{};
+    TWideArray2D InverseTranslationY{};
+
+    // Fraction beyond which bounds are not reported, lowered by the caller as hits are found
+    TWideArray2D MaxFraction{};
+
+    // Bit per lane holding a ray
+    uint32_t ActiveMask = 0;
+
+    // Put a ray in a lane
+    void SetRay(uint32_t lane, const SVector2F& origin, const SVector2F& translation, float maxFraction = 1.0F)
+    {
+        OriginX[lane] = origin.X;
+        OriginY[lane] = origin.Y;
+        InverseTranslationX[lane] = GetSafeInverse(translation.X);
+        InverseTranslationY[lane] = GetSafeInverse(translation.Y);
+        MaxFraction[lane] = maxFraction;
+        ActiveMask |= 1U << lane;
+    }
+
+private:
+    [[nodiscard]] static float GetSafeInverse(float value)
+    {
+        if (std::abs(value) > RAY_PARALLEL_EPSILON_2D)
+        {
+            return 1.0F / value;
+        }
+
+        return value < 0.0F ? -1.0F / RAY_PARALLEL_EPSILON_2D : 1.0F / RAY_PARALLEL_EPSILON_2D;
+    }
+};
+
+/**
+ * @brief Slab test of every ray of the packet against one box.
+ * @return Bit i set if active ray i crosses the box within [0, MaxFraction[i]].
+ */
+[[nodiscard]] inline uint32_t RayPacketOverlaps(const SRayPacket2D& packet, const CBoundingAABB2D& aabb)
+{
+    const SVector2F& MIN = aabb.GetMin();
+    const SVector2F& MAX = aabb.GetMax();
+
+    const SWideFloat2D ORIGIN_X = WideLoad(packet.OriginX);
+    const SWideFloat2D ORIGIN_Y = WideLoad(packet.OriginY);
+    const SWideFloat2D INVERSE_X = WideLoad(packet.InverseTranslationX);
+    const SWideFloat2D INVERSE_Y = WideLoad(packet.InverseTranslationY);
+
+    // 射线进入与离开两组平行边界的参数
+    const SWideFloat2D X1 = (WideSplat(MIN.X) - ORIGIN_X) * INVERSE_X;
+    const SWideFloat2D X2 = (WideSplat(MAX.X) - ORIGIN_X) * INVERSE_X;
+    const SWideFloat2D Y1 = (WideSplat(MIN.Y) - ORIGIN_Y) * INVERSE_Y;
+    const SWideFloat2D Y2 = (WideSplat(MAX.Y) - ORIGIN_Y) * INVERSE_Y;
+
+    const SWideFloat2D ENTER = WideMax(WideMax(WideMin(X1, X2), WideMin(Y1, Y2)), WideSplat(0.0F));
+    const SWideFloat2D EXIT = WideMin(WideMin(WideMax(X1, X2), WideMax(Y1, Y2)), WideLoad(packet.MaxFraction));
+
+    return WideLessEqualMask(ENTER, EXIT) & packet.ActiveMask;
+}
+
+/**
+ * @brief Receives the proxies a ray packet crosses during IBroadPhase2D::RayCast().
+ */
+class PHYSICS2D_API IRayPacketCallback2D
+{
+public:
+    IRayPacketCallback2D() = default;
+    virtual ~IRayPacketCallback2D() = default;
+
+    IRayPacketCallback2D(const IRayPacketCallback2D&) = default;
+    IRayPacketCallback2D(IRayPacketCallback2D&&) noexcept = default;
+
+    IRayPacketCallback2D& operator=(const IRayPacketCallback2D&) = default;
+    IRayPacketCallback2D& operator=(IRayPacketCallback2D&&) noexcept = default;
+
+    /**
+     * @param laneMask Rays of the packet whose segment crosses the bounds of the collider.
+     * @param packet May be modified: lowering MaxFraction or clearing ActiveMask bits prunes the rest of the traversal.
+     */
+    virtual void ReportCollider(uint32_t colliderId, uint32_t laneMask, SRayPacket2D& packet) = 0;
+};
+
+NAMESPACE_END() // namespace PHYE::Physics2D
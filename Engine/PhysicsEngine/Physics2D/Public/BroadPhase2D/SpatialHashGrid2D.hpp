@@ -0,0 +1,117 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <BroadPhase2D/BroadPhase2D.hpp>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+/**
+ * @brief SpatialHashGrid2D
+ * @details Uniform grid broadphase rebuilt from scratch in UpdatePairs().
+ * Cells are hashed into a flat bucket array that is filled with a counting sort(count, prefix sum, scatter), so the
+ * rebuild is linear in the number of proxies and does not allocate once the buffers have grown.
+ * A pair is reported only by the cell that holds the min corner of the overlap of the two boxes, which removes the
+ * duplicates of boxes sharing several cells without a hash set.
+ * Proxies spanning more than MAX_CELLS_PER_PROXY cells(ground, walls) are kept out of the grid and tested against every
+ * proxy instead.
+ */
+class PHYSICS2D_API CSpatialHashGrid2D final : public IBroadPhase2D
+{
+public:
+    // Largest number of cells a proxy may cover before it is handled as a large proxy
+    static constexpr int32_t MAX_CELLS_PER_PROXY = 16;
+
+    /**
+     * @param cellSize Edge length of a cell, <= 0 picks the average proxy size at every rebuild.
+     * @param aabbMargin Margin added around the proxy bounds, which MoveProxy() also extends along the displacement.
+     */
+    explicit CSpatialHashGrid2D(float cellSize = 0.0F, float aabbMargin = 0.1F);
+    ~CSpatialHashGrid2D() override = default;
+
+    CSpatialHashGrid2D(const CSpatialHashGrid2D&) = default;
+    CSpatialHashGrid2D(CSpatialHashGrid2D&&) noexcept = default;
+
+    CSpatialHashGrid2D& operator=(const CSpatialHashGrid2D&) = default;
+    CSpatialHashGrid2D& operator=(CSpatialHashGrid2D&&) noexcept = default;
+
+    int32_t CreateProxy(const CBoundingAABB2D& aabb, uint32_t colliderId, bool isDynamic) override;
+    void    DestroyProxy(int32_t proxyId) override;
+    void    MoveProxy(int32_t proxyId, const CBoundingAABB2D& aabb, const SVector2F& displacement) override;
+    void    UpdatePairs(std::vector<SBroadPhasePair2D>& outPairs) override;
+    void    Query(const CBoundingAABB2D& aabb, std::vector<uint32_t>& outColliders) const override;
+    void    Query(const CBoundingAABB2D& aabb, IBroadPhaseQueryCallback2D& callback) const override;
+    void    RayCast(SRayPacket2D& packet, IRayPacketCallback2D& callback) const override;
+
+    [[nodiscard]] CBoundingAABB2D GetFatAABB(int32_t proxyId) const override;
+    [[nodiscard]] size_t          GetProxyCount() const override;
+
+    [[nodiscard]] std::unique_ptr<IBroadPhase2D> Clone() const override;
+    void                                         CopyFrom(const IBroadPhase2D& other) override;
+
+    // Cell size used by the last rebuild
+    [[nodiscard]] float GetCellSize() const;
+
+private:
+    struct SGridProxy2D final
+    {
+        CBoundingAABB2D AABB;
+        uint32_t        ColliderId = 0;
+        bool            IsDynamic = false;
+        bool            IsInUse = false;
+    };
+
+    // Inclusive range of cells covered by a proxy
+    struct SCellRange2D final
+    {
+        int32_t MinX = 0;
+        int32_t MinY = 0;
+        int32_t MaxX = -1;
+        int32_t MaxY = -1;
+    };
+
+    // One (proxy, cell) entry of the flat bucket array
+    struct SGridEntry2D final
+    {
+        int32_t ProxyId;
+        int32_t CellX;
+        int32_t CellY;
+    };
+
+    [[nodiscard]] float        ComputeCellSize() const;
+    [[nodiscard]] int32_t      ToCell(float coordinate) const;
+    [[nodiscard]] SCellRange2D ComputeCellRange(const CBoundingAABB2D& aabb) const;
+    [[nodiscard]] uint32_t     HashCell(int32_t cellX, int32_t cellY) const;
+
+    // Rebuild Buckets/Entries from the current proxies
+    void Rebuild();
+
+    void AddPairIfOverlapping(int32_t proxyA, int32_t proxyB, std::vector<SBroadPhasePair2D>& outPairs) const;
+
+private:
+    // Proxies indexed by proxy id, free slots have IsInUse == false
+    std::vector<SGridProxy2D> Proxies;
+    std::vector<int32_t>      FreeProxies;
+    size_t                    ProxyCount;
+
+    float DesiredCellSize;
+    float AABBMargin;
+
+    // Rebuild state, kept between steps to reuse the memory
+    float                     CellSize;
+    float                     InverseCellSize;
+    uint32_t                  BucketMask;
+    std::vector<SCellRange2D> CellRanges;
+    std::vector<uint32_t>     BucketStarts;
+    std::vector<uint32_t>     BucketCursors;
+    std::vector<SGridEntry2D> Entries;
+    std::vector<int32_t>      LargeProxies;
+};
+
+NAMESPACE_END() // namespace PHYE::Physics2D
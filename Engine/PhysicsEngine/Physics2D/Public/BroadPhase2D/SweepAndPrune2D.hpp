@@ -0,0 +1,88 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <BroadPhase2D/BroadPhase2D.hpp>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+/**
+ * @brief SweepAndPrune2D
+ * @details Sort and sweep broadphase over the AABB intervals of the proxies on one axis.
+ * - The sweep axis is the one along which the proxy centers have the largest variance, so most intervals are disjoint.
+ * - The interval array keeps its order between steps and is re-sorted with insertion sort, which is close to linear
+ *   because objects move little from one step to the next. A full sort is only done when the axis changes.
+ * - The sweep tests every interval against the following ones until their Min passes its Max.
+ */
+class PHYSICS2D_API CSweepAndPrune2D final : public IBroadPhase2D
+{
+public:
+    explicit CSweepAndPrune2D(float aabbMargin = 0.1F);
+    ~CSweepAndPrune2D() override = default;
+
+    CSweepAndPrune2D(const CSweepAndPrune2D&) = default;
+    CSweepAndPrune2D(CSweepAndPrune2D&&) noexcept = default;
+
+    CSweepAndPrune2D& operator=(const CSweepAndPrune2D&) = default;
+    CSweepAndPrune2D& operator=(CSweepAndPrune2D&&) noexcept = default;
+
+    int32_t CreateProxy(const CBoundingAABB2D& aabb, uint32_t colliderId, bool isDynamic) override;
+    void    DestroyProxy(int32_t proxyId) override;
+    void    MoveProxy(int32_t proxyId, const CBoundingAABB2D& aabb, const SVector2F& displacement) override;
+    void    UpdatePairs(std::vector<SBroadPhasePair2D>& outPairs) override;
+    void    Query(const CBoundingAABB2D& aabb, std::vector<uint32_t>& outColliders) const override;
+    void    Query(const CBoundingAABB2D& aabb, IBroadPhaseQueryCallback2D& callback) const override;
+    void    RayCast(SRayPacket2D& packet, IRayPacketCallback2D& callback) const override;
+
+    [[nodiscard]] CBoundingAABB2D GetFatAABB(int32_t proxyId) const override;
+    [[nodiscard]] size_t          GetProxyCount() const override;
+
+    [[nodiscard]] std::unique_ptr<IBroadPhase2D> Clone() const override;
+    void                                         CopyFrom(const IBroadPhase2D& other) override;
+
+    // Axis used by the last sweep, 0 = X, 1 = Y
+    [[nodiscard]] uint32_t GetSweepAxis() const;
+
+private:
+    struct SSAPProxy2D final
+    {
+        CBoundingAABB2D AABB;
+        uint32_t        ColliderId = 0;
+        bool            IsDynamic = false;
+        bool            IsInUse = false;
+    };
+
+    // Interval of a proxy on the sweep axis, the array of intervals is the sorted structure
+    struct SSAPInterval2D final
+    {
+        float   Min;
+        float   Max;
+        int32_t ProxyId;
+    };
+
+    // Axis with the largest variance of the proxy centers
+    [[nodiscard]] uint32_t ChooseSweepAxis() const;
+
+    // Refresh the interval bounds and restore the order
+    void SortIntervals(uint32_t axis);
+
+private:
+    // Proxies indexed by proxy id, free slots have IsInUse == false
+    std::vector<SSAPProxy2D> Proxies;
+    std::vector<int32_t>     FreeProxies;
+    size_t                   ProxyCount;
+
+    float AABBMargin;
+
+    // Sorted by Min on SweepAxis(as of the last update)
+    std::vector<SSAPInterval2D> Intervals;
+    uint32_t                    SweepAxis;
+};
+
+NAMESPACE_END() // namespace PHYE::Physics2D
@@ -0,0 +1,170 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <CoreMacros.hpp>
+#include <Job/JobSystem.hpp>
+#include <Physics2D.hpp>
+#include <Rigid2D/RigidBody2D/RigidBodyComponent2D.hpp>
+#include <Vectors/Vectors.hpp>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+// Most bodies in a leaf of a CBarnesHutTree2D, the bodies of a leaf share one interaction list
+constexpr uint32_t BARNES_HUT_LEAF_SIZE_2D = 32;
+
+// Depth at which a cell becomes a leaf whatever its body count, e.g. when bodies share a position
+constexpr uint32_t BARNES_HUT_MAX_DEPTH_2D = 32;
+
+// Depth of the cells whose subtrees CBarnesHutTree2D::Build() builds on the task system, 4^3 = 64 subtrees
+constexpr uint32_t BARNES_HUT_SPLIT_DEPTH_2D = 3;
+
+// Leaves handed to one job of the task system by CBarnesHutTree2D::ComputeAccelerations()
+constexpr uint32_t BARNES_HUT_LEAVES_PER_JOB_2D = 16;
+
+/**
+ * @brief Point mass of a CBarnesHutTree2D.
+ */
+struct SBarnesHutBody2D final
+{
+    float X = 0.0F;
+    float Y = 0.0F;
+    float Mass = 0.0F;
+
+    // Index of the body in the span given to CBarnesHutTree2D::Build()
+    uint32_t Index = 0;
+};
+
+/**
+ * @brief Cell of a CBarnesHutTree2D, with the mass and the center of mass of the bodies inside it.
+ * @details Nodes are stored in depth-first order: the children of a node follow it, and Next is the first node after
+ * its subtree. A traversal either opens a node(goes on with the next index) or skips it(jumps to Next), without a
+ * stack.
+ */
+struct SBarnesHutNode2D final
+{
+    float CenterX = 0.0F;
+    float CenterY = 0.0F;
+    float Mass = 0.0F;
+
+    // Width of the cell, and distance from its geometric center to its center of mass
+    float Size = 0.0F;
+    float Offset = 0.0F;
+
+    uint32_t Next = 0;
+
+    // Bodies of a leaf, BodyCount is 0 for an internal node
+    uint32_t FirstBody = 0;
+    uint32_t BodyCount = 0;
+};
+
+/**
+ * @brief Leaf of a CBarnesHutTree2D with the bounds of its bodies.
+ */
+struct SBarnesHutLeaf2D final
+{
+    uint32_t FirstBody = 0;
+    uint32_t BodyCount = 0;
+
+    float MinX = 0.0F;
+    float MinY = 0.0F;
+    float MaxX = 0.0F;
+    float MaxY = 0.0F;
+};
+
+/**
+ * @brief Quadtree over the mass centers of a set of bodies, for Barnes-Hut gravity.
+ * @details Build() partitions the bodies in place, so the bodies of every cell are contiguous. A cell far enough
+ * from the bodies being evaluated is treated as a single point mass: it is kept when
+ * distance > Size / openingAngle + Offset, which also keeps a cell whose center of mass is off center from being
+ * accepted while the bodies are inside it. This brings the cost of the whole set from O(n^2) down to O(n log n).
+ * ComputeAccelerations() walks the tree once per leaf to collect the masses its bodies interact with, then sums that
+ * list for every body of the leaf, SIMD_WIDTH_2D masses at a time.
+ * The result only depends on the bodies the tree was built from and their order, not on the number of threads.
+ */
+class PHYSICS2D_API CBarnesHutTree2D final
+{
+private:
+    // Cell at BARNES_HUT_SPLIT_DEPTH_2D(or a smaller leaf above it) and the subtree built for it
+    struct SBarnesHutSubtree2D final
+    {
+        uint32_t Begin = 0;
+        uint32_t End = 0;
+        float    MinX = 0.0F;
+        float    MinY = 0.0F;
+        float    Size = 0.0F;
+        uint32_t Depth = 0;
+
+        std::vector<SBarnesHutNode2D> Nodes;
+        std::vector<SBarnesHutLeaf2D> Leaves;
+    };
+
+    std::vector<SBarnesHutBody2D> Bodies;
+    std::vector<SBarnesHutNode2D> Nodes;
+    std::vector<SBarnesHutLeaf2D> Leaves;
+
+    // Subtrees of the last Build(), kept for their memory
+    std::vector<SBarnesHutSubtree2D> Subtrees;
+    uint32_t                         SubtreeCount = 0;
+
+public:
+    CBarnesHutTree2D() = default;
+    ~CBarnesHutTree2D() = default;
+
+    CBarnesHutTree2D(const CBarnesHutTree2D&) = default;
+    CBarnesHutTree2D(CBarnesHutTree2D&&) noexcept = default;
+
+    CBarnesHutTree2D& operator=(const CBarnesHutTree2D&) = default;
+    CBarnesHutTree2D& operator=(CBarnesHutTree2D&&) noexcept = default;
+
+    /**
+     * @brief Rebuild the tree over the bodies whose ForceGroups share a bit with bodyGroups.
+     * @details Takes every Dynamic body and every other body with a positive mass: sleeping bodies still attract the
+     * others. The top levels are split on the calling thread, then the subtrees below BARNES_HUT_SPLIT_DEPTH_2D are
+     * built on the task system when one is given and spliced in order, so the tree is the same either way.
+     * Memory is kept between builds.
+     */
+    void Build(std::span<const SRigidBodyComponent2D> bodies, uint32_t bodyGroups, BE::Core::CJobSystem* jobSystem);
+
+    void Clear();
+
+    [[nodiscard]] bool IsEmpty() const;
+
+    /**
+     * @brief Sum of mass * r / (|r|^2 + softening^2)^1.5 over the other bodies of the tree, for every body of it.
+     * @details Multiplied by the gravitational constant this is the acceleration of the body, r points from the body
+     * to the others.
+     * @param openingAngle Cells seen under a smaller angle are approximated, 0 sums every pair.
+     * @param softening Keeps the acceleration bounded when two bodies get close, must be positive.
+     * @param outAccelerations Indexed like the span given to Build(), entries of bodies outside the tree are left
+     * untouched.
+     * @param jobSystem Task system to spread the leaves over, nullptr to compute on the calling thread.
+     */
+    void ComputeAccelerations(float openingAngle, float softening, std::span<SVector2F> outAccelerations,
+                              BE::Core::CJobSystem* jobSystem) const;
+
+    // Same sum at any point, e.g. to probe the field or predict a trajectory
+    void ComputeAcceleration(const SVector2F& point, float openingAngle, float softening,
+                             SVector2F& outAcceleration) const;
+
+    [[nodiscard]] const std::vector<SBarnesHutNode2D>& GetNodes() const;
+
+private:
+    // Partition the cells above BARNES_HUT_SPLIT_DEPTH_2D and queue a subtree for each cell below them
+    void SplitCell(uint32_t begin, uint32_t end, float minX, float minY, float size, uint32_t depth);
+
+    // Emit the cells above BARNES_HUT_SPLIT_DEPTH_2D into Nodes, splicing the subtrees in the order of SplitCell()
+    void EmitCell(uint32_t begin, uint32_t end, float minX, float minY, float size, uint32_t depth,
+                  uint32_t& nextSubtree);
+};
+
+NAMESPACE_END() // namespace PHYE::Physics2D
@@ -0,0 +1,129 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <CoreMacros.hpp>
+#include <Physics2D.hpp>
+#include <Rigid2D/BoundingVolume2D/BoundingAABB2D.hpp>
+#include <Rigid2D/RigidBody2D/RigidBodyComponent2D.hpp>
+#include <Vectors/Vectors.hpp>
+#include <cstdint>
+#include <span>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+/**
+ * @brief Kinds of force field held by a CForceFieldRegistry2D.
+ */
+enum class EForceFieldType2D : uint8_t
+{
+    Gravity = 0,
+    Drag,
+    Attractor,
+    Wind,
+    NBodyGravity,
+
+    Count
+};
+
+/**
+ * @brief Uniform acceleration, scaled by the GravityScale of every body.
+ * @details Adds to SPhysicsWorldSettings2D::Gravity, which still applies to every body.
+ */
+struct PHYSICS2D_API SGravityField2D final
+{
+    SVector2F Acceleration;
+
+    // Bodies whose ForceGroups share a bit with this mask feel the field
+    uint32_t BodyGroups = ALL_FORCE_GROUPS;
+};
+
+/**
+ * @brief Drag against the velocity of a body: F = -(LinearCoefficient + QuadraticCoefficient * |v|) * v.
+ */
+struct PHYSICS2D_API SDragField2D final
+{
+    float LinearCoefficient = 0.0F;
+    float QuadraticCoefficient = 0.0F;
+
+    uint32_t BodyGroups = ALL_FORCE_GROUPS;
+};
+
+/**
+ * @brief Acceleration toward Center of Strength / d^2 within Radius, a negative Strength pushes bodies away.
+ * @details d is clamped to MinDistance, so a body passing through the center does not receive an unbounded kick.
+ */
+struct PHYSICS2D_API SAttractorField2D final
+{
+    SVector2F Center;
+    float     Strength = 0.0F;
+    float     Radius = 0.0F;
+    float     MinDistance = 0.1F;
+
+    uint32_t BodyGroups = ALL_FORCE_GROUPS;
+};
+
+/**
+ * @brief Drag toward Velocity for the bodies whose center lies in Volume: F = Coefficient * (Velocity - v).
+ */
+struct PHYSICS2D_API SWindField2D final
+{
+    CBoundingAABB2D Volume;
+    SVector2F       Velocity;
+    float           Coefficient = 0.0F;
+
+    uint32_t BodyGroups = ALL_FORCE_GROUPS;
+};
+
+/**
+ * @brief Mutual gravity between the bodies of the groups: every one attracts every other one.
+ * @details Evaluated with a CBarnesHutTree2D rebuilt every substep, in O(n log n) instead of O(n^2). Cells seen under
+ * a smaller angle than OpeningAngle are approximated by their center of mass: 0 sums every pair exactly, 0.5 is a
+ * usual tradeoff, larger angles are faster and less accurate. Every body with a positive mass attracts, only awake
+ * Dynamic bodies are moved.
+ */
+struct PHYSICS2D_API SNBodyGravityField2D final
+{
+    // Scaled to the units of the scene, 6.674e-11 in SI units
+    float GravitationalConstant = 1.0F;
+
+    float OpeningAngle = 0.5F;
+
+    // Keeps close encounters bounded: the distance used is sqrt(d^2 + Softening^2), must be positive
+    float Softening = 0.01F;
+
+    uint32_t BodyGroups = ALL_FORCE_GROUPS;
+};
+
+/**
+ * @brief Change the velocities of a batch of bodies by the forces of one field over timeStep.
+ * @details Only awake Dynamic bodies in the groups of the field are affected; fields do not wake sleeping bodies.
+ * Drag and wind are integrated implicitly, like the damping of the integrator, so a large coefficient slows a body
+ * down to rest(or to the wind velocity) without ever reversing it.
+ * @param bodies Dense body components.
+ * @param field Field applied to every body of the batch.
+ * @param timeStep Step length in seconds.
+ */
+PHYSICS2D_API void ApplyForceField2D(std::span<SRigidBodyComponent2D> bodies, const SGravityField2D& field,
+                                     float timeStep);
+PHYSICS2D_API void ApplyForceField2D(std::span<SRigidBodyComponent2D> bodies, const SDragField2D& field,
+                                     float timeStep);
+PHYSICS2D_API void ApplyForceField2D(std::span<SRigidBodyComponent2D> bodies, const SAttractorField2D& field,
+                                     float timeStep);
+PHYSICS2D_API void ApplyForceField2D(std::span<SRigidBodyComponent2D> bodies, const SWindField2D& field,
+                                     float timeStep);
+
+/**
+ * @brief ApplyForceField2D() for N-body gravity.
+ * @param accelerations Same indexing as bodies, filled by CBarnesHutTree2D::ComputeAccelerations() for the field.
+ */
+PHYSICS2D_API void ApplyForceField2D(std::span<SRigidBodyComponent2D> bodies, const SNBodyGravityField2D& field,
+                                     std::span<const SVector2F> accelerations, float timeStep);
+
+NAMESPACE_END() // namespace PHYE::Physics2D
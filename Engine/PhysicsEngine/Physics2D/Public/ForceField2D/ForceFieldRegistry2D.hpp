@@ -0,0 +1,172 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <CoreMacros.hpp>
+#include <ForceField2D/BarnesHutTree2D.hpp>
+#include <ForceField2D/ForceField2D.hpp>
+#include <Job/JobSystem.hpp>
+#include <Physics2D.hpp>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+// Id of a force field that is not registered in a CForceFieldRegistry2D
+constexpr uint32_t INVALID_FORCE_FIELD_ID = static_cast<uint32_t>(-1);
+
+// Bodies handled by one pass over every field, small enough for the batch to stay in the L1/L2 cache
+constexpr uint32_t FORCE_FIELD_CHUNK_SIZE_2D = 256;
+
+// Bodies handed to one job of the task system by CForceFieldRegistry2D::Apply()
+constexpr uint32_t FORCE_FIELD_BODIES_PER_JOB_2D = 4096;
+
+/**
+ * @brief Force fields of a CPhysicsWorld2D, applied to the bodies of their groups in the IntegrateForces stage.
+ * @details Fields are stored by kind in flat arrays, so Apply() runs one tight loop per field over a chunk of the
+ * dense body components instead of a virtual call per body and field. Every field reaches the bodies whose
+ * SRigidBodyComponent2D::ForceGroups share a bit with its BodyGroups mask. N-body gravity fields are evaluated with a
+ * CBarnesHutTree2D kept by the registry.
+ * Ids stay valid until the field is removed and are reused afterwards, like collider ids.
+ */
+class PHYSICS2D_API CForceFieldRegistry2D final
+{
+private:
+    // Fields of one kind, and the id of each of them
+    template <typename TField>
+    struct TForceFieldArray2D final
+    {
+        std::vector<TField>   Fields;
+        std::vector<uint32_t> Ids;
+    };
+
+    // Where the field of an id lives, Type is EForceFieldType2D::Count for a free id
+    struct SForceFieldSlot2D final
+    {
+        EForceFieldType2D Type = EForceFieldType2D::Count;
+        uint32_t          Index = 0;
+    };
+
+    TForceFieldArray2D<SGravityField2D>   GravityFields;
+    TForceFieldArray2D<SDragField2D>      DragFields;
+    TForceFieldArray2D<SAttractorField2D> AttractorFields;
+    TForceFieldArray2D<SWindField2D>      WindFields;
+
+    TForceFieldArray2D<SNBodyGravityField2D> NBodyGravityFields;
+
+    // Rebuilt for each N-body gravity field by Apply(), and the accelerations it gives to the bodies
+    CBarnesHutTree2D       NBodyGravityTree;
+    std::vector<SVector2F> NBodyGravityAccelerations;
+
+    // Slots indexed by field id, and the released ids
+    std::vector<SForceFieldSlot2D> Slots;
+    std::vector<uint32_t>          FreeIds;
+
+public:
+    CForceFieldRegistry2D() = default;
+    ~CForceFieldRegistry2D() = default;
+
+    CForceFieldRegistry2D(const CForceFieldRegistry2D&) = default;
+    CForceFieldRegistry2D(CForceFieldRegistry2D&&) noexcept = default;
+
+    CForceFieldRegistry2D& operator=(const CForceFieldRegistry2D&) = default;
+    CForceFieldRegistry2D& operator=(CForceFieldRegistry2D&&) noexcept = default;
+
+    // Register a field and return its id
+    uint32_t AddField(const SGravityField2D& field);
+    uint32_t AddField(const SDragField2D& field);
+    uint32_t AddField(const SAttractorField2D& field);
+    uint32_t AddField(const SWindField2D& field);
+    uint32_t AddField(const SNBodyGravityField2D& field);
+
+    // Unregister a field, its id may be handed out again
+    void RemoveField(uint32_t fieldId);
+
+    /**
+     * @brief Field of an id, to change its parameters or groups.
+     * @return nullptr if the id is not registered or holds a field of another kind. Invalidated when fields are added
+     * or removed.
+     */
+    template <typename TField>
+    [[nodiscard]] TField* GetField(uint32_t fieldId);
+
+    // Kind of the field of an id, EForceFieldType2D::Count if the id is not registered
+    [[nodiscard]] EForceFieldType2D GetFieldType(uint32_t fieldId) const;
+
+    [[nodiscard]] uint32_t GetFieldCount() const;
+
+    void Clear();
+
+    /**
+     * @brief Change the velocities of a batch of bodies by every field over timeStep.
+     * @details N-body gravity fields go first: each one rebuilds the tree over the bodies and evaluates it leaf by
+     * leaf. The bodies are then cut into chunks of FORCE_FIELD_CHUNK_SIZE_2D, each chunk goes through every other
+     * field before the next one is loaded. A body only reads and writes itself, so the chunks are spread over the task
+     * system when one is given(like the leaves of the tree), and the result does not depend on the number of threads.
+     * @param bodies Dense body components.
+     * @param timeStep Step length in seconds.
+     * @param jobSystem Task system to spread the chunks over, nullptr to apply on the calling thread.
+     */
+    void Apply(std::span<SRigidBodyComponent2D> bodies, float timeStep, BE::Core::CJobSystem* jobSystem);
+
+private:
+    template <typename TField>
+    uint32_t AddFieldTo(TForceFieldArray2D<TField>& fields, EForceFieldType2D type, const TField& field);
+
+    template <typename TField>
+    void RemoveFieldFrom(TForceFieldArray2D<TField>& fields, uint32_t index);
+
+    // Every field applied to bodies that fit the cache together
+    void ApplyChunk(std::span<SRigidBodyComponent2D> bodies, float timeStep) const;
+};
+
+template <typename TField>
+TField* CForceFieldRegistry2D::GetField(uint32_t fieldId)
+{
+    TForceFieldArray2D<TField>* fields = nullptr;
+    EForceFieldType2D           type = EForceFieldType2D::Count;
+
+    if constexpr (std::is_same_v<TField, SGravityField2D>)
+    {
+        fields = &GravityFields;
+        type = EForceFieldType2D::Gravity;
+    }
+    else if constexpr (std::is_same_v<TField, SDragField2D>)
+    {
+        fields = &DragFields;
+        type = EForceFieldType2D::Drag;
+    }
+    else if constexpr (std::is_same_v<TField, SAttractorField2D>)
+    {
+        fields = &AttractorFields;
+        type = EForceFieldType2D::Attractor;
+    }
+    else if constexpr (std::is_same_v<TField, SWindField2D>)
+    {
+        fields = &WindFields;
+        type = EForceFieldType2D::Wind;
+    }
+    else
+    {
+        static_assert(std::is_same_v<TField, SNBodyGravityField2D>, "TField must be one of the force field structures");
+        fields = &NBodyGravityFields;
+        type = EForceFieldType2D::NBodyGravity;
+    }
+
+    if (GetFieldType(fieldId) != type)
+    {
+        return nullptr;
+    }
+
+    return &fields->Fields[Slots[fieldId].Index];
+}
+
+NAMESPACE_END() // namespace PHYE::Physics2D
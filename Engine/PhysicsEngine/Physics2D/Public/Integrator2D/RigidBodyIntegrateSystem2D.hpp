@@ -0,0 +1,54 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <CoreMacros.hpp>
+#include <NekiraECS/Core/System/System.hpp>
+#include <Physics2D.hpp>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+// Forward Declarations
+class CPhysicsWorld2D;
+
+/**
+ * @brief ECS System integrating every rigid body of a CPhysicsWorld2D.
+ * @details The world runs IntegrateVelocities() and IntegratePositions() as its IntegrateForces and
+ * IntegratePositions stages. Registered to NekiraECS::Coordinator, OnUpdate() runs both in one go, which is useful for
+ * simulations without collision that do not call CPhysicsWorld2D::Step().
+ * Each call is a single loop over the world's dense SRigidBodyComponent2D array.
+ */
+class PHYSICS2D_API CRigidBodyIntegrateSystem2D final : public NekiraECS::System<CRigidBodyIntegrateSystem2D>
+{
+public:
+    // Bind to the world whose bodies are integrated
+    explicit CRigidBodyIntegrateSystem2D(CPhysicsWorld2D& world);
+    ~CRigidBodyIntegrateSystem2D() override = default;
+
+    CRigidBodyIntegrateSystem2D(const CRigidBodyIntegrateSystem2D&) = delete;
+    CRigidBodyIntegrateSystem2D(CRigidBodyIntegrateSystem2D&&) noexcept = default;
+
+    CRigidBodyIntegrateSystem2D& operator=(const CRigidBodyIntegrateSystem2D&) = delete;
+    CRigidBodyIntegrateSystem2D& operator=(CRigidBodyIntegrateSystem2D&&) noexcept = default;
+
+    [[nodiscard]] NekiraECS::SystemGroup GetGroup() const override;
+
+    void OnUpdate(float deltaTime) override;
+
+    // Apply the force fields of the world, then gravity, forces and damping to the velocities of Dynamic bodies
+    void IntegrateVelocities(float timeStep) const;
+
+    // Move Dynamic and Kinematic bodies with their velocities
+    void IntegratePositions(float timeStep) const;
+
+private:
+    CPhysicsWorld2D* World;
+};
+
+NAMESPACE_END() // namespace PHYE::Physics2D
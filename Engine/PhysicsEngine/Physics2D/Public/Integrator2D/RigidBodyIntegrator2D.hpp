@@ -0,0 +1,52 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <CoreMacros.hpp>
+#include <Physics2D.hpp>
+#include <Vectors/Vectors.hpp>
+#include <span>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+// Forward Declarations
+struct SRigidBodyComponent2D;
+
+/**
+ * @brief Semi-implicit Euler velocity integration over a batch of bodies.
+ * @details v += (g * GravityScale + F * InverseMass) * dt, w += Torque * InverseInertia * dt, then damping is applied.
+ * Only awake Dynamic bodies are integrated, Static and Kinematic bodies are skipped. A sleeping body with a non-zero
+ * force or torque is woken up first.
+ * @param bodies Dense body components.
+ * @param gravity Gravity acceleration of the world.
+ * @param timeStep Step length in seconds.
+ */
+PHYSICS2D_API void IntegrateVelocities2D(std::span<SRigidBodyComponent2D> bodies, const SVector2F& gravity,
+                                         float timeStep);
+
+/**
+ * @brief Semi-implicit Euler position integration over a batch of bodies.
+ * @details x += v * dt, theta += w * dt, using the velocities produced by the solver. Static and sleeping bodies
+ * are skipped, Kinematic bodies move with their own velocity.
+ * @param bodies Dense body components.
+ * @param timeStep Step length in seconds.
+ */
+PHYSICS2D_API void IntegratePositions2D(std::span<SRigidBodyComponent2D> bodies, float timeStep);
+
+/**
+ * @brief Reset accumulated force and torque of every body.
+ */
+PHYSICS2D_API void ClearForces2D(std::span<SRigidBodyComponent2D> bodies);
+
+/**
+ * @brief Write Position and Rotation of every non-static body back to its Transform.
+ */
+PHYSICS2D_API void SyncTransforms2D(std::span<SRigidBodyComponent2D> bodies);
+
+NAMESPACE_END() // namespace PHYE::Physics2D
@@ -0,0 +1,133 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <CoreMacros.hpp>
+#include <Physics2D.hpp>
+#include <PhysicsWorld2D/BodyId2D.hpp>
+#include <Vectors/Vectors.hpp>
+#include <cstdint>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+// Dense index or slot of a joint that does not exist
+constexpr uint32_t INVALID_JOINT_ID = static_cast<uint32_t>(-1);
+
+// Most velocity rows of a joint(a weld: two linear, one angular)
+constexpr uint32_t MAX_JOINT_ROWS_2D = 3;
+
+// Fraction of the position error of a joint removed per step by the velocity bias
+constexpr float JOINT_BAUMGARTE_2D = 0.2F;
+
+/**
+ * @brief Handle of a joint, only meaningful in the CPhysicsWorld2D that created it.
+ * @details Like SBodyId2D, the generation of a slot is bumped when its joint is destroyed(also implicitly with one of
+ * its bodies), so an id kept after that never resolves to a joint created later in the same slot.
+ */
+struct SJointId2D final
+{
+    // Slot in the joint storage of the world
+    uint32_t Index = INVALID_JOINT_ID;
+
+    // Generation of the slot when the joint was created, 0 for an invalid id
+    uint16_t Generation = 0;
+
+    [[nodiscard]] bool IsValid() const
+    {
+        return Generation != 0;
+    }
+
+    bool operator==(const SJointId2D& other) const
+    {
+        return Index == other.Index && Generation == other.Generation;
+    }
+};
+
+/**
+ * @brief Kinds of joints, see the definitions below.
+ */
+enum class EJointType2D : uint8_t
+{
+    Distance = 0,
+    Revolute,
+    Prismatic,
+    Weld,
+
+    Count
+};
+
+/**
+ * @brief Keeps the anchors of two bodies at a fixed distance, like a rigid rod(it pushes as well as pulls).
+ * @details Anchors are in the local space of their body, relative to the body position.
+ */
+struct SDistanceJointDef2D final
+{
+    SBodyId2D BodyA;
+    SBodyId2D BodyB;
+
+    SVector2F LocalAnchorA;
+    SVector2F LocalAnchorB;
+
+    float Length = 1.0F;
+
+    // Let the colliders of the two bodies touch each other
+    bool CollideConnected = false;
+};
+
+/**
+ * @brief Pins the anchors of two bodies together, the bodies rotate freely around the shared point.
+ */
+struct SRevoluteJointDef2D final
+{
+    SBodyId2D BodyA;
+    SBodyId2D BodyB;
+
+    SVector2F LocalAnchorA;
+    SVector2F LocalAnchorB;
+
+    bool CollideConnected = false;
+};
+
+/**
+ * @brief Lets the anchor of B slide along an axis fixed to A, without rotating relative to A.
+ */
+struct SPrismaticJointDef2D final
+{
+    SBodyId2D BodyA;
+    SBodyId2D BodyB;
+
+    SVector2F LocalAnchorA;
+    SVector2F LocalAnchorB;
+
+    // Sliding axis in the local space of A, normalized when the joint is created
+    SVector2F LocalAxisA = SVector2F(1.0F, 0.0F);
+
+    // Rotation of B minus the rotation of A that the joint keeps
+    float ReferenceAngle = 0.0F;
+
+    bool CollideConnected = false;
+};
+
+/**
+ * @brief Glues two bodies together: pins their anchors and keeps their relative rotation.
+ */
+struct SWeldJointDef2D final
+{
+    SBodyId2D BodyA;
+    SBodyId2D BodyB;
+
+    SVector2F LocalAnchorA;
+    SVector2F LocalAnchorB;
+
+    float ReferenceAngle = 0.0F;
+
+    bool CollideConnected = false;
+};
+
+NAMESPACE_END() // namespace PHYE::Physics2D
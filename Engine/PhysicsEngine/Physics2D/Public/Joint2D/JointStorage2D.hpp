@@ -0,0 +1,117 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <CoreMacros.hpp>
+#include <Joint2D/Joint2D.hpp>
+#include <Physics2D.hpp>
+#include <PhysicsWorld2D/BodyId2D.hpp>
+#include <Vectors/Vectors.hpp>
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+/**
+ * @brief Joints of a CPhysicsWorld2D, stored as structure of arrays.
+ * @details Every joint kind shares the same dense arrays, indexed by the dense joint index: a field a kind does not
+ * use keeps its default(e.g. Lengths of a weld). The solver reads the arrays it needs in one pass per step instead of
+ * walking joint objects, and packs the joints into SIMD batches with the contacts.
+ * Slots are reused after a joint is removed, with a new generation, so a stale id never resolves to a later joint.
+ * Removing a joint moves the last one into its place, so dense indices change; spans are invalidated by Add() and
+ * Remove().
+ */
+class PHYSICS2D_API CJointStorage2D final
+{
+private:
+    std::vector<EJointType2D> Types;
+    std::vector<SBodyId2D>    BodiesA;
+    std::vector<SBodyId2D>    BodiesB;
+    std::vector<SVector2F>    LocalAnchorsA;
+    std::vector<SVector2F>    LocalAnchorsB;
+
+    // Sliding axis in the local space of A(Prismatic)
+    std::vector<SVector2F> LocalAxes;
+
+    // Relative rotation kept by the joint(Prismatic, Weld), and the rod length(Distance)
+    std::vector<float> ReferenceAngles;
+    std::vector<float> Lengths;
+
+    std::vector<uint8_t> CollideConnected;
+
+    // Accumulated impulse of every row, used to warm start the next step
+    std::array<std::vector<float>, MAX_JOINT_ROWS_2D> Impulses;
+
+    // Dense index -> joint id, and slot -> dense index(INVALID_JOINT_ID for a free slot)
+    std::vector<SJointId2D> Ids;
+    std::vector<uint32_t>   DenseIndices;
+
+    // Current generation of every slot, bumped when its joint is removed
+    std::vector<uint16_t> Generations;
+
+    std::vector<uint32_t> FreeIds;
+
+public:
+    CJointStorage2D() = default;
+    ~CJointStorage2D() = default;
+
+    CJointStorage2D(const CJointStorage2D&) = default;
+    CJointStorage2D(CJointStorage2D&&) noexcept = default;
+
+    CJointStorage2D& operator=(const CJointStorage2D&) = default;
+    CJointStorage2D& operator=(CJointStorage2D&&) noexcept = default;
+
+    // Add a joint and return its id
+    SJointId2D Add(const SDistanceJointDef2D& def);
+    SJointId2D Add(const SRevoluteJointDef2D& def);
+    SJointId2D Add(const SPrismaticJointDef2D& def);
+    SJointId2D Add(const SWeldJointDef2D& def);
+
+    // Remove a joint, its slot may be handed out again with a new generation
+    void Remove(SJointId2D jointId);
+
+    [[nodiscard]] bool Contains(SJointId2D jointId) const;
+
+    // Dense index of a joint, INVALID_JOINT_ID if the id does not exist
+    [[nodiscard]] uint32_t GetDenseIndex(SJointId2D jointId) const;
+
+    [[nodiscard]] uint32_t Size() const;
+
+    void Clear();
+
+    // Drop the accumulated impulses, e.g. when warm starting is turned off
+    void ResetImpulses();
+
+    // Dense arrays
+    [[nodiscard]] std::span<const EJointType2D> GetTypes() const;
+    [[nodiscard]] std::span<const SBodyId2D>    GetBodiesA() const;
+    [[nodiscard]] std::span<const SBodyId2D>    GetBodiesB() const;
+    [[nodiscard]] std::span<const SVector2F>    GetLocalAnchorsA() const;
+    [[nodiscard]] std::span<const SVector2F>    GetLocalAnchorsB() const;
+    [[nodiscard]] std::span<const SVector2F>    GetLocalAxes() const;
+    [[nodiscard]] std::span<const float>        GetReferenceAngles() const;
+    [[nodiscard]] std::span<const float>        GetLengths() const;
+    [[nodiscard]] std::span<const uint8_t>      GetCollideConnected() const;
+    [[nodiscard]] std::span<const SJointId2D>   GetIds() const;
+
+    // Accumulated impulse of a row of every joint: the x/y force or the rod force, then the torque
+    [[nodiscard]] std::span<float>       GetImpulses(uint32_t row);
+    [[nodiscard]] std::span<const float> GetImpulses(uint32_t row) const;
+
+    // Change the length of a distance joint, e.g. for a winch
+    void SetLength(SJointId2D jointId, float length);
+
+private:
+    SJointId2D AddJoint(EJointType2D type, const SBodyId2D& bodyA, const SBodyId2D& bodyB,
+                        const SVector2F& localAnchorA, const SVector2F& localAnchorB, bool collideConnected);
+};
+
+NAMESPACE_END() // namespace PHYE::Physics2D
@@ -0,0 +1,635 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <CoreMacros.hpp>
+#include <MathUtility/MathUtilities.hpp>
+#include <NarrowPhase2D/ContactManifold2D.hpp>
+#include <NarrowPhase2D/Distance2D.hpp>
+#include <Rigid2D/Geometry2D/Circle2D.hpp>
+#include <Rigid2D/Geometry2D/Line2D.hpp>
+#include <Rigid2D/Geometry2D/Point2D.hpp>
+#include <Rigid2D/Geometry2D/Polygon2D.hpp>
+#include <Rigid2D/Geometry2D/Pose2D.hpp>
+#include <Rigid2D/Geometry2D/Rectangle2D.hpp>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+/**
+ * Collide functions of the narrowphase.
+ * Shapes are first converted to plain world-space data(ToShapeData), then a collide function writes the manifold with
+ * the normal pointing from the first shape to the second. They are defined inline so that the batched narrowphase loop
+ * of every shape pair compiles to straight-line code.
+ * The manifold comes in with the GJK simplex cache of the previous step already set, the GJK based functions update it.
+ */
+
+// Circle(or point, with zero radius) in world space
+struct SCircleShapeData2D final
+{
+    SVector2F Center;
+    float     Radius;
+};
+
+// Oriented box in world space, AxisX/AxisY are the unit axes of the box
+struct SBoxShapeData2D final
+{
+    SVector2F Center;
+    SVector2F HalfExtents;
+    SVector2F AxisX;
+    SVector2F AxisY;
+};
+
+// Segment in world space
+struct SSegmentShapeData2D final
+{
+    SVector2F Start;
+    SVector2F End;
+};
+
+/**
+ * @brief Convex polygon in world space, used by the SAT collide functions.
+ * @details Vertices are counter-clockwise, Normals[i] is the outward normal of the edge Vertices[i] -> Vertices[i+1].
+ * A segment is the 2-gon {Start, End} with two opposite normals.
+ */
+struct SPolygonShapeData2D final
+{
+    std::array<SVector2F, MAX_POLYGON_VERTICES_2D> Vertices;
+    std::array<SVector2F, MAX_POLYGON_VERTICES_2D> Normals;
+    uint32_t                                       Count = 0;
+};
+
+// Shape -> world-space data
+[[nodiscard]] inline SCircleShapeData2D ToShapeData(const CPoint2D& point, const SPose2D& pose)
+{
+    return {pose.TransformPoint(point.ToVector2F()), 0.0F};
+}
+
+[[nodiscard]] inline SCircleShapeData2D ToShapeData(const CCircle2D& circle, const SPose2D& pose)
+{
+    return {pose.TransformPoint(circle.GetCenter().ToVector2F()), circle.GetRadius()};
+}
+
+[[nodiscard]] inline SSegmentShapeData2D ToShapeData(const CLine2D& line, const SPose2D& pose)
+{
+    return {pose.TransformPoint(line.GetStart().ToVector2F()), pose.TransformPoint(line.GetEnd().ToVector2F())};
+}
+
+[[nodiscard]] inline SBoxShapeData2D ToShapeData(const CRectangle2D& rectangle, const SPose2D& pose)
+{
+    const SVector2F LOCAL_CENTER = (rectangle.GetOrigin().ToVector2F() + rectangle.GetEnd().ToVector2F()) * 0.5F;
+
+    return {pose.TransformPoint(LOCAL_CENTER), SVector2F(rectangle.Width() * 0.5F, rectangle.Height() * 0.5F),
+            SVector2F(pose.Cos, pose.Sin), SVector2F(-pose.Sin, pose.Cos)};
+}
+
+[[nodiscard]] inline SBoxShapeData2D ToShapeData(const COrientedRectangle2D& rectangle, const SPose2D& pose)
+{
+    const SPose2D BOX_POSE =
+        pose * SPose2D(rectangle.GetCenter().ToVector2F(), BE::Math::DegreesToRadians(rectangle.GetAngle()));
+
+    return {BOX_POSE.Position, rectangle.GetHalfExtents(), SVector2F(BOX_POSE.Cos, BOX_POSE.Sin),
+            SVector2F(-BOX_POSE.Sin, BOX_POSE.Cos)};
+}
+
+[[nodiscard]] inline SPolygonShapeData2D ToShapeData(const CPolygon2D& polygon, const SPose2D& pose)
+{
+    const auto VERTICES = polygon.GetVertices();
+    const auto NORMALS = polygon.GetNormals();
+
+    SPolygonShapeData2D data;
+    data.Count = polygon.GetVertexCount();
+
+    for (uint32_t index = 0; index < data.Count; ++index)
+    {
+        data.Vertices[index] = pose.TransformPoint(VERTICES[index]);
+        data.Normals[index] = pose.Rotate(NORMALS[index]);
+    }
+
+    return data;
+}
+
+// Below this length a direction is treated as degenerate
+constexpr float COLLIDE_LINEAR_EPSILON_2D = 1.0E-6F;
+
+// Box -> polygon, counter-clockwise from the (-X, -Y) corner
+[[nodiscard]] inline SPolygonShapeData2D ToPolygon(const SBoxShapeData2D& box)
+{
+    const SVector2F EXTENT_X = box.AxisX * box.HalfExtents.X;
+    const SVector2F EXTENT_Y = box.AxisY * box.HalfExtents.Y;
+
+    SPolygonShapeData2D polygon;
+    polygon.Count = 4;
+
+    polygon.Vertices[0] = box.Center - EXTENT_X - EXTENT_Y;
+    polygon.Vertices[1] = box.Center + EXTENT_X - EXTENT_Y;
+    polygon.Vertices[2] = box.Center + EXTENT_X + EXTENT_Y;
+    polygon.Vertices[3] = box.Center - EXTENT_X + EXTENT_Y;
+
+    polygon.Normals[0] = -box.AxisY;
+    polygon.Normals[1] = box.AxisX;
+    polygon.Normals[2] = box.AxisY;
+    polygon.Normals[3] = -box.AxisX;
+
+    return polygon;
+}
+
+// Segment -> 2-gon
+[[nodiscard]] inline SPolygonShapeData2D ToPolygon(const SSegmentShapeData2D& segment)
+{
+    const SVector2F EDGE = segment.End - segment.Start;
+    const float     LENGTH = std::sqrt(EDGE | EDGE);
+    const SVector2F NORMAL =
+        LENGTH > COLLIDE_LINEAR_EPSILON_2D ? SVector2F(EDGE.Y, -EDGE.X) * (1.0F / LENGTH) : SVector2F(0.0F, 1.0F);
+
+    SPolygonShapeData2D polygon;
+    polygon.Count = 2;
+
+    polygon.Vertices[0] = segment.Start;
+    polygon.Vertices[1] = segment.End;
+
+    polygon.Normals[0] = NORMAL;
+    polygon.Normals[1] = -NORMAL;
+
+    return polygon;
+}
+
+/**
+ * @brief Circle vs circle.
+ */
+[[nodiscard]] inline bool CollideCircles(const SCircleShapeData2D& circleA, const SCircleShapeData2D& circleB,
+                                         SContactManifold2D& manifold)
+{
+    const SVector2F DELTA = circleB.Center - circleA.Center;
+    const float     RADIUS = circleA.Radius + circleB.Radius;
+    const float     MAX_DISTANCE = RADIUS + CONTACT_SPECULATIVE_DISTANCE_2D;
+    const float     DISTANCE_SQUARED = DELTA | DELTA;
+
+    if (DISTANCE_SQUARED > MAX_DISTANCE * MAX_DISTANCE)
+    {
+        return false;
+    }
+
+    const float     DISTANCE = std::sqrt(DISTANCE_SQUARED);
+    const SVector2F NORMAL = DISTANCE > COLLIDE_LINEAR_EPSILON_2D ? DELTA * (1.0F / DISTANCE) : SVector2F(0.0F, 1.0F);
+
+    const SVector2F SURFACE_A = circleA.Center + (NORMAL * circleA.Radius);
+    const SVector2F SURFACE_B = circleB.Center - (NORMAL * circleB.Radius);
+
+    manifold.Normal = NORMAL;
+    manifold.Points[0].Position = (SURFACE_A + SURFACE_B) * 0.5F;
+    manifold.Points[0].Separation = DISTANCE - RADIUS;
+    manifold.Points[0].FeatureId = 0;
+    manifold.PointCount = 1;
+
+    return true;
+}
+
+/**
+ * @brief Circle vs oriented box.
+ */
+[[nodiscard]] inline bool CollideCircleBox(const SCircleShapeData2D& circle, const SBoxShapeData2D& box,
+                                           SContactManifold2D& manifold)
+{
+    // 在盒子的局部空间中求最近点
+    const SVector2F  DELTA = circle.Center - box.Center;
+    const SVector2F  LOCAL_CENTER(DELTA | box.AxisX, DELTA | box.AxisY);
+    const SVector2F& halfExtents = box.HalfExtents;
+
+    SVector2F localClosest(BE::Math::Clamp(LOCAL_CENTER.X, -halfExtents.X, halfExtents.X),
+                           BE::Math::Clamp(LOCAL_CENTER.Y, -halfExtents.Y, halfExtents.Y));
+
+    // 盒子指向圆心的法线(局部空间)与圆心到盒子表面的有符号距离
+    SVector2F localNormal;
+    float     distance = 0.0F;
+
+    const SVector2F OFFSET = LOCAL_CENTER - localClosest;
+    const float     OFFSET_SQUARED = OFFSET | OFFSET;
+
+    if (OFFSET_SQUARED > COLLIDE_LINEAR_EPSILON_2D * COLLIDE_LINEAR_EPSILON_2D)
+    {
+        const float MAX_DISTANCE = circle.Radius + CONTACT_SPECULATIVE_DISTANCE_2D;
+        if (OFFSET_SQUARED > MAX_DISTANCE * MAX_DISTANCE)
+        {
+            return false;
+        }
+
+        distance = std::sqrt(OFFSET_SQUARED);
+        localNormal = OFFSET * (1.0F / distance);
+    }
+    else
+    {
+        // 圆心在盒子内部：沿穿透最浅的轴推出
+        const float DEPTH_X = halfExtents.X - std::abs(LOCAL_CENTER.X);
+        const float DEPTH_Y = halfExtents.Y - std::abs(LOCAL_CENTER.Y);
+
+        if (DEPTH_X < DEPTH_Y)
+        {
+            const float SIGN = LOCAL_CENTER.X < 0.0F ? -1.0F : 1.0F;
+            localNormal = SVector2F(SIGN, 0.0F);
+            localClosest.X = SIGN * halfExtents.X;
+            distance = -DEPTH_X;
+        }
+        else
+        {
+            const float SIGN = LOCAL_CENTER.Y < 0.0F ? -1.0F : 1.0F;
+            localNormal = SVector2F(0.0F, SIGN);
+            localClosest.Y = SIGN * halfExtents.Y;
+            distance = -DEPTH_Y;
+        }
+    }
+
+    const SVector2F BOX_TO_CIRCLE = (box.AxisX * localNormal.X) + (box.AxisY * localNormal.Y);
+    const SVector2F CLOSEST = box.Center + (box.AxisX * localClosest.X) + (box.AxisY * localClosest.Y);
+
+    // 圆是 A，法线从圆指向盒子
+    manifold.Normal = -BOX_TO_CIRCLE;
+
+    const SVector2F SURFACE_A = circle.Center + (manifold.Normal * circle.Radius);
+
+    manifold.Points[0].Position = (SURFACE_A + CLOSEST) * 0.5F;
+    manifold.Points[0].Separation = distance - circle.Radius;
+    manifold.Points[0].FeatureId = 0;
+    manifold.PointCount = 1;
+
+    return true;
+}
+
+/**
+ * @brief Circle vs segment.
+ */
+[[nodiscard]] inline bool CollideCircleSegment(const SCircleShapeData2D& circle, const SSegmentShapeData2D& segment,
+                                               SContactManifold2D& manifold)
+{
+    const SVector2F EDGE = segment.End - segment.Start;
+    const float     LENGTH_SQUARED = EDGE | EDGE;
+
+    // 最近点所在的特征：0 = 线段内部，1 = 起点，2 = 终点
+    float    t = 0.0F;
+    uint32_t featureId = 1;
+    if (LENGTH_SQUARED > COLLIDE_LINEAR_EPSILON_2D * COLLIDE_LINEAR_EPSILON_2D)
+    {
+        t = ((circle.Center - segment.Start) | EDGE) / LENGTH_SQUARED;
+        if (t <= 0.0F)
+        {
+            t = 0.0F;
+        }
+        else if (t >= 1.0F)
+        {
+            t = 1.0F;
+            featureId = 2;
+        }
+        else
+        {
+            featureId = 0;
+        }
+    }
+
+    const SVector2F CLOSEST = segment.Start + (EDGE * t);
+    const SVector2F DELTA = CLOSEST - circle.Center;
+    const float     DISTANCE_SQUARED = DELTA | DELTA;
+    const float     MAX_DISTANCE = circle.Radius + CONTACT_SPECULATIVE_DISTANCE_2D;
+
+    if (DISTANCE_SQUARED > MAX_DISTANCE * MAX_DISTANCE)
+    {
+        return false;
+    }
+
+    const float DISTANCE = std::sqrt(DISTANCE_SQUARED);
+
+    SVector2F normal;
+    if (DISTANCE > COLLIDE_LINEAR_EPSILON_2D)
+    {
+        normal = DELTA * (1.0F / DISTANCE);
+    }
+    else if (LENGTH_SQUARED > COLLIDE_LINEAR_EPSILON_2D * COLLIDE_LINEAR_EPSILON_2D)
+    {
+        // 圆心恰好在线段上：取线段的法线
+        normal = SVector2F(EDGE.Y, -EDGE.X) * (1.0F / std::sqrt(LENGTH_SQUARED));
+    }
+    else
+    {
+        normal = SVector2F(0.0F, 1.0F);
+    }
+
+    const SVector2F SURFACE_A = circle.Center + (normal * circle.Radius);
+
+    manifold.Normal = normal;
+    manifold.Points[0].Position = (SURFACE_A + CLOSEST) * 0.5F;
+    manifold.Points[0].Separation = DISTANCE - circle.Radius;
+    manifold.Points[0].FeatureId = featureId;
+    manifold.PointCount = 1;
+
+    return true;
+}
+
+/**
+ * @brief Largest separation of polygonB along the edge normals of polygonA.
+ * @param outEdge Edge of polygonA achieving it.
+ */
+[[nodiscard]] inline float FindMaxSeparation(const SPolygonShapeData2D& polygonA, const SPolygonShapeData2D& polygonB,
+                                             uint32_t& outEdge)
+{
+    float maxSeparation = -std::numeric_limits<float>::max();
+    outEdge = 0;
+
+    for (uint32_t edge = 0; edge < polygonA.Count; ++edge)
+    {
+        const SVector2F& normal = polygonA.Normals[edge];
+        const SVector2F& vertex = polygonA.Vertices[edge];
+
+        // polygonB 在该法线方向上最深的顶点
+        float separation = std::numeric_limits<float>::max();
+        for (uint32_t index = 0; index < polygonB.Count; ++index)
+        {
+            separation = BE::Math::Min(separation, normal | (polygonB.Vertices[index] - vertex));
+        }
+
+        if (separation > maxSeparation)
+        {
+            maxSeparation = separation;
+            outEdge = edge;
+        }
+    }
+
+    return maxSeparation;
+}
+
+// Point of the incident edge during clipping, with its feature id
+struct SClipVertex2D final
+{
+    SVector2F Position;
+    uint32_t  FeatureId;
+};
+
+/**
+ * @brief Feature id of a clip point.
+ * @details The high byte is the feature on the reference polygon and the low byte the feature on the incident polygon,
+ * 0x80 marks a vertex(for the reference polygon) or an edge(for the incident polygon) instead of the default feature.
+ */
+[[nodiscard]] constexpr uint32_t MakeClipFeatureId(uint32_t referenceFeature, uint32_t incidentFeature)
+{
+    return ((referenceFeature & 0xFFU) << 8) | (incidentFeature & 0xFFU);
+}
+
+/**
+ * @brief Clip a segment against the half plane (normal | x) <= offset.
+ * @param clipVertex Reference vertex that defines the plane, recorded in the id of a clipped point.
+ * @return Number of output points, the segment is lost when it is below 2.
+ */
+inline uint32_t ClipSegmentToLine(std::array<SClipVertex2D, 2>& output, const std::array<SClipVertex2D, 2>& input,
+                                  const SVector2F& normal, float offset, uint32_t clipVertex, uint32_t incidentEdge)
+{
+    uint32_t count = 0;
+
+    const float DISTANCE0 = (normal | input[0].Position) - offset;
+    const float DISTANCE1 = (normal | input[1].Position) - offset;
+
+    if (DISTANCE0 <= 0.0F)
+    {
+        output[count++] = input[0];
+    }
+
+    if (DISTANCE1 <= 0.0F)
+    {
+        output[count++] = input[1];
+    }
+
+    // 两端点位于平面两侧：求交点，其特征为(参考顶点, 入射边)
+    if (DISTANCE0 * DISTANCE1 < 0.0F)
+    {
+        const float INTERPOLATION = DISTANCE0 / (DISTANCE0 - DISTANCE1);
+
+        output[count].Position = input[0].Position + ((input[1].Position - input[0].Position) * INTERPOLATION);
+        output[count].FeatureId = MakeClipFeatureId(clipVertex | 0x80U, incidentEdge | 0x80U);
+        ++count;
+    }
+
+    return count;
+}
+
+/**
+ * @brief Convex polygon vs convex polygon with the separating axis theorem.
+ * @details The polygon whose edge gives the largest separation provides the reference face, the most anti-parallel
+ * edge of the other polygon is the incident edge. The incident edge is clipped against the side planes of the
+ * reference face, producing up to two points with feature ids that persist as long as the same features touch.
+ */
+[[nodiscard]] inline bool CollidePolygons(const SPolygonShapeData2D& polygonA, const SPolygonShapeData2D& polygonB,
+                                          SContactManifold2D& manifold)
+{
+    uint32_t    edgeA = 0;
+    const float SEPARATION_A = FindMaxSeparation(polygonA, polygonB, edgeA);
+    if (SEPARATION_A > CONTACT_SPECULATIVE_DISTANCE_2D)
+    {
+        return false;
+    }
+
+    uint32_t    edgeB = 0;
+    const float SEPARATION_B = FindMaxSeparation(polygonB, polygonA, edgeB);
+    if (SEPARATION_B > CONTACT_SPECULATIVE_DISTANCE_2D)
+    {
+        return false;
+    }
+
+    // 选择参考面：带少量偏向 A，避免两者接近时参考面来回切换破坏特征ID的连续性
+    constexpr float FLIP_TOLERANCE = 0.1F * LINEAR_SLOP_2D;
+
+    const bool                 FLIP = SEPARATION_B > SEPARATION_A + FLIP_TOLERANCE;
+    const SPolygonShapeData2D& reference = FLIP ? polygonB : polygonA;
+    const SPolygonShapeData2D& incident = FLIP ? polygonA : polygonB;
+    const uint32_t             REFERENCE_EDGE = FLIP ? edgeB : edgeA;
+
+    // 1. 入射边：法线与参考面法线最反向的边
+    const SVector2F& referenceNormal = reference.Normals[REFERENCE_EDGE];
+
+    uint32_t incidentEdge = 0;
+    float    minDot = std::numeric_limits<float>::max();
+    for (uint32_t edge = 0; edge < incident.Count; ++edge)
+    {
+        const float DOT = referenceNormal | incident.Normals[edge];
+        if (DOT < minDot)
+        {
+            minDot = DOT;
+            incidentEdge = edge;
+        }
+    }
+
+    const uint32_t INCIDENT_VERTEX1 = incidentEdge;
+    const uint32_t INCIDENT_VERTEX2 = (incidentEdge + 1 < incident.Count) ? incidentEdge + 1 : 0;
+
+    const std::array<SClipVertex2D, 2> INCIDENT_POINTS = {
+        SClipVertex2D{incident.Vertices[INCIDENT_VERTEX1], MakeClipFeatureId(REFERENCE_EDGE, INCIDENT_VERTEX1)},
+        SClipVertex2D{incident.Vertices[INCIDENT_VERTEX2], MakeClipFeatureId(REFERENCE_EDGE, INCIDENT_VERTEX2)}};
+
+    // 2. 参考面的两个侧平面
+    const uint32_t REFERENCE_VERTEX1 = REFERENCE_EDGE;
+    const uint32_t REFERENCE_VERTEX2 = (REFERENCE_EDGE + 1 < reference.Count) ? REFERENCE_EDGE + 1 : 0;
+
+    const SVector2F& vertex1 = reference.Vertices[REFERENCE_VERTEX1];
+    const SVector2F& vertex2 = reference.Vertices[REFERENCE_VERTEX2];
+
+    const SVector2F EDGE = vertex2 - vertex1;
+    const float     EDGE_LENGTH = std::sqrt(EDGE | EDGE);
+    const SVector2F TANGENT = EDGE_LENGTH > COLLIDE_LINEAR_EPSILON_2D ? EDGE * (1.0F / EDGE_LENGTH)
+                                                                     : SVector2F(-referenceNormal.Y, referenceNormal.X);
+
+    const float FRONT_OFFSET = referenceNormal | vertex1;
+    const float SIDE_OFFSET1 = -(TANGENT | vertex1);
+    const float SIDE_OFFSET2 = TANGENT | vertex2;
+
+    // 3. 裁剪入射边
+    std::array<SClipVertex2D, 2> clipPoints1;
+    std::array<SClipVertex2D, 2> clipPoints2;
+
+    if (ClipSegmentToLine(clipPoints1, INCIDENT_POINTS, -TANGENT, SIDE_OFFSET1, REFERENCE_VERTEX1, incidentEdge) < 2)
+    {
+        return false;
+    }
+
+    if (ClipSegmentToLine(clipPoints2, clipPoints1, TANGENT, SIDE_OFFSET2, REFERENCE_VERTEX2, incidentEdge) < 2)
+    {
+        return false;
+    }
+
+    // 4. 保留位于参考面前方推测距离以内的点
+    manifold.Normal = FLIP ? -referenceNormal : referenceNormal;
+    manifold.PointCount = 0;
+
+    for (const auto& clipPoint : clipPoints2)
+    {
+        const float SEPARATION = (referenceNormal | clipPoint.Position) - FRONT_OFFSET;
+        if (SEPARATION > CONTACT_SPECULATIVE_DISTANCE_2D)
+        {
+            continue;
+        }
+
+        // 特征ID的高字节始终对应 A 上的特征，低字节对应 B，FLIP 时额外置位以区分
+        const uint32_t REFERENCE_FEATURE = clipPoint.FeatureId >> 8;
+        const uint32_t INCIDENT_FEATURE = clipPoint.FeatureId & 0xFFU;
+
+        SContactPoint2D& point = manifold.Points[manifold.PointCount++];
+        point.Position = clipPoint.Position - (referenceNormal * (0.5F * SEPARATION));
+        point.Separation = SEPARATION;
+        point.FeatureId = FLIP ? (MakeClipFeatureId(INCIDENT_FEATURE, REFERENCE_FEATURE) | 0x10000U)
+                               : clipPoint.FeatureId;
+    }
+
+    return manifold.PointCount > 0;
+}
+
+/**
+ * @brief Oriented box vs oriented box(covers CRectangle2D and COrientedRectangle2D).
+ */
+[[nodiscard]] inline bool CollideBoxes(const SBoxShapeData2D& boxA, const SBoxShapeData2D& boxB,
+                                       SContactManifold2D& manifold)
+{
+    return CollidePolygons(ToPolygon(boxA), ToPolygon(boxB), manifold);
+}
+
+/**
+ * @brief Segment vs oriented box.
+ */
+[[nodiscard]] inline bool CollideSegmentBox(const SSegmentShapeData2D& segment, const SBoxShapeData2D& box,
+                                            SContactManifold2D& manifold)
+{
+    return CollidePolygons(ToPolygon(segment), ToPolygon(box), manifold);
+}
+
+/**
+ * @brief Circle vs convex polygon.
+ * @details GJK gives the closest points while the center is outside of the polygon, EPA the shallowest exit direction
+ * once it is inside.
+ */
+[[nodiscard]] inline bool CollideCirclePolygon(const SCircleShapeData2D& circle, const SPolygonShapeData2D& polygon,
+                                               SContactManifold2D& manifold)
+{
+    const std::span<const SVector2F> CENTER(&circle.Center, 1);
+    const std::span<const SVector2F> VERTICES(polygon.Vertices.data(), polygon.Count);
+
+    const SDistanceOutput2D DISTANCE = ComputeDistance(CENTER, VERTICES, manifold.SimplexCache);
+
+    if (DISTANCE.Distance > circle.Radius + CONTACT_SPECULATIVE_DISTANCE_2D)
+    {
+        return false;
+    }
+
+    SVector2F normal;
+    SVector2F surfacePoint;
+    float     separation = 0.0F;
+
+    if (DISTANCE.Distance > COLLIDE_LINEAR_EPSILON_2D)
+    {
+        normal = (DISTANCE.PointB - DISTANCE.PointA) * (1.0F / DISTANCE.Distance);
+        surfacePoint = DISTANCE.PointB;
+        separation = DISTANCE.Distance - circle.Radius;
+    }
+    else
+    {
+        // 圆心在多边形内部
+        SPenetrationOutput2D penetration;
+        if (!ComputePenetration(CENTER, VERTICES, manifold.SimplexCache, penetration))
+        {
+            return false;
+        }
+
+        normal = penetration.Normal;
+        surfacePoint = penetration.PointB;
+        separation = -penetration.Depth - circle.Radius;
+    }
+
+    manifold.Normal = normal;
+    manifold.PointCount = 1;
+
+    // 取圆表面最深点与多边形表面点的中点
+    SContactPoint2D& point = manifold.Points[0];
+    point.Position = ((circle.Center + (normal * circle.Radius)) + surfacePoint) * 0.5F;
+    point.Separation = separation;
+    point.FeatureId = 0;
+
+    return true;
+}
+
+/**
+ * @brief Convex polygon vs convex polygon, with a GJK early-out before SAT.
+ * @details With the simplex cache of the previous step GJK usually settles in one or two iterations, which is cheaper
+ * than the full SAT for polygons with many vertices. Pairs closer than the speculative distance go through SAT.
+ */
+[[nodiscard]] inline bool CollideConvexPolygons(const SPolygonShapeData2D& polygonA, const SPolygonShapeData2D& polygonB,
+                                                SContactManifold2D& manifold)
+{
+    const SDistanceOutput2D DISTANCE =
+        ComputeDistance(std::span<const SVector2F>(polygonA.Vertices.data(), polygonA.Count),
+                        std::span<const SVector2F>(polygonB.Vertices.data(), polygonB.Count), manifold.SimplexCache);
+
+    if (DISTANCE.Distance > CONTACT_SPECULATIVE_DISTANCE_2D)
+    {
+        return false;
+    }
+
+    return CollidePolygons(polygonA, polygonB, manifold);
+}
+
+// Segment vs convex polygon
+[[nodiscard]] inline bool CollideSegmentPolygon(const SSegmentShapeData2D& segment, const SPolygonShapeData2D& polygon,
+                                                SContactManifold2D& manifold)
+{
+    return CollideConvexPolygons(ToPolygon(segment), polygon, manifold);
+}
+
+// Oriented box vs convex polygon
+[[nodiscard]] inline bool CollideBoxPolygon(const SBoxShapeData2D& box, const SPolygonShapeData2D& polygon,
+                                            SContactManifold2D& manifold)
+{
+    return CollideConvexPolygons(ToPolygon(box), polygon, manifold);
+}
+
+NAMESPACE_END() // namespace PHYE::Physics2D
@@ -0,0 +1,102 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <CoreMacros.hpp>
+#include <NarrowPhase2D/ContactManifold2D.hpp>
+#include <NarrowPhase2D/PairHashMap2D.hpp>
+#include <Physics2D.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+/**
+ * @brief Solved contact manifolds of the previous step, keyed by collider pair.
+ * @details The narrowphase looks up the previous manifold of every pair it collides: the GJK simplex cache is handed
+ * to the collide function, and the accumulated impulses of points with the same feature id are carried over so the
+ * solver starts from last step's solution(warm starting).
+ */
+class PHYSICS2D_API CContactCache2D final
+{
+private:
+    // Pair -> index in Manifolds
+    CPairHashMap2D ManifoldIndices;
+
+    std::vector<SContactManifold2D> Manifolds;
+
+public:
+    CContactCache2D() = default;
+    ~CContactCache2D() = default;
+
+    CContactCache2D(const CContactCache2D&) = delete;
+    CContactCache2D(CContactCache2D&&) noexcept = default;
+
+    CContactCache2D& operator=(const CContactCache2D&) = delete;
+    CContactCache2D& operator=(CContactCache2D&&) noexcept = default;
+
+    /**
+     * @brief Manifold of the pair at the end of the previous step.
+     * @param colliderA colliderB Same order as in the manifold(ordered by shape type).
+     * @return nullptr if the pair had no manifold.
+     */
+    [[nodiscard]] const SContactManifold2D* Find(uint32_t colliderA, uint32_t colliderB) const
+    {
+        const uint32_t INDEX = ManifoldIndices.Find(CPairHashMap2D::MakeKey(colliderA, colliderB));
+        return INDEX != CPairHashMap2D::INVALID_VALUE ? &Manifolds[INDEX] : nullptr;
+    }
+
+    // Replace the cached manifolds with the solved manifolds of this step
+    void Store(std::span<const SContactManifold2D> manifolds);
+
+    void Clear();
+
+    /**
+     * @brief Overwrite this cache with another one, for world snapshots.
+     * @details Capacities grow geometrically, so copying a slowly growing cache into the same buffer rarely allocates.
+     */
+    void CopyFrom(const CContactCache2D& other);
+
+    [[nodiscard]] size_t Size() const
+    {
+        return Manifolds.size();
+    }
+};
+
+/**
+ * @brief Copy the accumulated impulses of the previous points into the points with the same feature id.
+ * @return Number of points that were matched.
+ */
+inline uint32_t WarmStartManifold(const SContactManifold2D& previous, SContactManifold2D& manifold)
+{
+    uint32_t matchCount = 0;
+
+    for (uint32_t index = 0; index < manifold.PointCount; ++index)
+    {
+        SContactPoint2D& point = manifold.Points[index];
+
+        for (uint32_t previousIndex = 0; previousIndex < previous.PointCount; ++previousIndex)
+        {
+            const SContactPoint2D& previousPoint = previous.Points[previousIndex];
+            if (previousPoint.FeatureId == point.FeatureId)
+            {
+                point.NormalImpulse = previousPoint.NormalImpulse;
+                point.TangentImpulse = previousPoint.TangentImpulse;
+                ++matchCount;
+                break;
+            }
+        }
+    }
+
+    return matchCount;
+}
+
+NAMESPACE_END() // namespace PHYE::Physics2D
@@ -0,0 +1,66 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <CoreMacros.hpp>
+#include <NarrowPhase2D/Distance2D.hpp>
+#include <Physics2D.hpp>
+#include <Vectors/Vectors.hpp>
+#include <array>
+#include <cstdint>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+// Maximum number of points in a 2D contact manifold
+constexpr uint32_t MAX_MANIFOLD_POINTS_2D = 2;
+
+// Collision tolerance, about the largest overlap that is not worth correcting
+constexpr float LINEAR_SLOP_2D = 0.005F;
+
+// Shapes closer than this distance already produce(speculative) contact points
+constexpr float CONTACT_SPECULATIVE_DISTANCE_2D = 4.0F * LINEAR_SLOP_2D;
+
+/**
+ * @brief One point of a contact manifold.
+ */
+struct PHYSICS2D_API SContactPoint2D final
+{
+    // World position, halfway between the two surfaces
+    SVector2F Position;
+
+    // Signed distance along the manifold normal, negative when the shapes overlap
+    float Separation = 0.0F;
+
+    // Identifies the features(vertices/edges) that generated the point, stable while the contact persists
+    uint32_t FeatureId = 0;
+
+    // Impulses accumulated by the solver, carried over to the next step when the feature id matches
+    float NormalImpulse = 0.0F;
+    float TangentImpulse = 0.0F;
+};
+
+/**
+ * @brief Contact manifold between two colliders, produced by the narrowphase.
+ */
+struct PHYSICS2D_API SContactManifold2D final
+{
+    uint32_t ColliderA = 0;
+    uint32_t ColliderB = 0;
+
+    // Unit normal pointing from A to B
+    SVector2F Normal;
+
+    std::array<SContactPoint2D, MAX_MANIFOLD_POINTS_2D> Points;
+    uint32_t                                            PointCount = 0;
+
+    // GJK simplex of the pair, kept while the pair stays in contact
+    SSimplexCache2D SimplexCache;
+};
+
+NAMESPACE_END() // namespace PHYE::Physics2D
@@ -0,0 +1,119 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <CoreMacros.hpp>
+#include <Physics2D.hpp>
+#include <Rigid2D/Geometry2D/Polygon2D.hpp>
+#include <Rigid2D/Geometry2D/Pose2D.hpp>
+#include <Vectors/Vectors.hpp>
+#include <array>
+#include <cstdint>
+#include <span>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+// Forward Declarations
+class CPrimitiveShape2D;
+
+/**
+ * Distance and penetration queries between convex vertex sets.
+ * Both shapes are given as world-space vertices(a circle is its center, the radius is applied by the caller).
+ * GJK finds the closest points of separated shapes, EPA expands the final GJK simplex to find the penetration of
+ * overlapping ones.
+ */
+
+constexpr uint32_t MAX_GJK_ITERATIONS_2D = 20;
+constexpr uint32_t MAX_EPA_ITERATIONS_2D = 32;
+
+/**
+ * @brief Vertex indices of the last GJK simplex of a shape pair.
+ * @details Keep one per persistent pair and pass it to the next query: GJK then starts from the simplex of the previous
+ * step, which usually is already the final one, instead of starting from a single vertex.
+ */
+struct SSimplexCache2D final
+{
+    std::array<uint8_t, 3> IndexA{};
+    std::array<uint8_t, 3> IndexB{};
+    uint8_t                Count = 0;
+};
+
+struct SDistanceOutput2D final
+{
+    // Closest points on A and B, equal when the shapes overlap
+    SVector2F PointA;
+    SVector2F PointB;
+
+    // 0 when the shapes overlap
+    float Distance = 0.0F;
+
+    uint32_t Iterations = 0;
+};
+
+struct SPenetrationOutput2D final
+{
+    // Direction in which B must move to separate from A
+    SVector2F Normal;
+
+    // Deepest points of A and B along Normal
+    SVector2F PointA;
+    SVector2F PointB;
+
+    // Distance B must move along Normal, >= 0
+    float Depth = 0.0F;
+
+    uint32_t Iterations = 0;
+};
+
+/**
+ * @brief GJK closest points between two convex vertex sets.
+ * @param cache Simplex of the previous query of this pair(Count = 0 for a new pair), updated with the final simplex.
+ */
+PHYSICS2D_API SDistanceOutput2D ComputeDistance(std::span<const SVector2F> verticesA,
+                                                std::span<const SVector2F> verticesB, SSimplexCache2D& cache);
+
+/**
+ * @brief EPA penetration between two convex vertex sets.
+ * @details Runs GJK first and only expands the polytope when the shapes overlap.
+ * @return false if the shapes are separated, output is then untouched.
+ */
+PHYSICS2D_API bool ComputePenetration(std::span<const SVector2F> verticesA, std::span<const SVector2F> verticesB,
+                                      SSimplexCache2D& cache, SPenetrationOutput2D& output);
+
+/**
+ * @brief A convex shape as the vertices of its core plus a radius, in the space of its vertices.
+ * @details Circles and points are one vertex, segments two, boxes and polygons their corners with a zero radius.
+ */
+struct PHYSICS2D_API SDistanceProxy2D final
+{
+    std::array<SVector2F, MAX_POLYGON_VERTICES_2D> Vertices;
+    uint32_t                                       Count = 0;
+    float                                          Radius = 0.0F;
+
+    [[nodiscard]] std::span<const SVector2F> GetVertices() const
+    {
+        return {Vertices.data(), Count};
+    }
+};
+
+/**
+ * @brief Core vertices and radius of a shape in its local space.
+ */
+PHYSICS2D_API SDistanceProxy2D MakeDistanceProxy(const CPrimitiveShape2D& shape);
+
+// Proxy moved by a pose
+PHYSICS2D_API SDistanceProxy2D TransformDistanceProxy(const SDistanceProxy2D& proxy, const SPose2D& pose);
+
+/**
+ * @brief Whether two proxies in the same space touch, i.e. the distance of their cores is at most the sum of the radii.
+ * @details A GJK distance query without a simplex cache, for one-off overlap tests.
+ */
+PHYSICS2D_API bool TestOverlap(const SDistanceProxy2D& proxyA, const SDistanceProxy2D& proxyB);
+
+NAMESPACE_END() // namespace PHYE::Physics2D
@@ -0,0 +1,89 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <BroadPhase2D/BroadPhase2D.hpp>
+#include <CoreMacros.hpp>
+#include <NarrowPhase2D/ContactCache2D.hpp>
+#include <NarrowPhase2D/ContactManifold2D.hpp>
+#include <Physics2D.hpp>
+#include <PhysicsWorld2D/ColliderRecord2D.hpp>
+#include <Rigid2D/Geometry2D/PrimitiveShape2D.hpp>
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+/**
+ * @brief Collider pair ordered by shape type: the type of ColliderA is never greater than the type of ColliderB.
+ */
+struct SShapePair2D final
+{
+    uint32_t ColliderA;
+    uint32_t ColliderB;
+};
+
+/**
+ * @brief Collides a group of pairs that all have the same shape types, appending the touching manifolds.
+ * @details Manifolds found in the cache are warm started.
+ */
+using FCollideBatch2D = void (*)(std::span<const SShapePair2D> pairs, std::span<const SColliderRecord2D> colliders,
+                                 const CContactCache2D& cache, std::vector<SContactManifold2D>& outManifolds);
+
+/**
+ * @brief NarrowPhase2D
+ * @details Turns candidate pairs into contact manifolds.
+ * Pairs are counting-sorted by their (ShapeTypeA, ShapeTypeB) key, then every group is handed to the batch function
+ * of the dispatch table. A batch function is instantiated for one pair of concrete shapes, so the per-pair work is a
+ * static_cast and an inlined collide function instead of two virtual dispatches.
+ */
+class PHYSICS2D_API CNarrowPhase2D final
+{
+public:
+    CNarrowPhase2D() = default;
+    ~CNarrowPhase2D() = default;
+
+    CNarrowPhase2D(const CNarrowPhase2D&) = delete;
+    CNarrowPhase2D(CNarrowPhase2D&&) noexcept = default;
+
+    CNarrowPhase2D& operator=(const CNarrowPhase2D&) = delete;
+    CNarrowPhase2D& operator=(CNarrowPhase2D&&) noexcept = default;
+
+    /**
+     * @brief Collide every candidate pair.
+     * @param pairs Candidate pairs from the broadphase.
+     * @param colliders Collider records indexed by collider id.
+     * @param cache Manifolds of the previous step, used to warm start the new ones.
+     * @param outManifolds Cleared, then filled with the manifolds of the touching pairs, grouped by shape types.
+     */
+    void Collide(std::span<const SBroadPhasePair2D> pairs, std::span<const SColliderRecord2D> colliders,
+                 const CContactCache2D& cache, std::vector<SContactManifold2D>& outManifolds);
+
+    /**
+     * @brief Entry of the dispatch table.
+     * @return nullptr if the shape types never produce contacts, or if typeA > typeB(pairs are ordered first).
+     */
+    [[nodiscard]] static FCollideBatch2D GetCollideFunction(EShapeType2D typeA, EShapeType2D typeB);
+
+private:
+    static constexpr size_t SHAPE_PAIR_KEY_COUNT = SHAPE_TYPE_COUNT_2D * SHAPE_TYPE_COUNT_2D;
+
+    // Pairs grouped by shape pair key
+    std::vector<SShapePair2D> SortedPairs;
+
+    // Shape pair key of every input pair
+    std::vector<uint8_t> PairKeys;
+
+    // Start of every group in SortedPairs(prefix sums of the group sizes)
+    std::array<uint32_t, SHAPE_PAIR_KEY_COUNT + 1> GroupStarts{};
+};
+
+NAMESPACE_END() // namespace PHYE::Physics2D
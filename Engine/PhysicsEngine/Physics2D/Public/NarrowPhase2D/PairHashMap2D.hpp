@@ -0,0 +1,111 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <CoreMacros.hpp>
+#include <Physics2D.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+/**
+ * @brief Open-addressing hash map from an ordered collider pair to a 32-bit value.
+ * @details Slots live in one flat array with linear probing, so a lookup touches one or two cache lines and the map
+ * never allocates per entry. There is no erase: the map is meant to be rebuilt from scratch(Clear + Insert) every
+ * step, which keeps probe sequences free of tombstones.
+ */
+class PHYSICS2D_API CPairHashMap2D final
+{
+public:
+    static constexpr uint32_t INVALID_VALUE = UINT32_MAX;
+
+    CPairHashMap2D() = default;
+    ~CPairHashMap2D() = default;
+
+    CPairHashMap2D(const CPairHashMap2D&) = default;
+    CPairHashMap2D(CPairHashMap2D&&) noexcept = default;
+
+    CPairHashMap2D& operator=(const CPairHashMap2D&) = default;
+    CPairHashMap2D& operator=(CPairHashMap2D&&) noexcept = default;
+
+    [[nodiscard]] static constexpr uint64_t MakeKey(uint32_t colliderA, uint32_t colliderB)
+    {
+        return (static_cast<uint64_t>(colliderA) << 32) | colliderB;
+    }
+
+    // Remove every entry, keeping the capacity
+    void Clear();
+
+    // Remove every entry and make room for count entries without rehashing
+    void Reserve(size_t count);
+
+    // Insert or overwrite
+    void Insert(uint64_t key, uint32_t value);
+
+    // INVALID_VALUE if the key is not in the map
+    [[nodiscard]] uint32_t Find(uint64_t key) const
+    {
+        if (Count == 0)
+        {
+            return INVALID_VALUE;
+        }
+
+        for (size_t slot = Hash(key) & Mask;; slot = (slot + 1) & Mask)
+        {
+            const SSlot& entry = Slots[slot];
+            if (entry.Key == key)
+            {
+                return entry.Value;
+            }
+
+            if (entry.Key == EMPTY_KEY)
+            {
+                return INVALID_VALUE;
+            }
+        }
+    }
+
+    [[nodiscard]] size_t Size() const
+    {
+        return Count;
+    }
+
+private:
+    // Never produced by MakeKey() with valid collider ids
+    static constexpr uint64_t EMPTY_KEY = UINT64_MAX;
+
+    struct SSlot final
+    {
+        uint64_t Key = EMPTY_KEY;
+        uint32_t Value = INVALID_VALUE;
+    };
+
+    // 64位整数混合(splitmix64 的终结步骤)，使连续的碰撞体ID均匀分布
+    [[nodiscard]] static constexpr size_t Hash(uint64_t key)
+    {
+        key ^= key >> 30;
+        key *= 0xBF58476D1CE4E5B9ULL;
+        key ^= key >> 27;
+        key *= 0x94D049BB133111EBULL;
+        key ^= key >> 31;
+        return static_cast<size_t>(key);
+    }
+
+    void Rehash(size_t capacity);
+
+    // Capacity is a power of two, at most half full
+    std::vector<SSlot> Slots;
+
+    size_t Count = 0;
+    size_t Mask = 0;
+};
+
+NAMESPACE_END() // namespace PHYE::Physics2D
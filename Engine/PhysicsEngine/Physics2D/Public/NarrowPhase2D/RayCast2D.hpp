@@ -0,0 +1,58 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <CoreMacros.hpp>
+#include <NarrowPhase2D/CollideFunctions2D.hpp>
+#include <Physics2D.hpp>
+#include <Rigid2D/Geometry2D/Pose2D.hpp>
+#include <Vectors/Vectors.hpp>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+// Forward Declarations
+class CPrimitiveShape2D;
+
+/**
+ * @brief Segment from Origin to Origin + Translation, in world space.
+ */
+struct PHYSICS2D_API SRayCastInput2D final
+{
+    SVector2F Origin;
+    SVector2F Translation;
+
+    // Hits beyond this fraction of the translation are ignored
+    float MaxFraction = 1.0F;
+};
+
+struct PHYSICS2D_API SRayCastOutput2D final
+{
+    // Point where the ray enters the shape, and the outward surface normal there
+    SVector2F Point;
+    SVector2F Normal;
+
+    // Point = Origin + Translation * Fraction
+    float Fraction = 1.0F;
+
+    bool IsHit = false;
+};
+
+/**
+ * Ray casts against one shape in world space.
+ * A ray starting inside a shape does not hit it, only the point where a ray enters a shape is reported.
+ */
+PHYSICS2D_API SRayCastOutput2D RayCastCircle(const SCircleShapeData2D& circle, const SRayCastInput2D& input);
+PHYSICS2D_API SRayCastOutput2D RayCastSegment(const SSegmentShapeData2D& segment, const SRayCastInput2D& input);
+PHYSICS2D_API SRayCastOutput2D RayCastPolygon(const SPolygonShapeData2D& polygon, const SRayCastInput2D& input);
+
+// Convert the shape with its world pose and dispatch on its type, points are never hit
+PHYSICS2D_API SRayCastOutput2D RayCastShape(const CPrimitiveShape2D& shape, const SPose2D& pose,
+                                            const SRayCastInput2D& input);
+
+NAMESPACE_END() // namespace PHYE::Physics2D
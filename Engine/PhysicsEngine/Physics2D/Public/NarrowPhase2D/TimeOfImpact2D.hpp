@@ -0,0 +1,85 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <CoreMacros.hpp>
+#include <NarrowPhase2D/ContactManifold2D.hpp>
+#include <NarrowPhase2D/Distance2D.hpp>
+#include <Physics2D.hpp>
+#include <Rigid2D/Geometry2D/Pose2D.hpp>
+#include <Vectors/Vectors.hpp>
+#include <cstdint>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+// Conservative advancement steps before a time of impact query gives up
+constexpr uint32_t MAX_TOI_ITERATIONS_2D = 32;
+
+// Separation at which a time of impact query reports the hit, the discrete solver takes over from there
+constexpr float TOI_TARGET_SEPARATION_2D = LINEAR_SLOP_2D;
+
+// Accepted error around TOI_TARGET_SEPARATION_2D
+constexpr float TOI_TOLERANCE_2D = 0.25F * LINEAR_SLOP_2D;
+
+/**
+ * @brief Motion of a rigid body over one step, interpolated linearly in position and angle.
+ * @details t = 0 is the start of the step and t = 1 its end. Center is the body position(center of mass), the
+ * colliders are placed relative to it by their local pose.
+ */
+struct PHYSICS2D_API SSweep2D final
+{
+    SVector2F Center0;
+    SVector2F Center1;
+    float     Angle0 = 0.0F;
+    float     Angle1 = 0.0F;
+
+    [[nodiscard]] SPose2D GetPose(float time) const
+    {
+        return SPose2D(Center0 + ((Center1 - Center0) * time), Angle0 + ((Angle1 - Angle0) * time));
+    }
+};
+
+enum class ETOIState2D : uint8_t
+{
+    // The shapes do not come within the target separation during the sweep
+    Separated = 0,
+
+    // The shapes reach the target separation at Time
+    Hit,
+
+    // The shapes are already touching at the start of the sweep, left to the discrete contacts
+    Touching,
+};
+
+struct PHYSICS2D_API STOIOutput2D final
+{
+    ETOIState2D State = ETOIState2D::Separated;
+
+    // Fraction of the sweep in [0, 1] the shapes can safely move
+    float Time = 1.0F;
+
+    // At Time: unit normal from A to B and the point on the surface of A
+    SVector2F Normal;
+    SVector2F Point;
+
+    uint32_t Iterations = 0;
+};
+
+/**
+ * @brief Time of impact of two swept shapes by conservative advancement.
+ * @details At every iteration GJK gives the distance of the shapes, and the sweep is advanced by that distance divided
+ * by an upper bound of the approach speed(relative linear motion along the normal plus the angular motion times the
+ * extent of each shape). The shapes therefore never overlap at the reported time.
+ * @param localA Pose of shape A relative to its body, the sweep moves the body.
+ */
+PHYSICS2D_API STOIOutput2D ComputeTimeOfImpact(const SDistanceProxy2D& proxyA, const SPose2D& localA,
+                                               const SSweep2D& sweepA, const SDistanceProxy2D& proxyB,
+                                               const SPose2D& localB, const SSweep2D& sweepB);
+
+NAMESPACE_END() // namespace PHYE::Physics2D
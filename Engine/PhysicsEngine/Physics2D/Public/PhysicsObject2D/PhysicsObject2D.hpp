@@ -16,6 +16,7 @@
 NAMESPACE_BEGIN(PHYE::Physics2D)
 
 // Forward Declaration
+class CPhysicsWorld2D;
 class CRigidBody2D;
 
 /**
@@ -25,9 +26,9 @@ class CRigidBody2D;
 class PHYSICS2D_API CPhysicsObject2D final
 {
 public:
-    ~CPhysicsObject2D() = default;
+    ~CPhysicsObject2D();
 
-    CPhysicsObject2D();
+    explicit CPhysicsObject2D(CPhysicsWorld2D& world);
 
     CPhysicsObject2D(const CPhysicsObject2D&) = delete;
     CPhysicsObject2D(CPhysicsObject2D&&) noexcept = default;
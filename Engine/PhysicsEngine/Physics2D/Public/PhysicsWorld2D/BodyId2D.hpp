@@ -0,0 +1,44 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <CoreMacros.hpp>
+#include <Physics2D.hpp>
+#include <cstdint>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+// Slot of a body in its world, wider than NekiraECS::EntityIndexType since worlds hand out their own slots
+using BodyIndexType = uint32_t;
+
+/**
+ * @brief Handle of a rigid body, only meaningful in the CPhysicsWorld2D that created it.
+ * @details Every world hands out its own ids, so worlds do not share any entity registry. The generation of a slot is
+ * bumped when its body is destroyed, an id kept after that no longer resolves to a body.
+ */
+struct SBodyId2D final
+{
+    // Slot in the rigid body storage of the world
+    BodyIndexType Index = 0;
+
+    // Generation of the slot when the body was created, 0 for an invalid id
+    uint16_t Generation = 0;
+
+    [[nodiscard]] bool IsValid() const
+    {
+        return Generation != 0;
+    }
+
+    bool operator==(const SBodyId2D& other) const
+    {
+        return Index == other.Index && Generation == other.Generation;
+    }
+};
+
+NAMESPACE_END() // namespace PHYE::Physics2D
@@ -0,0 +1,57 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <BroadPhase2D/BroadPhase2D.hpp>
+#include <CoreMacros.hpp>
+#include <Physics2D.hpp>
+#include <PhysicsWorld2D/BodyId2D.hpp>
+#include <Rigid2D/BoundingVolume2D/BoundingAABB2D.hpp>
+#include <Rigid2D/Geometry2D/Pose2D.hpp>
+#include <Rigid2D/Geometry2D/PrimitiveShape2D.hpp>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+// Forward Declarations
+class CCollider2D;
+
+/**
+ * @brief A collider registered in the world, indexed by CCollider2D::GetColliderId().
+ * @details Caches what the collision stages read for every pair, so they do not have to go through the collider and
+ * its rigid body.
+ */
+struct PHYSICS2D_API SColliderRecord2D final
+{
+    // nullptr for a collider loaded from a scene
+    const CCollider2D* Collider = nullptr;
+
+    // Shape of the collider and its type, nullptr for a free slot
+    const CPrimitiveShape2D* Shape = nullptr;
+    EShapeType2D             ShapeType = EShapeType2D::Point;
+
+    // SBodyId2D::Index of the rigid body the collider is attached to
+    BodyIndexType BodyIndex = 0;
+
+    // CCollider2D::GetCollisionLayers(), tested by the world queries
+    uint32_t CollisionLayers = 0;
+
+    // Proxy in the broadphase
+    int32_t ProxyId = INVALID_PROXY_ID;
+
+    // Pose of the shape space on the rigid body(CCollider2D::GetLocalPose())
+    SPose2D LocalPose;
+
+    // World pose of the shape space(body pose * LocalPose)
+    SPose2D Pose;
+
+    // Tight world AABB computed in the last broadphase update
+    CBoundingAABB2D AABB;
+};
+
+NAMESPACE_END() // namespace PHYE::Physics2D
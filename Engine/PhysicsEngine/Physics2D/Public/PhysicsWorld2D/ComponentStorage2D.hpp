@@ -0,0 +1,166 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <CoreMacros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+/**
+ * @brief Sparse-set component storage owned by a physics world.
+ * @details Same layout as NekiraECS::ComponentArray (sparse EntityIndex -> ComponentIndex, dense components), but the
+ * dense array is exposed as a span so that systems can run a plain loop over it instead of going through a
+ * std::function callback per component.
+ * Pointers and spans are invalidated by Add() and Remove().
+ */
+template <typename T>
+class TComponentStorage2D final
+{
+public:
+    // Indices are handed out by the owner, not by a NekiraECS registry, so they are not limited to 16 bits
+    using EntityIndexType = uint32_t;
+
+    TComponentStorage2D() = default;
+    ~TComponentStorage2D() = default;
+
+    TComponentStorage2D(const TComponentStorage2D&) = delete;
+    TComponentStorage2D(TComponentStorage2D&&) noexcept = default;
+
+    TComponentStorage2D& operator=(const TComponentStorage2D&) = delete;
+    TComponentStorage2D& operator=(TComponentStorage2D&&) noexcept = default;
+
+    // 添加组件，如果已存在则替换
+    template <typename... Args>
+    T* Add(EntityIndexType entityIndex, Args&&... args)
+    {
+        if (Contains(entityIndex))
+        {
+            auto& component = Components[ComponentIndices[entityIndex]];
+            component = T(std::forward<Args>(args)...);
+            return &component;
+        }
+
+        if (entityIndex >= ComponentIndices.size())
+        {
+            ComponentIndices.resize(static_cast<size_t>(entityIndex) + 1, INVALID_COMPONENT_INDEX);
+        }
+
+        ComponentIndices[entityIndex] = Components.size();
+        Components.emplace_back(std::forward<Args>(args)...);
+        EntityIndices.push_back(entityIndex);
+
+        return &Components.back();
+    }
+
+    // 移除组件，用末尾的组件填补空位以保持紧凑
+    void Remove(EntityIndexType entityIndex)
+    {
+        if (!Contains(entityIndex))
+        {
+            return;
+        }
+
+        const size_t COMP_INDEX = ComponentIndices[entityIndex];
+        const size_t LAST_COMP_INDEX = Components.size() - 1;
+
+        if (COMP_INDEX != LAST_COMP_INDEX)
+        {
+            const EntityIndexType LAST_ENTITY_INDEX = EntityIndices[LAST_COMP_INDEX];
+
+            Components[COMP_INDEX] = std::move(Components[LAST_COMP_INDEX]);
+            EntityIndices[COMP_INDEX] = LAST_ENTITY_INDEX;
+            ComponentIndices[LAST_ENTITY_INDEX] = COMP_INDEX;
+        }
+
+        Components.pop_back();
+        EntityIndices.pop_back();
+        ComponentIndices[entityIndex] = INVALID_COMPONENT_INDEX;
+    }
+
+    // 获取组件，不存在时返回nullptr
+    [[nodiscard]] T* Get(EntityIndexType entityIndex)
+    {
+        return Contains(entityIndex) ? &Components[ComponentIndices[entityIndex]] : nullptr;
+    }
+
+    [[nodiscard]] const T* Get(EntityIndexType entityIndex) const
+    {
+        return Contains(entityIndex) ? &Components[ComponentIndices[entityIndex]] : nullptr;
+    }
+
+    // 获取实体对应的紧凑索引，不存在时返回INVALID_COMPONENT_INDEX
+    [[nodiscard]] size_t GetDenseIndex(EntityIndexType entityIndex) const
+    {
+        return Contains(entityIndex) ? ComponentIndices[entityIndex] : INVALID_COMPONENT_INDEX;
+    }
+
+    [[nodiscard]] bool Contains(EntityIndexType entityIndex) const
+    {
+        return entityIndex < ComponentIndices.size() && ComponentIndices[entityIndex] != INVALID_COMPONENT_INDEX;
+    }
+
+    // 紧凑的组件数组
+    [[nodiscard]] std::span<T> GetComponents()
+    {
+        return Components;
+    }
+
+    [[nodiscard]] std::span<const T> GetComponents() const
+    {
+        return Components;
+    }
+
+    // 与GetComponents()一一对应的实体索引
+    [[nodiscard]] std::span<const EntityIndexType> GetEntityIndices() const
+    {
+        return EntityIndices;
+    }
+
+    [[nodiscard]] size_t Size() const
+    {
+        return Components.size();
+    }
+
+    [[nodiscard]] bool IsEmpty() const
+    {
+        return Components.empty();
+    }
+
+    void Reserve(size_t capacity)
+    {
+        Components.reserve(capacity);
+        EntityIndices.reserve(capacity);
+    }
+
+    void Clear()
+    {
+        ComponentIndices.clear();
+        Components.clear();
+        EntityIndices.clear();
+    }
+
+    static constexpr size_t INVALID_COMPONENT_INDEX = static_cast<size_t>(-1);
+
+private:
+    // 稀疏集合：EntityIndex -> ComponentIndex
+    std::vector<size_t> ComponentIndices;
+
+    // 紧凑集合：ComponentIndex -> Component
+    std::vector<T> Components;
+
+    // 紧凑集合：ComponentIndex -> EntityIndex
+    std::vector<EntityIndexType> EntityIndices;
+};
+
+NAMESPACE_END() // namespace PHYE::Physics2D
@@ -8,9 +8,37 @@
 
 #pragma once
 
+#include <BroadPhase2D/BroadPhase2D.hpp>
 #include <CoreMacros.hpp>
+#include <ForceField2D/ForceFieldRegistry2D.hpp>
+#include <Integrator2D/RigidBodyIntegrateSystem2D.hpp>
+#include <Joint2D/Joint2D.hpp>
+#include <Joint2D/JointStorage2D.hpp>
+#include <NarrowPhase2D/ContactCache2D.hpp>
+#include <NarrowPhase2D/ContactManifold2D.hpp>
+#include <NarrowPhase2D/NarrowPhase2D.hpp>
 #include <Physics2D.hpp>
+#include <PhysicsWorld2D/BodyId2D.hpp>
+#include <PhysicsWorld2D/ColliderRecord2D.hpp>
+#include <PhysicsWorld2D/ComponentStorage2D.hpp>
+#include <PhysicsWorld2D/WorldSnapshot2D.hpp>
+#include <Rigid2D/Collider2D/Collider2D.hpp>
+#include <Rigid2D/Geometry2D/Line2D.hpp>
+#include <Rigid2D/RigidBody2D/RigidBodyComponent2D.hpp>
+#include <Scene2D/RegionStreamer2D.hpp>
+#include <Scene2D/SceneBatch2D.hpp>
+#include <Scene2D/SceneFormat2D.hpp>
+#include <Scene2D/SceneShapes2D.hpp>
+#include <Solver2D/IslandBuilder2D.hpp>
+#include <Solver2D/IslandSolver2D.hpp>
+#include <Solver2D/SolverBody2D.hpp>
+#include <Vectors/Vectors.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
 #include <memory>
+#include <span>
 #include <vector>
 
 NAMESPACE_BEGIN(PHYE::Physics2D)
@@ -18,30 +46,548 @@ NAMESPACE_BEGIN(PHYE::Physics2D)
 // Forward Declarations
 class CPhysicsObject2D;
 
+/**
+ * @brief Stages executed by CPhysicsWorld2D in every (sub)step, in this order.
+ */
+enum class EPhysicsStage2D : uint8_t
+{
+    IntegrateForces = 0,
+    BroadPhase,
+    NarrowPhase,
+    Solve,
+    IntegratePositions,
+    Continuous,
+
+    Count
+};
+
+constexpr size_t PHYSICS_STAGE_COUNT_2D = static_cast<size_t>(EPhysicsStage2D::Count);
+
+/**
+ * @brief Settings of the fixed-timestep pipeline and its stages.
+ */
+struct PHYSICS2D_API SPhysicsWorldSettings2D final
+{
+    // 固定步长(秒)，默认60Hz
+    float FixedTimeStep = 1.0F / 60.0F;
+
+    // 每个固定步长被拆分成的子步数，子步长 = FixedTimeStep / SubStepCount
+    uint32_t SubStepCount = 1;
+
+    // 单帧内最多执行的固定步数，超出部分的时间会被丢弃，避免"死亡螺旋"
+    uint32_t MaxStepsPerFrame = 4;
+
+    // 重力加速度
+    SVector2F Gravity = SVector2F(0.0F, -9.81F);
+
+    // 宽相位算法，修改后所有碰撞体会被重新注册到新的宽相位中
+    EBroadPhaseType2D BroadPhaseType = EBroadPhaseType2D::AABBTree;
+
+    // SpatialHash 模式的单元尺寸，<= 0 时按碰撞体平均尺寸自动选取
+    float GridCellSize = 0.0F;
+
+    // 用上一步的累积冲量初始化求解器(按碰撞体对与特征ID匹配接触点)
+    bool EnableWarmStarting = true;
+
+    // 每个子步的速度迭代次数，开启热启动时少量迭代即可稳定堆叠
+    uint32_t VelocityIterations = 4;
+
+    // 接触的摩擦系数与恢复系数
+    float Friction = 0.6F;
+    float Restitution = 0.0F;
+
+    // 岛屿中所有刚体的速度持续低于阈值 TimeToSleep 秒后，整个岛屿进入休眠
+    bool EnableSleeping = true;
+
+    // 休眠阈值：线速度(米/秒)与角速度(弧度/秒，约2度/秒)
+    float LinearSleepTolerance = 0.01F;
+    float AngularSleepTolerance = 0.035F;
+
+    // 进入休眠前需要保持静止的时间(秒)
+    float TimeToSleep = 0.5F;
+
+    // 在 BE::Core::CJobSystem 的工作线程上并行求解互不相连的岛屿，并分块施加力场
+    bool EnableParallelSolve = true;
+
+    // 确定性模式：接触按碰撞体ID排序后求解，每个固定步结束时把刚体状态累积到 GetStateHash()
+    // 相同的输入(包括创建刚体与碰撞体的顺序)在任意次运行、任意线程数下得到逐位相同的状态，用于帧同步与不同步检测
+    bool EnableDeterminism = false;
+
+    // 对 IsBullet 刚体做连续碰撞检测(TOI)，其它刚体仍只做离散检测
+    bool EnableContinuous = true;
+
+    // 子弹刚体每个子步内最多处理的碰撞次数，用完后停在最后一次碰撞的位置
+    uint32_t MaxContinuousImpacts = 4;
+};
+
+/**
+ * @brief Timing statistics of the last CPhysicsWorld2D::Step() call.
+ * @details All times are in microseconds and summed over every (sub)step executed in that call.
+ */
+struct PHYSICS2D_API SPhysicsStepStats2D final
+{
+    // 每个阶段的耗时
+    std::array<double, PHYSICS_STAGE_COUNT_2D> StageTimes{};
+
+    // Step() 的总耗时
+    double TotalTime = 0.0;
+
+    // 本帧执行的固定步数
+    uint32_t StepCount = 0;
+
+    // 本帧执行的子步总数
+    uint32_t SubStepCount = 0;
+
+    // 因超出 MaxStepsPerFrame 而被丢弃的时间(秒)
+    float DroppedTime = 0.0F;
+
+    [[nodiscard]] double GetStageTime(EPhysicsStage2D stage) const;
+
+    void Reset();
+};
+
+/**
+ * @brief Closest hit of a ray cast against the colliders of the world.
+ */
+struct PHYSICS2D_API SRayCastHit2D final
+{
+    // INVALID_COLLIDER_ID when the ray hits nothing
+    uint32_t ColliderId = INVALID_COLLIDER_ID;
+
+    // Point where the ray enters the collider, and the outward surface normal there
+    SVector2F Point;
+    SVector2F Normal;
+
+    // Fraction of the ray from Start to End at the hit
+    float Fraction = 1.0F;
+};
+
+// Shape casts report the same data as ray casts
+using SShapeCastHit2D = SRayCastHit2D;
+
 /**
  * @brief Physics World 2D
  * @details Manages the 2D physics simulation environment.
+ * The world advances with a fixed timestep: Step(deltaTime) accumulates the frame time and consumes it in
+ * FixedTimeStep slices, each slice is split into SubStepCount substeps running the full stage pipeline.
+ * Worlds share no state: every world owns its bodies, ids and caches, so any number of worlds can be stepped at the
+ * same time on different threads, as long as each world is used by one thread at a time. All of them spread their
+ * solver work over the shared BE::Core::CJobSystem.
  */
 class PHYSICS2D_API CPhysicsWorld2D final
 {
 private:
-    CPhysicsWorld2D() = default;
+    // Rigid body components of this world, indexed by SBodyId2D::Index
+    TComponentStorage2D<SRigidBodyComponent2D> RigidBodies;
+
+    // Current generation of every body slot, and the released slots
+    std::vector<uint16_t>      BodyGenerations;
+    std::vector<BodyIndexType> FreeBodyIndices;
+
+    // Integrates RigidBodies in the IntegrateForces/IntegratePositions stages
+    CRigidBodyIntegrateSystem2D Integrator;
+
+    // Force fields, applied by Integrator before it integrates the velocities
+    CForceFieldRegistry2D ForceFields;
+
+    // Joints between the bodies, solved in the same batches as the contacts
+    CJointStorage2D Joints;
+
+    // Sorted body pair keys of the joints whose bodies do not collide, one entry per joint
+    std::vector<uint64_t> JointFilterPairs;
 
-    // 2D Physics Objects in the world
+    // Colliders, indexed by collider id
+    std::vector<SColliderRecord2D> Colliders;
+
+    // Released collider ids, reused before growing Colliders
+    std::vector<uint32_t> FreeColliderIds;
+
+    // Shapes of the colliders loaded by LoadScene(), one pool per scene
+    std::vector<std::unique_ptr<CSceneShapes2D>> SceneShapes;
+
+    // Streamed regions indexed by region id, and the thread preparing them(started by the first AddRegion())
+    std::vector<SStreamingRegion2D>                 Regions;
+    std::unique_ptr<CRegionStreamer2D>              RegionStreamer;
+    std::vector<std::unique_ptr<SPreparedRegion2D>> PreparedRegions;
+
+    // Sorted body slots of the region being released, to destroy their joints in one pass
+    std::vector<BodyIndexType> RegionBodyIndices;
+
+    std::unique_ptr<IBroadPhase2D> BroadPhase;
+
+    // Output of the broadphase stage, consumed by the narrowphase
+    std::vector<SBroadPhasePair2D> CandidatePairs;
+
+    CNarrowPhase2D NarrowPhase;
+
+    // Output of the narrowphase stage
+    std::vector<SContactManifold2D> ContactManifolds;
+
+    // Solved manifolds of the previous step, used to warm start the next one
+    CContactCache2D ContactCache;
+
+    // Velocities of RigidBodies(same dense order, plus a dummy body) while constraints are solved
+    std::vector<SSolverBody2D> SolverBodies;
+
+    // Solver bodies of every manifold then every joint(STATIC_SOLVER_BODY_2D for a side that is not Dynamic), linking
+    // the islands
+    std::vector<SConstraintBodies2D> ConstraintBodies;
+
+    // Islands of the last solve stage, built over ContactManifolds and Joints
+    CIslandBuilder2D Islands;
+
+    CIslandSolver2D IslandSolver;
+
+    // Colliders of the awake bullets, grouped by body, and the broadphase candidates of one of them
+    std::vector<uint32_t> BulletColliders;
+    std::vector<uint32_t> ContinuousCandidates;
+
+    // 2D Physics Objects in the world(declared after RigidBodies and Colliders so that they are destroyed first)
     std::vector<std::unique_ptr<CPhysicsObject2D>> PhysicsObjects;
 
+    // Pipeline settings
+    SPhysicsWorldSettings2D Settings;
+
+    // 尚未被消耗的帧时间
+    float Accumulator;
+
+    // Statistics of the last Step()
+    SPhysicsStepStats2D StepStats;
+
+    // Fixed steps simulated since the world was created
+    uint64_t StepIndex;
+
+    // Rolling hash of the body state after every fixed step, only updated in deterministic mode
+    uint64_t StateHash;
+
+    // Ring of snapshot buffers, and the buffer written by the next SaveSnapshot()
+    std::vector<SWorldSnapshot2D> Snapshots;
+    uint32_t                      NextSnapshot;
+
+    // Bumped whenever bodies or colliders are created or destroyed(directly, by a scene or by a streamed region),
+    // snapshots taken before can no longer be restored
+    uint64_t StructureVersion;
+
 public:
+    explicit CPhysicsWorld2D(const SPhysicsWorldSettings2D& settings = SPhysicsWorldSettings2D());
+
+    // Bodies, colliders and physics objects keep a pointer to their world
     CPhysicsWorld2D(const CPhysicsWorld2D&) = delete;
     CPhysicsWorld2D(CPhysicsWorld2D&&) noexcept = delete;
 
     CPhysicsWorld2D& operator=(const CPhysicsWorld2D&) = delete;
     CPhysicsWorld2D& operator=(CPhysicsWorld2D&&) noexcept = delete;
 
-    ~CPhysicsWorld2D() = default;
+    ~CPhysicsWorld2D();
+
+    /**
+     * @brief Advance the simulation by the elapsed frame time.
+     * @param deltaTime Elapsed real time in seconds, it is accumulated and consumed in fixed steps.
+     */
+    void Step(float deltaTime);
+
+    /**
+     * @brief Step independent worlds in parallel, one job per world on the BE::Core::CJobSystem.
+     * @details Each world still splits its own solver work into jobs, idle workers steal them, so a few large worlds
+     * and many small ones both keep the pool busy.
+     */
+    static void StepWorlds(std::span<CPhysicsWorld2D* const> worlds, float deltaTime);
+
+    /**
+     * @brief Create a rigid body component in this world.
+     * @return Id of the body, GetRigidBody() resolves it to the component.
+     */
+    SBodyId2D CreateRigidBody(PHYE::PhysicsBase::ERigidBodyType type, float mass = 1.0F, float inertia = 1.0F);
+
+    /**
+     * @brief Destroy the rigid body component and the joints attached to it, its colliders must have been removed.
+     * @details The id no longer resolves afterwards.
+     */
+    void DestroyRigidBody(SBodyId2D body);
+
+    /**
+     * @brief Wake up the rigid body, and its island in the next step.
+     * @details Needed after changing the position or velocity of a sleeping body directly, forces wake bodies up by
+     * themselves.
+     */
+    void WakeRigidBody(SBodyId2D body);
+
+    // Get the rigid body component, nullptr once destroyed. Invalidated when bodies are created or destroyed
+    [[nodiscard]] SRigidBodyComponent2D* GetRigidBody(SBodyId2D body);
+
+    // Dense array of every rigid body component in the world
+    [[nodiscard]] std::span<SRigidBodyComponent2D> GetRigidBodies();
+
+    // Force fields acting on the bodies of their groups(see SRigidBodyComponent2D::ForceGroups) in every substep
+    [[nodiscard]] CForceFieldRegistry2D&       GetForceFields();
+    [[nodiscard]] const CForceFieldRegistry2D& GetForceFields() const;
+
+    /**
+     * @brief Create a joint between two bodies of this world, e.g. CRigidBody2D::GetBodyId() of two bodies.
+     * @details The bodies are woken up and end up in the same island. Destroying either body destroys the joint.
+     * Unless CollideConnected is set, the colliders of the two bodies no longer collide with each other.
+     * @return Id of the joint.
+     */
+    SJointId2D CreateJoint(const SDistanceJointDef2D& def);
+    SJointId2D CreateJoint(const SRevoluteJointDef2D& def);
+    SJointId2D CreateJoint(const SPrismaticJointDef2D& def);
+    SJointId2D CreateJoint(const SWeldJointDef2D& def);
+
+    // Destroy a joint and wake up its bodies, a stale id(e.g. of a joint destroyed with its body) is ignored
+    void DestroyJoint(SJointId2D jointId);
+
+    // Joints of the world, e.g. to read their accumulated impulses
+    [[nodiscard]] const CJointStorage2D& GetJoints() const;
+
+    // Change the length of a distance joint and wake up its bodies
+    void SetJointLength(SJointId2D jointId, float length);
+
+    /**
+     * @brief Register a collider attached to a rigid body of this world.
+     * @details The collider must outlive its registration, CRigidBody2D::AddCollider() takes care of it.
+     * @return The collider id, also stored in the collider.
+     */
+    uint32_t AddCollider(SBodyId2D body, CCollider2D& collider);
+
+    // Unregister a collider
+    void RemoveCollider(CCollider2D& collider);
+
+    /**
+     * @brief Recompute the cached shape and bounds of a collider immediately.
+     * @details Call it after changing the shape of a registered collider. Colliders of static bodies are not updated
+     * by Step(), so it is also needed after moving a static body.
+     */
+    void RefreshCollider(const CCollider2D& collider);
+
+    // Colliders indexed by collider id, free slots have a null Shape
+    [[nodiscard]] std::span<const SColliderRecord2D> GetColliders() const;
+
+    /**
+     * @brief Create the bodies and colliders of a scene, e.g. CSceneFile2D::GetView() of a mapped scene file.
+     * @details Everything is created in bulk from the records: the bodies in file order, their ids appended to
+     * outBodies, then the colliders. With the AABBTree broadphase the prebuilt tree of the scene is grafted as one
+     * subtree, other broadphases insert every collider. Scene colliders have no CCollider2D, they stay registered
+     * until the world is destroyed, so their bodies must not be destroyed either.
+     */
+    void LoadScene(const CSceneView2D& scene, std::vector<SBodyId2D>& outBodies);
+
+    /**
+     * @brief Write every body and collider of the world as a scene file, with a broadphase tree built over them.
+     * @details Meant for level tools: build the level from physics objects once, then ship the bytes saved by
+     * CSceneFile2D::Save(). Bodies are written in id order, colliders in collider id order.
+     */
+    void WriteScene(std::vector<std::byte>& outBytes) const;
+
+    /**
+     * @brief Register a region of a streamed map, stored as a scene file written by WriteScene().
+     * @details A world only keeps the regions near the streaming focus resident, so the collider count, and with it
+     * the broadphase and memory cost, follows the active area rather than the whole map. Region files are mapped and
+     * prepared on a background thread, then merged at the start of the next Step() in one batch per region.
+     * Merging and unloading change the bodies and colliders and drop every snapshot taken so far. Unloading also
+     * destroys the joints attached to the bodies of the region.
+     * @param bounds Space covered by the region.
+     * @return Region id.
+     */
+    uint32_t AddRegion(const std::filesystem::path& scenePath, const CBoundingAABB2D& bounds);
+
+    // Request a region, it becomes resident at the first Step() after the streaming thread prepared it
+    void LoadRegion(uint32_t regionId);
+
+    // Remove the bodies and colliders of a resident region now, or drop a region still loading once it is prepared
+    void UnloadRegion(uint32_t regionId);
+
+    /**
+     * @brief Load the regions within loadRadius of the focus and unload the ones farther than unloadRadius.
+     * @details The gap between the radii keeps regions on the border from being loaded and unloaded repeatedly while
+     * the focus moves back and forth. Regions that failed to load are not requested again.
+     */
+    void SetStreamingFocus(const SVector2F& focus, float loadRadius, float unloadRadius);
+
+    /**
+     * @brief Wait for the regions being loaded and merge them now.
+     * @details Load times depend on the disk, lockstep games call this before stepping so that every peer merges a
+     * region at the same step.
+     */
+    void FlushRegions();
+
+    [[nodiscard]] ERegionState2D GetRegionState(uint32_t regionId) const;
+
+    // Bodies of a resident region, in the order of its scene file
+    [[nodiscard]] std::span<const SBodyId2D> GetRegionBodies(uint32_t regionId) const;
+
+    // Candidate pairs of the last broadphase update
+    [[nodiscard]] std::span<const SBroadPhasePair2D> GetCandidatePairs() const;
+
+    // Contact manifolds of the last narrowphase update
+    [[nodiscard]] std::span<const SContactManifold2D> GetContactManifolds() const;
+
+    [[nodiscard]] const IBroadPhase2D& GetBroadPhase() const;
+
+    /**
+     * @brief Cast segments against every collider and keep the closest hit of each.
+     * @details Consecutive rays are grouped in packets of RAY_PACKET_SIZE_2D that traverse the broadphase together,
+     * so rays that start close to each other and point the same way should be next to each other. The packets are
+     * spread over the BE::Core::CJobSystem workers. Colliders are tested at their pose of the last step, a ray starting
+     * inside a collider does not hit it.
+     * @param rays Segments from Start to End.
+     * @param outHits One hit per ray, at least rays.size() elements.
+     * @param layerMask Only colliders whose collision layers share a bit with the mask are hit.
+     */
+    void RayCastClosest(std::span<const CLine2D> rays, std::span<SRayCastHit2D> outHits,
+                        uint32_t layerMask = ALL_COLLISION_LAYERS) const;
+
+    /**
+     * @brief Collect the colliders overlapping a circle.
+     * @details The broadphase candidates are tested with GJK, nothing is allocated: the ids are written to the caller's
+     * buffer and the query stops once it is full. Queries only read the world and may run concurrently.
+     * @param outColliders Filled from the front.
+     * @param layerMask Only colliders whose collision layers share a bit with the mask are reported.
+     * @return Number of collider ids written.
+     */
+    uint32_t OverlapCircle(const SVector2F& center, float radius, std::span<uint32_t> outColliders,
+                           uint32_t layerMask = ALL_COLLISION_LAYERS) const;
+
+    // OverlapCircle() for an oriented box, rotation in radians
+    uint32_t OverlapBox(const SVector2F& center, const SVector2F& halfExtents, float rotation,
+                        std::span<uint32_t> outColliders, uint32_t layerMask = ALL_COLLISION_LAYERS) const;
+
+    /**
+     * @brief Sweep a shape along a translation and collect the colliders it hits, closest first.
+     * @details Every collider in the swept bounds gets a time of impact query, so a hit leaves the shape within
+     * LINEAR_SLOP_2D of the collider, the same way bullets stop. A collider already touching the shape at the start is
+     * hit at fraction 0, with the unit normal that separates the shape from it; the normal is zero when there is no such
+     * direction(e.g. two circles with the same center). Every other hit has a unit normal.
+     * @param shape Placed in the world by pose, e.g. the shape of a collider and the world pose of that collider.
+     * @param outHits Keeps the closest outHits.size() hits.
+     * @return Number of hits written.
+     */
+    uint32_t ShapeCast(const CPrimitiveShape2D& shape, const SPose2D& pose, const SVector2F& translation,
+                       std::span<SShapeCastHit2D> outHits, uint32_t layerMask = ALL_COLLISION_LAYERS) const;
+
+    [[nodiscard]] const CIslandBuilder2D& GetIslands() const;
+
+    [[nodiscard]] const CIslandSolver2D& GetIslandSolver() const;
+
+    // Settings
+    void                                        SetSettings(const SPhysicsWorldSettings2D& settings);
+    [[nodiscard]] const SPhysicsWorldSettings2D& GetSettings() const;
+
+    // Statistics of the last Step()
+    [[nodiscard]] const SPhysicsStepStats2D& GetStepStats() const;
+
+    // Number of fixed steps simulated since the world was created
+    [[nodiscard]] uint64_t GetStepIndex() const;
+
+    /**
+     * @brief Hash of the body state chained over every fixed step simulated with EnableDeterminism.
+     * @details Covers the position, rotation, velocities and sleep state of every body, in body id order, bit for bit.
+     * Two worlds fed the same inputs have the same hash at the same GetStepIndex(), so peers of a lockstep session can
+     * exchange it every few steps and detect a desync at the step where it happens.
+     */
+    [[nodiscard]] uint64_t GetStateHash() const;
+
+    /**
+     * @brief Allocate the ring of snapshot buffers, dropping the snapshots taken so far.
+     * @details Every buffer is sized for the current bodies, colliders and broadphase. Without this call the first
+     * SaveSnapshot() allocates DEFAULT_SNAPSHOT_COUNT_2D buffers.
+     * @param count Number of snapshots kept, rolling back N steps needs N + 1 of them.
+     */
+    void ReserveSnapshots(uint32_t count);
+
+    /**
+     * @brief Copy the simulation state into the next buffer of the ring, overwriting the oldest snapshot.
+     * @details Copies the body components, the collider records, the broadphase, the joints and the contact cache, as
+     * flat arrays.
+     * Settings and step statistics are not part of a snapshot. Once every buffer has been filled, saving allocates
+     * nothing unless the world grew.
+     * @return GetStepIndex(), the key of the snapshot.
+     */
+    uint64_t SaveSnapshot();
+
+    /**
+     * @brief Bring the simulation back to the newest snapshot taken at a step.
+     * @details Meant for rollback: no object is recreated, so a snapshot can only be restored while the same bodies and
+     * colliders exist as when it was taken. Creating or destroying a body, adding or removing a collider, changing the
+     * shape of a collider, loading or unloading a region, or switching the broadphase makes the older snapshots
+     * unusable. Joints are plain data and come back as they were, including the ones created or destroyed since.
+     * Snapshots of later steps belong to the discarded future and are dropped, the next SaveSnapshot() reuses their
+     * buffers.
+     * @return false if the ring holds no snapshot of that step, or the world changed structure since it was taken.
+     */
+    bool RestoreSnapshot(uint64_t stepIndex);
+
+    /**
+     * @brief Blend factor between the previous and the current fixed step, in [0, 1).
+     * @details Renderers can use it to interpolate body transforms when the frame rate differs from the step rate.
+     */
+    [[nodiscard]] float GetInterpolationAlpha() const;
+
+private:
+    // Recreate the broadphase from Settings and register every collider in it
+    void RebuildBroadPhase();
+
+    // Run one substep through every stage
+    void SubStep(float timeStep);
+
+    // Stages
+    void IntegrateForces(float timeStep);
+    void UpdateBroadPhase(float timeStep);
+    void UpdateNarrowPhase();
+    void SolveConstraints(float timeStep);
+    void IntegratePositions(float timeStep);
+    void SolveContinuous(float timeStep);
+
+    // Build the islands over the contact manifolds and the joints, and wake up every island touched by an awake body
+    void UpdateIslands();
+
+    // Wake up the bodies of a new joint and stop their colliders from colliding unless collideConnected is set
+    void LinkJointBodies(const SBodyId2D& bodyA, const SBodyId2D& bodyB, bool collideConnected);
+
+    // Rebuild JointFilterPairs from Joints
+    void RebuildJointFilter();
+
+    // Destroy the joints attached to any of the body slots, e.g. before the bodies are destroyed
+    void DestroyBodyJoints(std::span<const BodyIndexType> sortedBodyIndices);
+
+    // Advance the sleep timers and put the islands that stayed at rest long enough to sleep
+    void UpdateSleep(float timeStep);
+
+    // Fold the state of every body into StateHash
+    void UpdateStateHash();
+
+    /**
+     * @brief Create the bodies and colliders of a prepared scene, and insert the colliders into the broadphase as one
+     * batch.
+     * @param outColliders Receives the ids of the new colliders.
+     */
+    void MergeSceneBatch(SSceneBatch2D& batch, std::vector<SBodyId2D>& outBodies, std::vector<uint32_t>& outColliders);
+
+    // Free the record and proxy of a collider, without waking the bodies touching it
+    void ReleaseCollider(uint32_t colliderId);
+
+    // Merge the regions prepared by the streaming thread
+    void UpdateRegions();
+
+    // Remove the bodies, colliders and joints of a resident region
+    void ReleaseRegion(SStreamingRegion2D& region);
+
+    // Remove a body component and release its slot, its joints must have been destroyed
+    void RemoveRigidBody(SBodyId2D body);
+
+    // Drop every snapshot of the ring, e.g. once their collider records point to freed shapes
+    void InvalidateSnapshots();
+
+    /**
+     * @brief Move a bullet along its motion of the last substep, stopping at the impacts the discrete step missed.
+     * @details The other bodies stay at their end pose. At every impact the bullet is moved to the time of impact and
+     * the pair gets a contact impulse, then the rest of the substep is swept with the new velocity.
+     * @param colliders Colliders of the bullet.
+     */
+    void AdvanceBullet(std::span<const uint32_t> colliders, float timeStep);
 
-    // Get singleton instance
-    static CPhysicsWorld2D& Get();
+    // Wake up a body, the rest of its island follows in UpdateIslands()
+    static void WakeBody(SRigidBodyComponent2D& body);
 };
 
 
-NAMESPACE_END() // namespace PHYE::Physics2D
\ No newline at end of file
+NAMESPACE_END() // namespace PHYE::Physics2D
@@ -0,0 +1,99 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <BroadPhase2D/BroadPhase2D.hpp>
+#include <CoreMacros.hpp>
+#include <Joint2D/JointStorage2D.hpp>
+#include <NarrowPhase2D/ContactCache2D.hpp>
+#include <NarrowPhase2D/ContactManifold2D.hpp>
+#include <Physics2D.hpp>
+#include <PhysicsWorld2D/ColliderRecord2D.hpp>
+#include <Rigid2D/RigidBody2D/RigidBodyComponent2D.hpp>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+// Snapshots kept by a world unless CPhysicsWorld2D::ReserveSnapshots() asks otherwise: 8 rolled back steps + 1
+constexpr uint32_t DEFAULT_SNAPSHOT_COUNT_2D = 9;
+
+// Step index of a snapshot buffer that holds nothing
+constexpr uint64_t INVALID_SNAPSHOT_STEP_2D = std::numeric_limits<uint64_t>::max();
+
+/**
+ * @brief Every field of SRigidBodyComponent2D, without the ECS component base.
+ */
+struct PHYSICS2D_API SRigidBodyState2D final
+{
+    PHYE::PhysicsBase::ERigidBodyType Type = PHYE::PhysicsBase::ERigidBodyType::Static;
+
+    STransform2D Transform;
+    SVector2F    Position;
+    float        Rotation = 0.0F;
+    SVector2F    Velocity;
+    float        AngularVelocity = 0.0F;
+    SVector2F    Force;
+    float        Torque = 0.0F;
+
+    float LinearDamping = 0.0F;
+    float AngularDamping = 0.0F;
+    float GravityScale = 1.0F;
+    float Mass = 0.0F;
+    float InverseMass = 0.0F;
+    float Inertia = 0.0F;
+    float InverseInertia = 0.0F;
+
+    bool  IsAwake = true;
+    float SleepTime = 0.0F;
+    bool  IsBullet = false;
+
+    uint32_t ForceGroups = DEFAULT_FORCE_GROUPS;
+};
+
+PHYSICS2D_API void SaveRigidBodyState(const SRigidBodyComponent2D& body, SRigidBodyState2D& outState);
+PHYSICS2D_API void RestoreRigidBodyState(const SRigidBodyState2D& state, SRigidBodyComponent2D& outBody);
+
+/**
+ * @brief One buffer of the snapshot ring of a CPhysicsWorld2D.
+ * @details Holds everything a step reads from the previous one, as flat arrays: the bodies in dense order, the
+ * collider records with their broadphase proxies, a copy of the broadphase, the joints, and the contacts used for warm
+ * starting.
+ * The arrays keep their capacity between snapshots, so refilling a buffer copies the data without allocating.
+ * The math types have user-defined copies, so the arrays are copied element by element rather than by memcpy, which
+ * still compiles down to straight loads and stores.
+ */
+struct PHYSICS2D_API SWorldSnapshot2D final
+{
+    // CPhysicsWorld2D::GetStepIndex() when the snapshot was taken
+    uint64_t StepIndex = INVALID_SNAPSHOT_STEP_2D;
+
+    // CPhysicsWorld2D structure version, the snapshot only applies to the same bodies and colliders
+    uint64_t StructureVersion = 0;
+
+    uint64_t StateHash = 0;
+    float    Accumulator = 0.0F;
+
+    std::vector<SRigidBodyState2D> Bodies;
+    std::vector<SColliderRecord2D> Colliders;
+
+    // Type of BroadPhase, a buffer whose type differs is cloned again
+    EBroadPhaseType2D              BroadPhaseType = EBroadPhaseType2D::AABBTree;
+    std::unique_ptr<IBroadPhase2D> BroadPhase;
+
+    std::vector<SContactManifold2D> ContactManifolds;
+    CContactCache2D                 ContactCache;
+
+    // Joints with their accumulated impulses
+    CJointStorage2D Joints;
+};
+
+NAMESPACE_END() // namespace PHYE::Physics2D
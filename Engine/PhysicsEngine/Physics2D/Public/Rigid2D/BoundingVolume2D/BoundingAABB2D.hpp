@@ -8,11 +8,87 @@
 
 #pragma once
 
+#include <MathUtility/MathUtilities.hpp>
 #include <Rigid2D/BoundingVolume2D/BoundingVolume2D.hpp>
+#include <Vectors/Vectors.hpp>
 
 NAMESPACE_BEGIN(PHYE::Physics2D)
 
+/**
+ * @brief Axis-aligned bounding box defined by its Min and Max corners.
+ * @details The box tests used by the broadphase are defined inline so that the tree traversal does not go through an
+ * exported call for every node.
+ */
 class PHYSICS2D_API CBoundingAABB2D final : public CBoundingVolume2D
-{};
+{
+private:
+    SVector2F Min;
+    SVector2F Max;
+
+public:
+    ~CBoundingAABB2D() override = default;
+
+    CBoundingAABB2D();
+    CBoundingAABB2D(const SVector2F& min, const SVector2F& max);
+
+    CBoundingAABB2D(const CBoundingAABB2D& other) = default;
+    CBoundingAABB2D(CBoundingAABB2D&& other) noexcept = default;
+
+    CBoundingAABB2D& operator=(const CBoundingAABB2D& other) = default;
+    CBoundingAABB2D& operator=(CBoundingAABB2D&& other) noexcept = default;
+
+    // Build from a center point and half extents
+    static CBoundingAABB2D FromCenter(const SVector2F& center, const SVector2F& halfExtents);
+
+    // Smallest box containing both boxes
+    [[nodiscard]] static CBoundingAABB2D Union(const CBoundingAABB2D& a, const CBoundingAABB2D& b)
+    {
+        return CBoundingAABB2D(SVector2F(BE::Math::Min(a.Min.X, b.Min.X), BE::Math::Min(a.Min.Y, b.Min.Y)),
+                               SVector2F(BE::Math::Max(a.Max.X, b.Max.X), BE::Math::Max(a.Max.Y, b.Max.Y)));
+    }
+
+    // Getters
+    [[nodiscard]] const SVector2F& GetMin() const
+    {
+        return Min;
+    }
+
+    [[nodiscard]] const SVector2F& GetMax() const
+    {
+        return Max;
+    }
+
+    [[nodiscard]] SVector2F GetCenter() const;
+    [[nodiscard]] SVector2F GetHalfExtents() const;
+    [[nodiscard]] float     Area() const;
+
+    // Perimeter, used as the insertion cost of the dynamic AABB tree(the 2D counterpart of the surface area)
+    [[nodiscard]] float Perimeter() const
+    {
+        return 2.0F * ((Max.X - Min.X) + (Max.Y - Min.Y));
+    }
+
+    // Min <= Max on both axes
+    [[nodiscard]] bool IsValid() const;
+
+    [[nodiscard]] bool Overlaps(const CBoundingAABB2D& other) const
+    {
+        return Min.X <= other.Max.X && Max.X >= other.Min.X && Min.Y <= other.Max.Y && Max.Y >= other.Min.Y;
+    }
+
+    // Whether the other box lies fully inside this box
+    [[nodiscard]] bool Contains(const CBoundingAABB2D& other) const
+    {
+        return Min.X <= other.Min.X && Min.Y <= other.Min.Y && other.Max.X <= Max.X && other.Max.Y <= Max.Y;
+    }
+
+    [[nodiscard]] bool Contains(const SVector2F& point) const;
+
+    // Box grown by margin on every side
+    [[nodiscard]] CBoundingAABB2D Fattened(float margin) const;
+
+    // Box swept along the displacement(only the side facing the motion is extended)
+    [[nodiscard]] CBoundingAABB2D Swept(const SVector2F& displacement) const;
+};
 
-NAMESPACE_END() // namespace PHYE::Physics2D
\ No newline at end of file
+NAMESPACE_END() // namespace PHYE::Physics2D
@@ -10,24 +10,40 @@
 
 #include <CoreMacros.hpp>
 #include <Physics2D.hpp>
+#include <Rigid2D/Geometry2D/Pose2D.hpp>
 #include <Transforms/Transforms.hpp>
+#include <cstdint>
 #include <memory>
 
 
 NAMESPACE_BEGIN(PHYE::Physics2D)
 
 // Forward Declarations
-struct CBoundingVolume2D;
+class CBoundingAABB2D;
 class CPrimitiveShape2D;
+class CPhysicsWorld2D;
+
+// Id of a collider that is not registered in a physics world
+constexpr uint32_t INVALID_COLLIDER_ID = static_cast<uint32_t>(-1);
+
+// Collision layers of a new collider, and the query mask that accepts every layer
+constexpr uint32_t DEFAULT_COLLISION_LAYERS = 1U;
+constexpr uint32_t ALL_COLLISION_LAYERS = static_cast<uint32_t>(-1);
 
 /**
  * @brief Collider2D that holds bounding volume information.
+ * @details The shape is expressed in the local space of the collider, LocalTransform places the collider on its rigid
+ * body. Scale of LocalTransform is ignored since colliders are rigid.
  */
 class PHYSICS2D_API CCollider2D final
 {
+    // The world assigns ColliderId when the collider is registered
+    friend class CPhysicsWorld2D;
+
 public:
     CCollider2D() = default;
-    ~CCollider2D() = default;
+    explicit CCollider2D(std::unique_ptr<CPrimitiveShape2D> shape, const STransform2D& localTransform = STransform2D());
+    ~CCollider2D();
 
     CCollider2D(const CCollider2D&) = delete;
     CCollider2D(CCollider2D&&) noexcept = default;
@@ -35,9 +51,24 @@ public:
     CCollider2D& operator=(const CCollider2D&) = delete;
     CCollider2D& operator=(CCollider2D&&) noexcept = default;
 
-    // @TODO: Broad Phase -> Providing simple BoundingCircle2D to filter potential collisions quickly
+    // Broad Phase -> world-space AABB of the shape for the body pose
+    [[nodiscard]] CBoundingAABB2D ComputeAABB(const SPose2D& bodyPose) const;
+
+    // Getters
+    [[nodiscard]] const CPrimitiveShape2D* GetShape() const;
+    [[nodiscard]] const STransform2D&      GetLocalTransform() const;
+    [[nodiscard]] const SPose2D&           GetLocalPose() const;
 
-    // @TODO: Narrow Phase -> Providing AABB or Other BoundingVolume2D for precise collision detection
+    // Id in the physics world, INVALID_COLLIDER_ID if not registered
+    [[nodiscard]] uint32_t GetColliderId() const;
+
+    // One bit per layer the collider belongs to, world queries only report colliders sharing a bit with their mask
+    [[nodiscard]] uint32_t GetCollisionLayers() const;
+
+    // Setters, call CPhysicsWorld2D::RefreshCollider() afterwards if the collider is registered
+    void SetShape(std::unique_ptr<CPrimitiveShape2D> shape);
+    void SetLocalTransform(const STransform2D& localTransform);
+    void SetCollisionLayers(uint32_t collisionLayers);
 
 private:
     // Primitive Shape
@@ -46,8 +77,12 @@ private:
     // Local Transform
     STransform2D LocalTransform;
 
-    // @TODO: Cache Bounding Volume for two collision detection phases???
+    // LocalTransform without scale, cached for the per-step bounds update
+    SPose2D LocalPose;
+
+    uint32_t ColliderId = INVALID_COLLIDER_ID;
 
+    uint32_t CollisionLayers = DEFAULT_COLLISION_LAYERS;
 };
 
-NAMESPACE_END() // namespace PHYE::Physics2D
\ No newline at end of file
+NAMESPACE_END() // namespace PHYE::Physics2D
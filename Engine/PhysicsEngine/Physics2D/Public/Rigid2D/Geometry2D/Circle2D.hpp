@@ -40,6 +40,8 @@ public:
     {
         return Radius;
     }
+
+    [[nodiscard]] CBoundingAABB2D ComputeAABB(const SPose2D& pose) const override;
 };
 
 NAMESPACE_END() // namespace PHYE::Physics2D
\ No newline at end of file
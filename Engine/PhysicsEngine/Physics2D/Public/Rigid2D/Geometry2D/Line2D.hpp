@@ -26,7 +26,7 @@ private:
 public:
     ~CLine2D() override = default;
 
-    CLine2D() = default;
+    CLine2D();
     CLine2D(CPoint2D start, CPoint2D end);
     CLine2D(CPoint2D start, const SVector2F& extend);
 
@@ -47,6 +47,8 @@ public:
     [[nodiscard]] CPoint2D  GetStart() const;
     [[nodiscard]] CPoint2D  GetEnd() const;
     [[nodiscard]] SVector2F GetDiagonal() const;
+
+    [[nodiscard]] CBoundingAABB2D ComputeAABB(const SPose2D& pose) const override;
 };
 
 NAMESPACE_END() // namespace PHYE::Physics2D
\ No newline at end of file
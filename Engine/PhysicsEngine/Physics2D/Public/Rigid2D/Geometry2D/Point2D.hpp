@@ -27,9 +27,9 @@ public:
     ~CPoint2D() override = default;
 
     constexpr CPoint2D();
-    explicit constexpr CPoint2D(float value) : Position(value)
+    explicit constexpr CPoint2D(float value) : CPrimitiveShape2D(EShapeType2D::Point), Position(value)
     {}
-    constexpr CPoint2D(float x, float y) : Position(x, y)
+    constexpr CPoint2D(float x, float y) : CPrimitiveShape2D(EShapeType2D::Point), Position(x, y)
     {}
     explicit CPoint2D(SVector2F vector2f);
 
@@ -75,6 +75,8 @@ public:
     void SetX(float x);
     void SetY(float y);
     void Set(const SVector2F& vector);
+
+    [[nodiscard]] CBoundingAABB2D ComputeAABB(const SPose2D& pose) const override;
 };
 
 NAMESPACE_END() // namespace PHYE::Physics2D
\ No newline at end of file
@@ -0,0 +1,76 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <CoreMacros.hpp>
+#include <Physics2D.hpp>
+#include <Rigid2D/Geometry2D/PrimitiveShape2D.hpp>
+#include <Vectors/Vectors.hpp>
+#include <array>
+#include <cstdint>
+#include <span>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+// Capacity of the inline vertex arrays of a convex polygon
+constexpr uint32_t MAX_POLYGON_VERTICES_2D = 8;
+
+/**
+ * @brief Polygon2D(convex)
+ * @details A convex polygon with at most MAX_POLYGON_VERTICES_2D vertices, stored inline so that a polygon never
+ * allocates. Vertices are counter-clockwise in the local space of the shape, Normals[i] is the outward unit normal of
+ * the edge Vertices[i] -> Vertices[i+1].
+ */
+class PHYSICS2D_API CPolygon2D final : public CPrimitiveShape2D
+{
+private:
+    std::array<SVector2F, MAX_POLYGON_VERTICES_2D> Vertices;
+    std::array<SVector2F, MAX_POLYGON_VERTICES_2D> Normals;
+    SVector2F                                      Centroid;
+    uint32_t                                       VertexCount;
+
+public:
+    ~CPolygon2D() override = default;
+
+    // Unit square centered at the origin
+    CPolygon2D();
+
+    /**
+     * @brief Build the convex hull of the points.
+     * @details Duplicated and collinear points are removed. Points without a hull of at least 3 vertices and a
+     * positive area(see IsValidHull) give a thin rectangle along them instead, so the shape is never degenerate.
+     * @param points At most MAX_POLYGON_VERTICES_2D points, in any order.
+     */
+    explicit CPolygon2D(std::span<const SVector2F> points);
+
+    // Whether the points have a convex hull of at least 3 vertices and a positive area
+    [[nodiscard]] static bool IsValidHull(std::span<const SVector2F> points);
+
+    CPolygon2D(const CPolygon2D& other) = default;
+    CPolygon2D(CPolygon2D&& other) noexcept = default;
+
+    CPolygon2D& operator=(const CPolygon2D& other) = default;
+    CPolygon2D& operator=(CPolygon2D&& other) noexcept = default;
+
+    // Getters
+    [[nodiscard]] std::span<const SVector2F> GetVertices() const;
+    [[nodiscard]] std::span<const SVector2F> GetNormals() const;
+    [[nodiscard]] SVector2F                  GetCentroid() const;
+
+    [[nodiscard]] constexpr uint32_t GetVertexCount() const
+    {
+        return VertexCount;
+    }
+
+    [[nodiscard]] float Area() const;
+
+    [[nodiscard]] CBoundingAABB2D ComputeAABB(const SPose2D& pose) const override;
+};
+
+NAMESPACE_END() // namespace PHYE::Physics2D
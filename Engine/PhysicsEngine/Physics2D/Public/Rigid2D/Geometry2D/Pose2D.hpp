@@ -0,0 +1,85 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <CoreMacros.hpp>
+#include <MathUtility/MathUtilities.hpp>
+#include <Vectors/Vectors.hpp>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+/**
+ * @brief Pose2D
+ * @details A rigid transform (translation + rotation, no scale) with the rotation stored as cosine/sine.
+ * It is what the collision pipeline uses to place shapes in the world, since applying it costs a few multiply-adds
+ * compared with building a STransform2D matrix.
+ */
+struct SPose2D final
+{
+    SVector2F Position;
+    float     Cos;
+    float     Sin;
+
+    constexpr SPose2D() : Position(0.0F), Cos(1.0F), Sin(0.0F)
+    {}
+
+    // Construct with position and rotation(in radians)
+    SPose2D(const SVector2F& position, float rotation)
+        : Position(position), Cos(BE::Math::Cos(rotation)), Sin(BE::Math::Sin(rotation))
+    {}
+
+    SPose2D(const SVector2F& position, float cos, float sin) : Position(position), Cos(cos), Sin(sin)
+    {}
+
+    // Rotation in radians
+    [[nodiscard]] float GetRotation() const
+    {
+        return BE::Math::ATan2(Sin, Cos);
+    }
+
+    // Rotate a vector
+    [[nodiscard]] SVector2F Rotate(const SVector2F& vector) const
+    {
+        return SVector2F((Cos * vector.X) - (Sin * vector.Y), (Sin * vector.X) + (Cos * vector.Y));
+    }
+
+    // Rotate a vector by the inverse rotation
+    [[nodiscard]] SVector2F InverseRotate(const SVector2F& vector) const
+    {
+        return SVector2F((Cos * vector.X) + (Sin * vector.Y), (-Sin * vector.X) + (Cos * vector.Y));
+    }
+
+    // Local point -> world point
+    [[nodiscard]] SVector2F TransformPoint(const SVector2F& point) const
+    {
+        return Rotate(point) + Position;
+    }
+
+    // World point -> local point
+    [[nodiscard]] SVector2F InverseTransformPoint(const SVector2F& point) const
+    {
+        return InverseRotate(point - Position);
+    }
+
+    // Combine: (this * local) places local in the space of this
+    [[nodiscard]] SPose2D operator*(const SPose2D& local) const
+    {
+        return SPose2D(TransformPoint(local.Position), (Cos * local.Cos) - (Sin * local.Sin),
+                       (Sin * local.Cos) + (Cos * local.Sin));
+    }
+
+    // Inverse(this) * other, i.e. other expressed in the space of this
+    [[nodiscard]] SPose2D InverseMultiply(const SPose2D& other) const
+    {
+        return SPose2D(InverseTransformPoint(other.Position), (Cos * other.Cos) + (Sin * other.Sin),
+                       (Cos * other.Sin) - (Sin * other.Cos));
+    }
+};
+
+NAMESPACE_END() // namespace PHYE::Physics2D
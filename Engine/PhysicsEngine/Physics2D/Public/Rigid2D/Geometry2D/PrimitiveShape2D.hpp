@@ -10,17 +10,48 @@
 
 #include <CoreMacros.hpp>
 #include <Physics2D.hpp>
+#include <cstddef>
+#include <cstdint>
 
 NAMESPACE_BEGIN(PHYE::Physics2D)
 
+// Forward Declarations
+class CBoundingAABB2D;
+struct SPose2D;
+
+/**
+ * @brief Concrete type of a CPrimitiveShape2D.
+ * @details The order matters: the narrowphase orders every pair so that the first shape has the smaller type, and
+ * the collide functions are written for that order.
+ */
+enum class EShapeType2D : uint8_t
+{
+    Point = 0,
+    Circle,
+    Line,
+    Rectangle,
+    OrientedRectangle,
+    Polygon,
+
+    Count
+};
+
+constexpr size_t SHAPE_TYPE_COUNT_2D = static_cast<size_t>(EShapeType2D::Count);
+
 /**
  * @brief PrimitiveShape2D
  * @details Base class for all 2D primitive shapes used in the physics engine.
+ * Every shape carries its EShapeType2D so that hot code can switch on the type and static_cast to the concrete shape
+ * instead of going through virtual calls.
  */
 class PHYSICS2D_API CPrimitiveShape2D
 {
+private:
+    EShapeType2D ShapeType;
+
 public:
-    CPrimitiveShape2D() = default;
+    explicit constexpr CPrimitiveShape2D(EShapeType2D shapeType) : ShapeType(shapeType)
+    {}
     virtual ~CPrimitiveShape2D() = default;
 
     CPrimitiveShape2D(const CPrimitiveShape2D& other) = default;
@@ -28,6 +59,17 @@ public:
 
     CPrimitiveShape2D& operator=(const CPrimitiveShape2D& other) = default;
     CPrimitiveShape2D& operator=(CPrimitiveShape2D&& other) noexcept = default;
+
+    [[nodiscard]] constexpr EShapeType2D GetShapeType() const
+    {
+        return ShapeType;
+    }
+
+    /**
+     * @brief Compute the world-space AABB of the shape.
+     * @param pose Pose that maps the local space of the shape to the world.
+     */
+    [[nodiscard]] virtual CBoundingAABB2D ComputeAABB(const SPose2D& pose) const = 0;
 };
 
 NAMESPACE_END() // namespace PHYE::Physics2D
\ No newline at end of file
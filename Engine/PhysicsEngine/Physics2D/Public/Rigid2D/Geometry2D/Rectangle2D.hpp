@@ -48,6 +48,8 @@ public:
     [[nodiscard]] float Perimeter() const;
     [[nodiscard]] float Area() const;
     [[nodiscard]] float DiagonalLength() const;
+
+    [[nodiscard]] CBoundingAABB2D ComputeAABB(const SPose2D& pose) const override;
 };
 
 /**
@@ -82,6 +84,8 @@ public:
     {
         return Angle;
     }
+
+    [[nodiscard]] CBoundingAABB2D ComputeAABB(const SPose2D& pose) const override;
 };
 
 NAMESPACE_END() // namespace PHYE::Physics2D
\ No newline at end of file
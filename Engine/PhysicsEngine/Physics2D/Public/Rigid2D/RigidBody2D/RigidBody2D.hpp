@@ -9,8 +9,9 @@
 #pragma once
 
 #include <CoreMacros.hpp>
-#include <NekiraECS/Core/Entity/Entity.hpp>
 #include <Physics2D.hpp>
+#include <PhysicsWorld2D/BodyId2D.hpp>
+#include <RigidBodyType.hpp>
 #include <memory>
 #include <vector>
 
@@ -20,31 +21,53 @@ NAMESPACE_BEGIN(PHYE::Physics2D)
 
 // Forward Declarations
 class CCollider2D;
+class CPhysicsWorld2D;
+struct SRigidBodyComponent2D;
 
 /**
  * @brief RigidBody2D
- * @details holds Colliders and Entity links to the SRigidBodyComponent2D component.
+ * @details holds Colliders and the id of its SRigidBodyComponent2D component.
  * We want to use ECS for better performance, so the rigid body properties are moved to SRigidBodyComponent2D
- * component. And we remain a RigidBodyEntity in this class to link the component.
+ * component, stored by the world the body lives in. And we remain a BodyId in this class to link the component.
  */
 class PHYSICS2D_API CRigidBody2D final
 {
 private:
-    // Rigid Body Entity(Used to link SRigidBodyComponent2D component)
-    NekiraECS::Entity RigidBodyEntity;
+    // World storing the component
+    CPhysicsWorld2D* World;
+
+    // Id of the SRigidBodyComponent2D component in World
+    SBodyId2D BodyId;
 
     // Colliders attached to this rigid body
     std::vector<std::unique_ptr<CCollider2D>> Colliders;
 
 public:
-    CRigidBody2D();
+    explicit CRigidBody2D(CPhysicsWorld2D& world,
+                          PHYE::PhysicsBase::ERigidBodyType type = PHYE::PhysicsBase::ERigidBodyType::Static,
+                          float mass = 1.0F, float inertia = 1.0F);
     ~CRigidBody2D();
 
+    // The component is destroyed with the body, a moved-from body would destroy it twice
     CRigidBody2D(const CRigidBody2D&) = delete;
-    CRigidBody2D(CRigidBody2D&&) noexcept = default;
+    CRigidBody2D(CRigidBody2D&&) noexcept = delete;
 
     CRigidBody2D& operator=(const CRigidBody2D&) = delete;
-    CRigidBody2D& operator=(CRigidBody2D&&) noexcept = default;
+    CRigidBody2D& operator=(CRigidBody2D&&) noexcept = delete;
+
+    [[nodiscard]] SBodyId2D        GetBodyId() const;
+    [[nodiscard]] CPhysicsWorld2D& GetWorld() const;
+
+    // Attach a collider and register it in the physics world
+    CCollider2D* AddCollider(std::unique_ptr<CCollider2D> collider);
+
+    // Detach a collider, it is destroyed with the call
+    void RemoveCollider(const CCollider2D* collider);
+
+    [[nodiscard]] const std::vector<std::unique_ptr<CCollider2D>>& GetColliders() const;
+
+    // Rigid body component in the physics world, do not keep the pointer across body creation/destruction
+    [[nodiscard]] SRigidBodyComponent2D* GetComponent() const;
 };
 
 NAMESPACE_END() // namespace PHYE::Physics2D
\ No newline at end of file
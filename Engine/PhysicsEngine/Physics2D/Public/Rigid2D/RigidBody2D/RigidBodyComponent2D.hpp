@@ -16,10 +16,15 @@
 #include <RigidBodyType.hpp>
 #include <Transforms/Transforms.hpp>
 #include <Vectors/Vectors.hpp>
+#include <cstdint>
 
 
 NAMESPACE_BEGIN(PHYE::Physics2D)
 
+// Force groups of a new body, and the field mask that reaches every group
+constexpr uint32_t DEFAULT_FORCE_GROUPS = 1U;
+constexpr uint32_t ALL_FORCE_GROUPS = static_cast<uint32_t>(-1);
+
 /**
  * @brief 2D Rigid Body Component
  * @details This component holds rigid body properties for 2D physics simulation.
@@ -32,15 +37,32 @@ struct PHYSICS2D_API SRigidBodyComponent2D final : public NekiraECS::Component<S
     // 刚体类型
     PHYE::PhysicsBase::ERigidBodyType Type;
 
-    // 位置和旋转
+    // 位置和旋转，由Position与Rotation在每次Step结束时同步，供外部读取
     STransform2D Transform;
 
+    // 质心位置（世界空间），模拟时使用的状态
+    SVector2F Position;
+
+    // 旋转角（弧度），模拟时使用的状态
+    float Rotation;
+
     // 线速度
     SVector2F Velocity;
 
-    // 角速度
+    // 角速度（弧度/秒）
     float AngularVelocity;
 
+    // 累积的外力与力矩，每次Step结束时清零
+    SVector2F Force;
+    float     Torque;
+
+    // 线性阻尼与角阻尼
+    float LinearDamping;
+    float AngularDamping;
+
+    // 重力缩放
+    float GravityScale;
+
     // 质量
     float Mass;
     // 质量的倒数，优化计算，0表示无限大质量（static类型刚体）
@@ -51,6 +73,18 @@ struct PHYSICS2D_API SRigidBodyComponent2D final : public NekiraECS::Component<S
     // 转动惯量的倒数
     float InverseInertia;
 
+    // 是否处于活动状态，休眠的刚体不参与积分、窄相位与求解，直到被接触、外力或 WakeRigidBody() 唤醒
+    bool IsAwake;
+
+    // 速度持续低于休眠阈值的时间（秒）
+    float SleepTime;
+
+    // 高速刚体（如子弹），每步结束时沿运动轨迹做连续碰撞检测，避免穿过其它碰撞体
+    bool IsBullet;
+
+    // 力场分组掩码，只有 BodyGroups 与之有交集的力场(见 CForceFieldRegistry2D)作用于该刚体
+    uint32_t ForceGroups;
+
     ~SRigidBodyComponent2D() override = default;
 
     SRigidBodyComponent2D();
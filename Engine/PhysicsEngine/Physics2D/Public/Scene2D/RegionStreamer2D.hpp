@@ -0,0 +1,135 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <CoreMacros.hpp>
+#include <Physics2D.hpp>
+#include <PhysicsWorld2D/BodyId2D.hpp>
+#include <Rigid2D/BoundingVolume2D/BoundingAABB2D.hpp>
+#include <Scene2D/SceneBatch2D.hpp>
+#include <Scene2D/SceneFile2D.hpp>
+#include <Scene2D/SceneShapes2D.hpp>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+enum class ERegionState2D : uint8_t
+{
+    Unloaded = 0,
+
+    // Being mapped and prepared on the streaming thread
+    Loading,
+
+    // Bodies and colliders are in the world
+    Resident,
+
+    // The scene file could not be read, only an explicit load retries it
+    Failed,
+};
+
+/**
+ * @brief A region of a streamed map, registered in a CPhysicsWorld2D.
+ */
+struct PHYSICS2D_API SStreamingRegion2D final
+{
+    // Scene file holding the bodies and colliders of the region
+    std::filesystem::path Path;
+
+    // Space covered by the region, tested against the streaming focus
+    CBoundingAABB2D Bounds;
+
+    ERegionState2D State = ERegionState2D::Unloaded;
+
+    // Whether the region should be resident, a region unloaded while loading is dropped once prepared
+    bool IsWanted = false;
+
+    // Content of a resident region
+    std::vector<SBodyId2D>          Bodies;
+    std::vector<uint32_t>           Colliders;
+    std::unique_ptr<CSceneShapes2D> Shapes;
+};
+
+/**
+ * @brief A region file mapped and prepared by the streaming thread.
+ */
+struct PHYSICS2D_API SPreparedRegion2D final
+{
+    uint32_t RegionId = 0;
+
+    // false if the file could not be mapped or is not a valid scene
+    bool IsValid = false;
+
+    // Mapped file, Batch reads its records
+    CSceneFile2D  File;
+    SSceneBatch2D Batch;
+};
+
+/**
+ * @brief Region Streamer 2D
+ * @details Owns a thread that maps region files and prepares them with PrepareSceneBatch(), so the simulation thread
+ * only merges finished batches. The thread sleeps while there is nothing to load. The thread is not a job of the
+ * BE::Core::CJobSystem on purpose: loads block on file I/O and would hold a worker for the whole time.
+ */
+class PHYSICS2D_API CRegionStreamer2D final
+{
+public:
+    CRegionStreamer2D();
+
+    // Stops the thread, requests not started yet are dropped
+    ~CRegionStreamer2D();
+
+    CRegionStreamer2D(const CRegionStreamer2D&) = delete;
+    CRegionStreamer2D(CRegionStreamer2D&&) noexcept = delete;
+
+    CRegionStreamer2D& operator=(const CRegionStreamer2D&) = delete;
+    CRegionStreamer2D& operator=(CRegionStreamer2D&&) noexcept = delete;
+
+    // Queue a region file, requests are served in order
+    void RequestLoad(uint32_t regionId, const std::filesystem::path& path);
+
+    // Move the regions prepared since the last call to the end of outRegions
+    void TakePrepared(std::vector<std::unique_ptr<SPreparedRegion2D>>& outRegions);
+
+    // Block until every requested region has been prepared
+    void WaitIdle();
+
+private:
+    struct SLoadRequest final
+    {
+        uint32_t              RegionId = 0;
+        std::filesystem::path Path;
+    };
+
+    void ThreadMain();
+
+private:
+    std::mutex              Mutex;
+    std::condition_variable RequestCondition;
+    std::condition_variable IdleCondition;
+
+    std::deque<SLoadRequest>                        Requests;
+    std::vector<std::unique_ptr<SPreparedRegion2D>> Prepared;
+
+    // Requests not prepared yet, including the one in progress
+    uint32_t PendingCount;
+
+    bool IsStopping;
+
+    // Declared last, started once the other members are constructed
+    std::thread Thread;
+};
+
+NAMESPACE_END() // namespace PHYE::Physics2D
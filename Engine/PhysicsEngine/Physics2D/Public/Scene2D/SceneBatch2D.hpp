@@ -0,0 +1,52 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <BroadPhase2D/DynamicAABBTree2D.hpp>
+#include <CoreMacros.hpp>
+#include <Physics2D.hpp>
+#include <Rigid2D/BoundingVolume2D/BoundingAABB2D.hpp>
+#include <Rigid2D/Geometry2D/Pose2D.hpp>
+#include <Rigid2D/Geometry2D/PrimitiveShape2D.hpp>
+#include <Scene2D/SceneFormat2D.hpp>
+#include <Scene2D/SceneShapes2D.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+/**
+ * @brief A scene prepared for a CPhysicsWorld2D, left to be merged at a step boundary.
+ * @details Preparing does the part of loading that needs no world: the shapes are created, the pose and bounds of
+ * every collider computed and the prebuilt tree converted, so it can run on a loading thread. Merging is then left
+ * with creating the bodies, filling the collider records and one batch insertion into the broadphase.
+ * The body records are still read from the scene while merging, its bytes must outlive the batch.
+ */
+struct PHYSICS2D_API SSceneBatch2D final
+{
+    CSceneView2D Scene;
+
+    std::unique_ptr<CSceneShapes2D> Shapes;
+
+    // Per collider of the scene, in file order
+    std::vector<const CPrimitiveShape2D*> ColliderShapes;
+    std::vector<SPose2D>                  LocalPoses;
+    std::vector<SPose2D>                  Poses;
+    std::vector<CBoundingAABB2D>          AABBs;
+    std::vector<uint8_t>                  IsDynamic;
+
+    // Tree of the scene, empty when the file has none
+    std::vector<STreeNode2D> TreeNodes;
+};
+
+// Prepare a scene for CPhysicsWorld2D, may be called on any thread
+PHYSICS2D_API void PrepareSceneBatch(const CSceneView2D& scene, SSceneBatch2D& outBatch);
+
+NAMESPACE_END() // namespace PHYE::Physics2D
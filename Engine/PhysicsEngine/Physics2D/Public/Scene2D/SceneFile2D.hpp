@@ -0,0 +1,56 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <CoreMacros.hpp>
+#include <File/MappedFile.hpp>
+#include <Physics2D.hpp>
+#include <Scene2D/SceneFormat2D.hpp>
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+/**
+ * @brief A scene file mapped into memory.
+ * @details Opening a scene maps the file and validates it, nothing is parsed or copied: CPhysicsWorld2D::LoadScene()
+ * reads the records straight from the mapped pages. Keep the file open while loading, it can be closed afterwards.
+ */
+class PHYSICS2D_API CSceneFile2D final
+{
+public:
+    CSceneFile2D() = default;
+    ~CSceneFile2D() = default;
+
+    CSceneFile2D(const CSceneFile2D&) = delete;
+    CSceneFile2D(CSceneFile2D&&) noexcept = default;
+
+    CSceneFile2D& operator=(const CSceneFile2D&) = delete;
+    CSceneFile2D& operator=(CSceneFile2D&&) noexcept = default;
+
+    // Map and validate a scene file, false if it cannot be read or is not a scene of SCENE_VERSION_2D
+    bool Open(const std::filesystem::path& path);
+
+    void Close();
+
+    [[nodiscard]] const CSceneView2D& GetView() const
+    {
+        return View;
+    }
+
+    // Write the bytes produced by CPhysicsWorld2D::WriteScene() to a file
+    static bool Save(const std::filesystem::path& path, std::span<const std::byte> bytes);
+
+private:
+    BE::Core::CMappedFile File;
+    CSceneView2D          View;
+};
+
+NAMESPACE_END() // namespace PHYE::Physics2D
@@ -0,0 +1,244 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <BroadPhase2D/BroadPhase2D.hpp>
+#include <BroadPhase2D/DynamicAABBTree2D.hpp>
+#include <CoreMacros.hpp>
+#include <Physics2D.hpp>
+#include <Rigid2D/Geometry2D/Polygon2D.hpp>
+#include <Rigid2D/Geometry2D/PrimitiveShape2D.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+// "NPS2" read as a little endian word
+constexpr uint32_t SCENE_MAGIC_2D = 0x3253504EU;
+
+// Bumped on every change of the records below, files of another version are rejected
+constexpr uint32_t SCENE_VERSION_2D = 2;
+
+// Written in native byte order, reads back as 0x04030201 on a machine of the other endianness
+constexpr uint32_t SCENE_ENDIAN_TAG_2D = 0x01020304U;
+
+// Every section starts on a cache line of a mapped file(mappings are page aligned)
+constexpr size_t SCENE_SECTION_ALIGNMENT_2D = 64;
+
+/**
+ * @brief A table of records in a scene file.
+ */
+struct SSceneSection2D final
+{
+    // Byte offset from the start of the file, multiple of SCENE_SECTION_ALIGNMENT_2D
+    uint64_t Offset = 0;
+
+    // Number of records
+    uint64_t Count = 0;
+};
+
+/**
+ * @brief First bytes of a scene file.
+ */
+struct SSceneHeader2D final
+{
+    uint32_t Magic = SCENE_MAGIC_2D;
+    uint32_t Version = SCENE_VERSION_2D;
+    uint32_t EndianTag = SCENE_ENDIAN_TAG_2D;
+
+    // sizeof(SSceneHeader2D)
+    uint32_t HeaderSize = 0;
+
+    // SSceneBody2D, SSceneCollider2D and SSceneTreeNode2D records
+    SSceneSection2D Bodies;
+    SSceneSection2D Colliders;
+    SSceneSection2D TreeNodes;
+
+    // Root of the prebuilt broadphase tree, NULL_TREE_NODE when the file has none
+    int32_t TreeRoot = NULL_TREE_NODE;
+
+    uint32_t Reserved = 0;
+};
+
+/**
+ * @brief A rigid body of a scene, the state a body is created with.
+ */
+struct SSceneBody2D final
+{
+    float PositionX = 0.0F;
+    float PositionY = 0.0F;
+    float Rotation = 0.0F;
+
+    float VelocityX = 0.0F;
+    float VelocityY = 0.0F;
+    float AngularVelocity = 0.0F;
+
+    float LinearDamping = 0.0F;
+    float AngularDamping = 0.0F;
+    float GravityScale = 1.0F;
+
+    float Mass = 0.0F;
+    float Inertia = 0.0F;
+
+    // PHYE::PhysicsBase::ERigidBodyType
+    uint8_t Type = 0;
+
+    uint8_t IsBullet = 0;
+
+    std::array<uint8_t, 2> Reserved{};
+
+    // SRigidBodyComponent2D::ForceGroups
+    uint32_t ForceGroups = 0;
+};
+
+/**
+ * @brief A collider of a scene with its shape inlined.
+ * @details The shape parameters depend on ShapeType, in the local space of the collider:
+ * - Point: Points[0, 1] is the position.
+ * - Circle: Points[0, 1] is the center, Scalar the radius.
+ * - Line: Points[0, 1] is the start, Points[2, 3] the end.
+ * - Rectangle: Points[0, 1] is the origin, Points[2, 3] the end.
+ * - OrientedRectangle: Points[0, 1] is the center, Points[2, 3] the half extents, Scalar the rotation in degrees.
+ * - Polygon: VertexCount vertices as x, y pairs.
+ */
+struct SSceneCollider2D final
+{
+    // Index of the body in the body section
+    uint32_t BodyIndex = 0;
+
+    uint32_t CollisionLayers = 0;
+
+    // Leaf of the collider in the prebuilt tree, INVALID_PROXY_ID when the file has no tree
+    int32_t ProxyId = INVALID_PROXY_ID;
+
+    // EShapeType2D
+    uint8_t ShapeType = 0;
+
+    uint8_t VertexCount = 0;
+
+    std::array<uint8_t, 2> Reserved{};
+
+    // Local pose of the collider on its body
+    float LocalPositionX = 0.0F;
+    float LocalPositionY = 0.0F;
+    float LocalCos = 1.0F;
+    float LocalSin = 0.0F;
+
+    float                                          Scalar = 0.0F;
+    std::array<float, 2 * MAX_POLYGON_VERTICES_2D> Points{};
+};
+
+/**
+ * @brief A node of the prebuilt broadphase tree, STreeNode2D with the user data of a leaf being the index of its
+ * collider in the collider section.
+ */
+struct SSceneTreeNode2D final
+{
+    float MinX = 0.0F;
+    float MinY = 0.0F;
+    float MaxX = 0.0F;
+    float MaxY = 0.0F;
+
+    uint32_t UserData = 0;
+    int32_t  Parent = NULL_TREE_NODE;
+    int32_t  Child1 = NULL_TREE_NODE;
+    int32_t  Child2 = NULL_TREE_NODE;
+
+    // Leaf = 0, free node = -1
+    int32_t Height = -1;
+};
+
+// 记录直接从映射的文件中读取，布局一旦发布就不能改变(改变时需要提升 SCENE_VERSION_2D)
+static_assert(std::is_trivially_copyable_v<SSceneHeader2D> && sizeof(SSceneHeader2D) == 72);
+static_assert(std::is_trivially_copyable_v<SSceneBody2D> && sizeof(SSceneBody2D) == 52);
+static_assert(std::is_trivially_copyable_v<SSceneCollider2D> && sizeof(SSceneCollider2D) == 100);
+static_assert(std::is_trivially_copyable_v<SSceneTreeNode2D> && sizeof(SSceneTreeNode2D) == 36);
+
+/**
+ * @brief Validated view of the bytes of a scene file.
+ * @details Attach() checks the header, the bounds and alignment of every section, the indices stored in the records,
+ * that every number is finite and every radius or extent non-negative, that every polygon has a hull with a positive
+ * area, and that the prebuilt tree is a proper binary tree(each used node reached once from the root, consistent links
+ * and heights), so that a corrupt or hostile file is rejected instead of breaking the broadphase later. The records
+ * are then read in place: the view only keeps pointers into the bytes, which must stay alive and unchanged while it
+ * is used.
+ */
+class PHYSICS2D_API CSceneView2D final
+{
+public:
+    CSceneView2D() = default;
+    ~CSceneView2D() = default;
+
+    CSceneView2D(const CSceneView2D&) = default;
+    CSceneView2D(CSceneView2D&&) noexcept = default;
+
+    CSceneView2D& operator=(const CSceneView2D&) = default;
+    CSceneView2D& operator=(CSceneView2D&&) noexcept = default;
+
+    /**
+     * @brief Point the view at the bytes of a scene file, aligned to at least 8 bytes.
+     * @return false if they do not hold a valid scene of SCENE_VERSION_2D, the view is left empty then.
+     */
+    bool Attach(std::span<const std::byte> bytes);
+
+    void Reset();
+
+    [[nodiscard]] bool IsValid() const
+    {
+        return Header != nullptr;
+    }
+
+    [[nodiscard]] bool HasTree() const
+    {
+        return !TreeNodes.empty();
+    }
+
+    [[nodiscard]] int32_t GetTreeRoot() const
+    {
+        return Header != nullptr ? Header->TreeRoot : NULL_TREE_NODE;
+    }
+
+    [[nodiscard]] std::span<const SSceneBody2D> GetBodies() const
+    {
+        return Bodies;
+    }
+
+    [[nodiscard]] std::span<const SSceneCollider2D> GetColliders() const
+    {
+        return Colliders;
+    }
+
+    [[nodiscard]] std::span<const SSceneTreeNode2D> GetTreeNodes() const
+    {
+        return TreeNodes;
+    }
+
+private:
+    const SSceneHeader2D*             Header = nullptr;
+    std::span<const SSceneBody2D>     Bodies;
+    std::span<const SSceneCollider2D> Colliders;
+    std::span<const SSceneTreeNode2D> TreeNodes;
+};
+
+// Write the parameters of a shape into the collider record, see SSceneCollider2D
+PHYSICS2D_API void EncodeSceneShape(const CPrimitiveShape2D& shape, SSceneCollider2D& outCollider);
+
+/**
+ * @brief Lay out a header and the sections into the bytes of a scene file.
+ * @param treeRoot Root of treeNodes, NULL_TREE_NODE without a tree.
+ */
+PHYSICS2D_API void SerializeScene(std::span<const SSceneBody2D> bodies, std::span<const SSceneCollider2D> colliders,
+                                  std::span<const SSceneTreeNode2D> treeNodes, int32_t treeRoot,
+                                  std::vector<std::byte>& outBytes);
+
+NAMESPACE_END() // namespace PHYE::Physics2D
@@ -0,0 +1,65 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <CoreMacros.hpp>
+#include <Physics2D.hpp>
+#include <Rigid2D/Geometry2D/Circle2D.hpp>
+#include <Rigid2D/Geometry2D/Line2D.hpp>
+#include <Rigid2D/Geometry2D/Point2D.hpp>
+#include <Rigid2D/Geometry2D/Polygon2D.hpp>
+#include <Rigid2D/Geometry2D/Rectangle2D.hpp>
+#include <Scene2D/SceneFormat2D.hpp>
+#include <cassert>
+#include <span>
+#include <utility>
+#include <vector>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+/**
+ * @brief Shapes of the colliders of one loaded scene.
+ * @details Scene colliders have no CCollider2D to own their shape, so the shapes of a scene are stored here, one array
+ * per shape type. The arrays are sized for the whole scene up front and never grow afterwards, which keeps the
+ * shape pointers held by the collider records valid.
+ */
+class PHYSICS2D_API CSceneShapes2D final
+{
+public:
+    // Reserve room for the shapes of every collider
+    explicit CSceneShapes2D(std::span<const SSceneCollider2D> colliders);
+    ~CSceneShapes2D() = default;
+
+    CSceneShapes2D(const CSceneShapes2D&) = delete;
+    CSceneShapes2D(CSceneShapes2D&&) noexcept = default;
+
+    CSceneShapes2D& operator=(const CSceneShapes2D&) = delete;
+    CSceneShapes2D& operator=(CSceneShapes2D&&) noexcept = default;
+
+    // Create the shape of one of the colliders passed to the constructor
+    const CPrimitiveShape2D* Create(const SSceneCollider2D& collider);
+
+private:
+    template <typename T, typename... Args>
+    static const T* Emplace(std::vector<T>& shapes, Args&&... args)
+    {
+        assert(shapes.size() < shapes.capacity());
+        return &shapes.emplace_back(std::forward<Args>(args)...);
+    }
+
+private:
+    std::vector<CPoint2D>             Points;
+    std::vector<CCircle2D>            Circles;
+    std::vector<CLine2D>              Lines;
+    std::vector<CRectangle2D>         Rectangles;
+    std::vector<COrientedRectangle2D> OrientedRectangles;
+    std::vector<CPolygon2D>           Polygons;
+};
+
+NAMESPACE_END() // namespace PHYE::Physics2D
@@ -0,0 +1,84 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <CoreMacros.hpp>
+#include <Physics2D.hpp>
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+// Number of colors, constraints that fit in none of them go to the overflow group
+constexpr uint32_t MAX_GRAPH_COLORS_2D = 16;
+
+// Body that a constraint reads but never writes(Static/Kinematic), it does not take part in the coloring
+constexpr uint32_t STATIC_SOLVER_BODY_2D = UINT32_MAX;
+
+/**
+ * @brief Solver bodies of a two-body constraint.
+ */
+struct SConstraintBodies2D final
+{
+    uint32_t BodyA = STATIC_SOLVER_BODY_2D;
+    uint32_t BodyB = STATIC_SOLVER_BODY_2D;
+};
+
+/**
+ * @brief Graph coloring of two-body constraints.
+ * @details No two constraints of the same color write the same body, so the constraints of a color can be solved in
+ * any order, several at a time in SIMD lanes. Colors are assigned greedily(first color where both bodies are free,
+ * tracked with one body bitset per color), which keeps the first colors large and the batches full. The bitsets are
+ * kept between builds and only the marked words are cleared, so a build costs O(constraints) however large the world.
+ * Constraints that touch a body already used by every color are solved one by one in the overflow group.
+ */
+class PHYSICS2D_API CConstraintGraph2D final
+{
+private:
+    // 每种颜色已占用的刚体(位集合)
+    std::array<std::vector<uint64_t>, MAX_GRAPH_COLORS_2D> ColorBodySets;
+
+    // 按颜色分组的约束索引，溢出组在最后
+    std::vector<uint32_t> ColorConstraints;
+
+    // Start of every color in ColorConstraints, the overflow group is the last one
+    std::array<uint32_t, MAX_GRAPH_COLORS_2D + 2> ColorStarts{};
+
+    // Color of every constraint(MAX_GRAPH_COLORS_2D for overflow)
+    std::vector<uint8_t> ConstraintColors;
+
+public:
+    CConstraintGraph2D() = default;
+    ~CConstraintGraph2D() = default;
+
+    CConstraintGraph2D(const CConstraintGraph2D&) = delete;
+    CConstraintGraph2D(CConstraintGraph2D&&) noexcept = default;
+
+    CConstraintGraph2D& operator=(const CConstraintGraph2D&) = delete;
+    CConstraintGraph2D& operator=(CConstraintGraph2D&&) noexcept = default;
+
+    /**
+     * @brief Color the constraints.
+     * @param constraints Bodies of every constraint, movable body indices must be below bodyCount.
+     */
+    void Build(std::span<const SConstraintBodies2D> constraints, uint32_t bodyCount);
+
+    // Constraint indices of a color, in increasing order
+    [[nodiscard]] std::span<const uint32_t> GetColor(uint32_t color) const;
+
+    // Constraints that did not fit in any color
+    [[nodiscard]] std::span<const uint32_t> GetOverflow() const;
+
+    // Number of colors holding at least one constraint
+    [[nodiscard]] uint32_t GetActiveColorCount() const;
+};
+
+NAMESPACE_END() // namespace PHYE::Physics2D
@@ -0,0 +1,226 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <CoreMacros.hpp>
+#include <Joint2D/JointStorage2D.hpp>
+#include <NarrowPhase2D/ContactManifold2D.hpp>
+#include <Physics2D.hpp>
+#include <PhysicsWorld2D/ColliderRecord2D.hpp>
+#include <PhysicsWorld2D/ComponentStorage2D.hpp>
+#include <Rigid2D/RigidBody2D/RigidBodyComponent2D.hpp>
+#include <Solver2D/ConstraintGraph2D.hpp>
+#include <Solver2D/SolverBody2D.hpp>
+#include <Solver2D/WideFloat2D.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+// Fraction of the penetration(beyond LINEAR_SLOP_2D) removed per step by the velocity bias
+constexpr float CONTACT_BAUMGARTE_2D = 0.2F;
+
+// Upper bound of the velocity used to push overlapping shapes apart
+constexpr float MAX_CONTACT_CORRECTION_VELOCITY_2D = 4.0F;
+
+// Approach speed below which contacts do not bounce
+constexpr float RESTITUTION_VELOCITY_THRESHOLD_2D = 1.0F;
+
+/**
+ * @brief One contact point of every lane of a batch.
+ */
+struct alignas(SIMD_ALIGNMENT_2D) SContactBatchPoint2D final
+{
+    // Contact point relative to the center of mass of A and B
+    TWideArray2D AnchorAX;
+    TWideArray2D AnchorAY;
+    TWideArray2D AnchorBX;
+    TWideArray2D AnchorBY;
+
+    // Effective masses along the normal and the tangent, 0 for a missing point
+    TWideArray2D NormalMass;
+    TWideArray2D TangentMass;
+
+    // Accumulated impulses
+    TWideArray2D NormalImpulse;
+    TWideArray2D TangentImpulse;
+
+    // Minimum relative normal velocity: negative lets a speculative gap close, positive pushes overlapping shapes apart
+    TWideArray2D Bias;
+};
+
+/**
+ * @brief SIMD_WIDTH_2D manifolds solved together, one per lane, laid out as structure of arrays.
+ * @details The manifolds of a batch come from the same graph color, so the lanes never write the same body. Unused
+ * lanes point to the dummy solver body and have zero masses.
+ */
+struct alignas(SIMD_ALIGNMENT_2D) SContactBatch2D final
+{
+    TWideIndexArray2D BodyA;
+    TWideIndexArray2D BodyB;
+
+    // Index of the manifold of every lane, UINT32_MAX for an unused lane
+    TWideIndexArray2D ManifoldIndex;
+
+    TWideArray2D NormalX;
+    TWideArray2D NormalY;
+    TWideArray2D Friction;
+
+    TWideArray2D InverseMassA;
+    TWideArray2D InverseInertiaA;
+    TWideArray2D InverseMassB;
+    TWideArray2D InverseInertiaB;
+
+    std::array<SContactBatchPoint2D, MAX_MANIFOLD_POINTS_2D> Points;
+};
+
+/**
+ * @brief One velocity row of every lane of a joint batch.
+ * @details A row constrains the relative velocity d . (vB - vA) + AngularB * wB - AngularA * wA, which covers the
+ * linear rows(d along an axis, Angular* = r x d) and the angular rows(d = 0, Angular* = 1) of every joint kind.
+ */
+struct alignas(SIMD_ALIGNMENT_2D) SJointBatchRow2D final
+{
+    TWideArray2D DirectionX;
+    TWideArray2D DirectionY;
+    TWideArray2D AngularA;
+    TWideArray2D AngularB;
+
+    // Effective mass, 0 for a row the joint does not use
+    TWideArray2D Mass;
+
+    // Relative velocity that removes JOINT_BAUMGARTE_2D of the position error
+    TWideArray2D Bias;
+
+    TWideArray2D Impulse;
+};
+
+/**
+ * @brief SIMD_WIDTH_2D joints solved together, one per lane, like SContactBatch2D.
+ * @details Joints of different kinds share a batch: each one fills the rows it needs, from the first one.
+ */
+struct alignas(SIMD_ALIGNMENT_2D) SJointBatch2D final
+{
+    TWideIndexArray2D BodyA;
+    TWideIndexArray2D BodyB;
+
+    // Dense index of the joint of every lane, INVALID_JOINT_ID for an unused lane
+    TWideIndexArray2D JointIndex;
+
+    TWideArray2D InverseMassA;
+    TWideArray2D InverseInertiaA;
+    TWideArray2D InverseMassB;
+    TWideArray2D InverseInertiaB;
+
+    std::array<SJointBatchRow2D, MAX_JOINT_ROWS_2D> Rows;
+};
+
+/**
+ * @brief ContactSolver2D
+ * @details Sequential-impulse contact solver. Prepare() colors the manifolds with CConstraintGraph2D and packs every
+ * color into SContactBatch2D, then each velocity iteration walks the batches in color order and solves all lanes of a
+ * batch at once with SWideFloat2D. Within a point the normal impulse is clamped to be non-negative and the friction
+ * impulse to the Coulomb cone of the accumulated normal impulse.
+ * Overflow manifolds(bodies already used by every color) get one batch each, which keeps the Gauss-Seidel order.
+ * Joints are colored in the same graph as the manifolds and packed into SJointBatch2D per color, so a color holds
+ * contact batches followed by joint batches that all write disjoint bodies. Batch indices below count both kinds, in
+ * that order within every color.
+ */
+class PHYSICS2D_API CContactSolver2D final
+{
+private:
+    CConstraintGraph2D Graph;
+
+    // Solver bodies of every solved manifold then every solved joint, and the same with immovable bodies replaced for
+    // the coloring
+    std::vector<SConstraintBodies2D> ConstraintBodies;
+    std::vector<SConstraintBodies2D> ColoringBodies;
+
+    // Batches of color 0, color 1, ..., then the overflow batches
+    std::vector<SContactBatch2D> Batches;
+    std::vector<SJointBatch2D>   JointBatches;
+
+    // Start of every color in Batches and JointBatches, the overflow group is the last one
+    std::array<uint32_t, MAX_GRAPH_COLORS_2D + 2> ContactBatchStarts{};
+    std::array<uint32_t, MAX_GRAPH_COLORS_2D + 2> JointBatchStarts{};
+
+public:
+    CContactSolver2D() = default;
+    ~CContactSolver2D() = default;
+
+    CContactSolver2D(const CContactSolver2D&) = delete;
+    CContactSolver2D(CContactSolver2D&&) noexcept = default;
+
+    CContactSolver2D& operator=(const CContactSolver2D&) = delete;
+    CContactSolver2D& operator=(CContactSolver2D&&) noexcept = default;
+
+    /**
+     * @brief Build the constraint batches of this step.
+     * @param manifolds Contact manifolds, with the warm starting impulses of the contact cache.
+     * @param manifoldIndices Manifolds to solve(those of the awake islands), the others are left untouched.
+     * @param joints Joints of the world, with the warm starting impulses of the previous step.
+     * @param jointIndices Dense indices of the joints to solve.
+     * @param colliders Collider records indexed by collider id.
+     * @param bodies Rigid bodies of the world, solver bodies share their dense indices.
+     * @param solverBodies Output of LoadSolverBodies2D(), the last one is the dummy body.
+     */
+    void Prepare(std::span<const SContactManifold2D> manifolds, std::span<const uint32_t> manifoldIndices,
+                 const CJointStorage2D& joints, std::span<const uint32_t> jointIndices,
+                 std::span<const SColliderRecord2D> colliders, const TComponentStorage2D<SRigidBodyComponent2D>& bodies,
+                 std::span<const SSolverBody2D> solverBodies, float friction, float restitution, float timeStep);
+
+    // Apply the accumulated impulses of the previous step
+    void WarmStart(std::span<SSolverBody2D> solverBodies) const;
+
+    // One velocity iteration over every batch
+    void SolveVelocities(std::span<SSolverBody2D> solverBodies);
+
+    /**
+     * @brief WarmStart()/SolveVelocities() over the batches [begin, end) only.
+     * @details Batches of the same color(see GetColorBatches()) write disjoint bodies, so ranges of one color can run
+     * on different threads. Colors, and the overflow batches, must still be processed in order.
+     */
+    void WarmStartBatches(std::span<SSolverBody2D> solverBodies, uint32_t begin, uint32_t end) const;
+    void SolveBatches(std::span<SSolverBody2D> solverBodies, uint32_t begin, uint32_t end);
+
+    // Batch range [first, second) of a color, color MAX_GRAPH_COLORS_2D is the overflow group
+    [[nodiscard]] std::pair<uint32_t, uint32_t> GetColorBatches(uint32_t color) const;
+
+    // Write the accumulated impulses back to the manifolds(for the contact cache) and to the joints
+    void StoreImpulses(std::span<SContactManifold2D> manifolds, CJointStorage2D& joints) const;
+
+    // Statistics of the last Prepare()
+    [[nodiscard]] uint32_t GetActiveColorCount() const;
+    [[nodiscard]] size_t   GetBatchCount() const;
+    [[nodiscard]] size_t   GetJointBatchCount() const;
+    [[nodiscard]] size_t   GetOverflowCount() const;
+
+private:
+    // Split the batch range [begin, end) into contact and joint ranges, color by color
+    template <typename TFunction>
+    void ForEachBatchRange(uint32_t begin, uint32_t end, TFunction&& function) const;
+
+    // Pack the constraints(positions in manifoldIndices) into one batch, at most SIMD_WIDTH_2D of them
+    void AddBatch(std::span<const uint32_t> constraints, std::span<const SContactManifold2D> manifolds,
+                  std::span<const uint32_t> manifoldIndices, std::span<const SRigidBodyComponent2D> bodies,
+                  std::span<const SSolverBody2D> solverBodies, float friction, float restitution,
+                  float inverseTimeStep);
+
+    // Pack the joints(positions in jointIndices, after the manifolds in ConstraintBodies) into one batch
+    void AddJointBatch(std::span<const uint32_t> constraints, const CJointStorage2D& joints,
+                       std::span<const uint32_t> jointIndices, uint32_t manifoldCount,
+                       std::span<const SRigidBodyComponent2D> bodies, std::span<const SSolverBody2D> solverBodies,
+                       float inverseTimeStep);
+};
+
+NAMESPACE_END() // namespace PHYE::Physics2D
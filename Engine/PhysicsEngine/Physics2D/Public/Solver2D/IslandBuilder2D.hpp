@@ -0,0 +1,109 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <CoreMacros.hpp>
+#include <Physics2D.hpp>
+#include <Solver2D/ConstraintGraph2D.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+// Forward Declarations
+struct SRigidBodyComponent2D;
+
+// Island of a body that belongs to none(Static bodies)
+constexpr uint32_t INVALID_ISLAND_2D = UINT32_MAX;
+
+/**
+ * @brief Bodies and constraints of one island, as ranges of CIslandBuilder2D::GetIslandBodies/Constraints().
+ */
+struct SIsland2D final
+{
+    uint32_t BodyStart = 0;
+    uint32_t BodyCount = 0;
+
+    uint32_t ConstraintStart = 0;
+    uint32_t ConstraintCount = 0;
+};
+
+/**
+ * @brief IslandBuilder2D
+ * @details Splits the non-static bodies into islands: sets of bodies connected through constraints between Dynamic
+ * bodies, found with a union-find over dense body indices. Static and Kinematic bodies do not connect islands(they
+ * are STATIC_SOLVER_BODY_2D in the constraints), a Kinematic body is an island of its own. Bodies of different islands
+ * never interact during a step, so an island can sleep, or be solved, independently of the others.
+ */
+class PHYSICS2D_API CIslandBuilder2D final
+{
+private:
+    // 并查集的父节点，按刚体的紧凑索引
+    std::vector<uint32_t> Parents;
+
+    // Island of every body, INVALID_ISLAND_2D for Static bodies
+    std::vector<uint32_t> BodyIslands;
+
+    // Island of every constraint, INVALID_ISLAND_2D when no side is Dynamic
+    std::vector<uint32_t> ConstraintIslands;
+
+    std::vector<SIsland2D> Islands;
+
+    // 按岛屿分组的刚体与约束索引
+    std::vector<uint32_t> IslandBodies;
+    std::vector<uint32_t> IslandConstraints;
+
+public:
+    CIslandBuilder2D() = default;
+    ~CIslandBuilder2D() = default;
+
+    CIslandBuilder2D(const CIslandBuilder2D&) = delete;
+    CIslandBuilder2D(CIslandBuilder2D&&) noexcept = default;
+
+    CIslandBuilder2D& operator=(const CIslandBuilder2D&) = delete;
+    CIslandBuilder2D& operator=(CIslandBuilder2D&&) noexcept = default;
+
+    /**
+     * @brief Build the islands of this step.
+     * @param constraints Dense body indices of every constraint, STATIC_SOLVER_BODY_2D for a side that is not Dynamic.
+     * @param bodies Dense rigid bodies of the world.
+     */
+    void Build(std::span<const SConstraintBodies2D> constraints, std::span<const SRigidBodyComponent2D> bodies);
+
+    [[nodiscard]] size_t GetIslandCount() const
+    {
+        return Islands.size();
+    }
+
+    [[nodiscard]] const SIsland2D& GetIsland(size_t island) const
+    {
+        return Islands[island];
+    }
+
+    // Island of a body, INVALID_ISLAND_2D for Static bodies
+    [[nodiscard]] uint32_t GetBodyIsland(size_t body) const
+    {
+        return BodyIslands[body];
+    }
+
+    // Dense body indices of an island, in increasing order
+    [[nodiscard]] std::span<const uint32_t> GetIslandBodies(size_t island) const;
+
+    // Constraint indices of an island, in increasing order
+    [[nodiscard]] std::span<const uint32_t> GetIslandConstraints(size_t island) const;
+
+private:
+    [[nodiscard]] uint32_t FindRoot(uint32_t body);
+
+    void Link(uint32_t bodyA, uint32_t bodyB);
+};
+
+NAMESPACE_END() // namespace PHYE::Physics2D
@@ -0,0 +1,111 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <CoreMacros.hpp>
+#include <Job/JobSystem.hpp>
+#include <Joint2D/JointStorage2D.hpp>
+#include <NarrowPhase2D/ContactManifold2D.hpp>
+#include <Physics2D.hpp>
+#include <PhysicsWorld2D/ColliderRecord2D.hpp>
+#include <PhysicsWorld2D/ComponentStorage2D.hpp>
+#include <Rigid2D/RigidBody2D/RigidBodyComponent2D.hpp>
+#include <Solver2D/ContactSolver2D.hpp>
+#include <Solver2D/IslandBuilder2D.hpp>
+#include <Solver2D/SolverBody2D.hpp>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+// Small islands are merged into one task until it holds at least this many constraints
+constexpr uint32_t MIN_SOLVER_TASK_CONSTRAINTS_2D = 64;
+
+// Batches of one color handed to a job when a large island is solved color by color
+constexpr uint32_t SOLVER_BATCHES_PER_JOB_2D = 16;
+
+/**
+ * @brief Parameters of one CIslandSolver2D::Solve() call.
+ */
+struct SIslandSolverSettings2D final
+{
+    float    TimeStep = 0.0F;
+    uint32_t VelocityIterations = 4;
+    float    Friction = 0.6F;
+    float    Restitution = 0.0F;
+};
+
+/**
+ * @brief IslandSolver2D
+ * @details Solves the contacts and joints of the awake islands, in parallel on a CJobSystem. The islands are grouped into tasks,
+ * each with its own CContactSolver2D: small islands are merged until a task is worth a job, an island larger than the
+ * share of one thread gets a task of its own whose batches are spread over the workers color by color.
+ * Islands share no movable body, and the coloring of an island does not depend on the other islands of its task, so
+ * the result is the same for any grouping and any number of threads.
+ */
+class PHYSICS2D_API CIslandSolver2D final
+{
+private:
+    struct SSolverTask2D final
+    {
+        CContactSolver2D Solver;
+
+        // Manifolds and dense joint indices of the islands of the task, island by island
+        std::vector<uint32_t> Manifolds;
+        std::vector<uint32_t> Joints;
+
+        // Solve the batches of every color on several threads
+        bool IsColorParallel = false;
+    };
+
+    // Tasks of the last Solve(), the ones past TaskCount are kept for their capacity
+    std::vector<SSolverTask2D> Tasks;
+    uint32_t                   TaskCount = 0;
+
+public:
+    CIslandSolver2D() = default;
+    ~CIslandSolver2D() = default;
+
+    CIslandSolver2D(const CIslandSolver2D&) = delete;
+    CIslandSolver2D(CIslandSolver2D&&) noexcept = default;
+
+    CIslandSolver2D& operator=(const CIslandSolver2D&) = delete;
+    CIslandSolver2D& operator=(CIslandSolver2D&&) noexcept = default;
+
+    /**
+     * @brief Solve the manifolds and joints of the awake islands and store their accumulated impulses.
+     * @param islands Islands built over the manifolds followed by the dense joints: constraint manifolds.size() + i is
+     * joint i.
+     * @param solverBodies Output of LoadSolverBodies2D(), receives the solved velocities.
+     * @param jobSystem Job system to run the tasks on, nullptr to solve on the calling thread.
+     */
+    void Solve(const CIslandBuilder2D& islands, std::span<SContactManifold2D> manifolds, CJointStorage2D& joints,
+               std::span<const SColliderRecord2D> colliders, const TComponentStorage2D<SRigidBodyComponent2D>& bodies,
+               std::span<SSolverBody2D> solverBodies, const SIslandSolverSettings2D& settings,
+               BE::Core::CJobSystem* jobSystem);
+
+    // Statistics of the last Solve()
+    [[nodiscard]] uint32_t                GetTaskCount() const;
+    [[nodiscard]] const CContactSolver2D& GetTaskSolver(uint32_t task) const;
+    [[nodiscard]] bool                    IsTaskColorParallel(uint32_t task) const;
+
+private:
+    // Group the awake islands into tasks
+    void BuildTasks(const CIslandBuilder2D& islands, std::span<const SRigidBodyComponent2D> bodies,
+                    uint32_t manifoldCount, uint32_t threadCount);
+
+    // Append an empty task
+    SSolverTask2D& AddTask();
+
+    // Add the constraints of an island to a task, constraints from manifoldCount on are joints
+    static void AddConstraints(SSolverTask2D& task, std::span<const uint32_t> constraints, uint32_t manifoldCount);
+};
+
+NAMESPACE_END() // namespace PHYE::Physics2D
@@ -0,0 +1,56 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <CoreMacros.hpp>
+#include <Physics2D.hpp>
+#include <Vectors/Vectors.hpp>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+// Forward Declarations
+struct SRigidBodyComponent2D;
+
+/**
+ * @brief Velocity state of a body while constraints are solved.
+ * @details Solver bodies are indexed like the dense rigid body array of the world, followed by one dummy body with
+ * zero velocity and infinite mass that pads the unused lanes of constraint batches. Static and Kinematic bodies have
+ * zero inverse mass and inertia: constraints read their velocity but never change it.
+ */
+struct PHYSICS2D_API SSolverBody2D final
+{
+    SVector2F LinearVelocity;
+    float     AngularVelocity = 0.0F;
+
+    float InverseMass = 0.0F;
+    float InverseInertia = 0.0F;
+
+    [[nodiscard]] bool IsMovable() const
+    {
+        return InverseMass > 0.0F || InverseInertia > 0.0F;
+    }
+};
+
+/**
+ * @brief Copy the velocities and inverse masses of the bodies into solver bodies, plus the trailing dummy body.
+ * @return Index of the dummy body.
+ */
+PHYSICS2D_API uint32_t LoadSolverBodies2D(std::span<const SRigidBodyComponent2D> bodies,
+                                          std::vector<SSolverBody2D>& outSolverBodies);
+
+/**
+ * @brief Write the solved velocities back to the Dynamic bodies.
+ */
+PHYSICS2D_API void StoreSolverBodies2D(std::span<const SSolverBody2D> solverBodies,
+                                       std::span<SRigidBodyComponent2D> bodies);
+
+NAMESPACE_END() // namespace PHYE::Physics2D
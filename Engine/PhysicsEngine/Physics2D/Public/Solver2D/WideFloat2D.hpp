@@ -0,0 +1,249 @@
+/**
+ * GPL-3.0 License
+ *
+ * Copyright (C) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For more detail, please refer to the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <CoreMacros.hpp>
+#include <Physics2D.hpp>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+// 宽批次的通道数在配置库时固定(CMake 的 PHYSICS2D_SIMD_WIDTH，作为公开定义传给使用方)，不随包含此头文件的编译单元的
+// 指令集变化，否则库与使用方中 TWideArray2D 以及包含它的结构的布局不同
+#if !defined(PHYSICS2D_SIMD_WIDTH)
+#define PHYSICS2D_SIMD_WIDTH 4
+#endif
+
+#if PHYSICS2D_SIMD_WIDTH != 4 && PHYSICS2D_SIMD_WIDTH != 8
+#error "PHYSICS2D_SIMD_WIDTH must be 4 or 8"
+#endif
+
+// 指令集只决定运算的实现：AVX 用于8路，SSE2/NEON 用于4路，编译单元不支持与宽度匹配的指令集时退化为标量循环
+#if PHYSICS2D_SIMD_WIDTH == 8 && defined(__AVX__)
+#include <immintrin.h>
+#define PHYSICS2D_SIMD_AVX 1
+#elif PHYSICS2D_SIMD_WIDTH == 4 && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define PHYSICS2D_SIMD_SSE2 1
+#elif PHYSICS2D_SIMD_WIDTH == 4 && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define PHYSICS2D_SIMD_NEON 1
+#endif
+
+NAMESPACE_BEGIN(PHYE::Physics2D)
+
+/**
+ * Wide float used by the constraint solver(one lane per constraint of a batch), the ray packets(one lane per ray) and
+ * the Barnes-Hut gravity(one lane per attracting mass).
+ * The width is fixed when the library is configured(PHYSICS2D_SIMD_WIDTH), so the library and its users agree on the
+ * layout whatever instruction set they are compiled for. Constraint data is stored as arrays of that width
+ * (TWideArray2D) so that a batch loads every field with one aligned load.
+ */
+
+constexpr uint32_t SIMD_WIDTH_2D = PHYSICS2D_SIMD_WIDTH;
+
+constexpr size_t SIMD_ALIGNMENT_2D = SIMD_WIDTH_2D * sizeof(float);
+
+using TWideArray2D = std::array<float, SIMD_WIDTH_2D>;
+using TWideIndexArray2D = std::array<uint32_t, SIMD_WIDTH_2D>;
+
+struct SWideFloat2D final
+{
+#if defined(PHYSICS2D_SIMD_AVX)
+    __m256 Value;
+#elif defined(PHYSICS2D_SIMD_SSE2)
+    __m128 Value;
+#elif defined(PHYSICS2D_SIMD_NEON)
+    float32x4_t Value;
+#else
+    TWideArray2D Value;
+#endif
+};
+
+// 16/32字节对齐的数组
+[[nodiscard]] inline SWideFloat2D WideLoad(const TWideArray2D& source)
+{
+#if defined(PHYSICS2D_SIMD_AVX)
+    return {_mm256_load_ps(source.data())};
+#elif defined(PHYSICS2D_SIMD_SSE2)
+    return {_mm_load_ps(source.data())};
+#elif defined(PHYSICS2D_SIMD_NEON)
+    return {vld1q_f32(source.data())};
+#else
+    return {source};
+#endif
+}
+
+inline void WideStore(TWideArray2D& destination, SWideFloat2D value)
+{
+#if defined(PHYSICS2D_SIMD_AVX)
+    _mm256_store_ps(destination.data(), value.Value);
+#elif defined(PHYSICS2D_SIMD_SSE2)
+    _mm_store_ps(destination.data(), value.Value);
+#elif defined(PHYSICS2D_SIMD_NEON)
+    vst1q_f32(destination.data(), value.Value);
+#else
+    destination = value.Value;
+#endif
+}
+
+[[nodiscard]] inline SWideFloat2D WideSplat(float value)
+{
+#if defined(PHYSICS2D_SIMD_AVX)
+    return {_mm256_set1_ps(value)};
+#elif defined(PHYSICS2D_SIMD_SSE2)
+    return {_mm_set1_ps(value)};
+#elif defined(PHYSICS2D_SIMD_NEON)
+    return {vdupq_n_f32(value)};
+#else
+    SWideFloat2D result;
+    result.Value.fill(value);
+    return result;
+#endif
+}
+
+#if !defined(PHYSICS2D_SIMD_AVX) && !defined(PHYSICS2D_SIMD_SSE2) && !defined(PHYSICS2D_SIMD_NEON)
+// 标量实现：逐通道应用运算
+template <typename TFunction>
+[[nodiscard]] inline SWideFloat2D WideApply(SWideFloat2D lhs, SWideFloat2D rhs, TFunction function)
+{
+    SWideFloat2D result;
+    for (uint32_t lane = 0; lane < SIMD_WIDTH_2D; ++lane)
+    {
+        result.Value[lane] = function(lhs.Value[lane], rhs.Value[lane]);
+    }
+    return result;
+}
+#endif
+
+[[nodiscard]] inline SWideFloat2D operator+(SWideFloat2D lhs, SWideFloat2D rhs)
+{
+#if defined(PHYSICS2D_SIMD_AVX)
+    return {_mm256_add_ps(lhs.Value, rhs.Value)};
+#elif defined(PHYSICS2D_SIMD_SSE2)
+    return {_mm_add_ps(lhs.Value, rhs.Value)};
+#elif defined(PHYSICS2D_SIMD_NEON)
+    return {vaddq_f32(lhs.Value, rhs.Value)};
+#else
+    return WideApply(lhs, rhs, [](float a, float b) { return a + b; });
+#endif
+}
+
+[[nodiscard]] inline SWideFloat2D operator-(SWideFloat2D lhs, SWideFloat2D rhs)
+{
+#if defined(PHYSICS2D_SIMD_AVX)
+    return {_mm256_sub_ps(lhs.Value, rhs.Value)};
+#elif defined(PHYSICS2D_SIMD_SSE2)
+    return {_mm_sub_ps(lhs.Value, rhs.Value)};
+#elif defined(PHYSICS2D_SIMD_NEON)
+    return {vsubq_f32(lhs.Value, rhs.Value)};
+#else
+    return WideApply(lhs, rhs, [](float a, float b) { return a - b; });
+#endif
+}
+
+[[nodiscard]] inline SWideFloat2D operator*(SWideFloat2D lhs, SWideFloat2D rhs)
+{
+#if defined(PHYSICS2D_SIMD_AVX)
+    return {_mm256_mul_ps(lhs.Value, rhs.Value)};
+#elif defined(PHYSICS2D_SIMD_SSE2)
+    return {_mm_mul_ps(lhs.Value, rhs.Value)};
+#elif defined(PHYSICS2D_SIMD_NEON)
+    return {vmulq_f32(lhs.Value, rhs.Value)};
+#else
+    return WideApply(lhs, rhs, [](float a, float b) { return a * b; });
+#endif
+}
+
+[[nodiscard]] inline SWideFloat2D operator/(SWideFloat2D lhs, SWideFloat2D rhs)
+{
+#if defined(PHYSICS2D_SIMD_AVX)
+    return {_mm256_div_ps(lhs.Value, rhs.Value)};
+#elif defined(PHYSICS2D_SIMD_SSE2)
+    return {_mm_div_ps(lhs.Value, rhs.Value)};
+#elif defined(PHYSICS2D_SIMD_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+    return {vdivq_f32(lhs.Value, rhs.Value)};
+#elif defined(PHYSICS2D_SIMD_NEON)
+    // 32位NEON没有精确的除法，逐通道计算以保持与其它实现相同的结果
+    const float32x4_t RESULT = {vgetq_lane_f32(lhs.Value, 0) / vgetq_lane_f32(rhs.Value, 0),
+                                vgetq_lane_f32(lhs.Value, 1) / vgetq_lane_f32(rhs.Value, 1),
+                                vgetq_lane_f32(lhs.Value, 2) / vgetq_lane_f32(rhs.Value, 2),
+                                vgetq_lane_f32(lhs.Value, 3) / vgetq_lane_f32(rhs.Value, 3)};
+    return {RESULT};
+#else
+    return WideApply(lhs, rhs, [](float a, float b) { return a / b; });
+#endif
+}
+
+[[nodiscard]] inline SWideFloat2D WideSqrt(SWideFloat2D value)
+{
+#if defined(PHYSICS2D_SIMD_AVX)
+    return {_mm256_sqrt_ps(value.Value)};
+#elif defined(PHYSICS2D_SIMD_SSE2)
+    return {_mm_sqrt_ps(value.Value)};
+#elif defined(PHYSICS2D_SIMD_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+    return {vsqrtq_f32(value.Value)};
+#elif defined(PHYSICS2D_SIMD_NEON)
+    const float32x4_t RESULT = {std::sqrt(vgetq_lane_f32(value.Value, 0)), std::sqrt(vgetq_lane_f32(value.Value, 1)),
+                                std::sqrt(vgetq_lane_f32(value.Value, 2)), std::sqrt(vgetq_lane_f32(value.Value, 3))};
+    return {RESULT};
+#else
+    return WideApply(value, value, [](float a, float) { return std::sqrt(a); });
+#endif
+}
+
+[[nodiscard]] inline SWideFloat2D WideMin(SWideFloat2D lhs, SWideFloat2D rhs)
+{
+#if defined(PHYSICS2D_SIMD_AVX)
+    return {_mm256_min_ps(lhs.Value, rhs.Value)};
+#elif defined(PHYSICS2D_SIMD_SSE2)
+    return {_mm_min_ps(lhs.Value, rhs.Value)};
+#elif defined(PHYSICS2D_SIMD_NEON)
+    return {vminq_f32(lhs.Value, rhs.Value)};
+#else
+    return WideApply(lhs, rhs, [](float a, float b) { return a < b ? a : b; });
+#endif
+}
+
+[[nodiscard]] inline SWideFloat2D WideMax(SWideFloat2D lhs, SWideFloat2D rhs)
+{
+#if defined(PHYSICS2D_SIMD_AVX)
+    return {_mm256_max_ps(lhs.Value, rhs.Value)};
+#elif defined(PHYSICS2D_SIMD_SSE2)
+    return {_mm_max_ps(lhs.Value, rhs.Value)};
+#elif defined(PHYSICS2D_SIMD_NEON)
+    return {vmaxq_f32(lhs.Value, rhs.Value)};
+#else
+    return WideApply(lhs, rhs, [](float a, float b) { return a > b ? a : b; });
+#endif
+}
+
+// Bit i set where lane i of lhs <= rhs
+[[nodiscard]] inline uint32_t WideLessEqualMask(SWideFloat2D lhs, SWideFloat2D rhs)
+{
+#if defined(PHYSICS2D_SIMD_AVX)
+    return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(lhs.Value, rhs.Value, _CMP_LE_OQ)));
+#elif defined(PHYSICS2D_SIMD_SSE2)
+    return static_cast<uint32_t>(_mm_movemask_ps(_mm_cmple_ps(lhs.Value, rhs.Value)));
+#elif defined(PHYSICS2D_SIMD_NEON)
+    const uint32x4_t LANE_BITS = {1U, 2U, 4U, 8U};
+    const uint32x4_t BITS = vandq_u32(vcleq_f32(lhs.Value, rhs.Value), LANE_BITS);
+    return vgetq_lane_u32(BITS, 0) | vgetq_lane_u32(BITS, 1) | vgetq_lane_u32(BITS, 2) | vgetq_lane_u32(BITS, 3);
+#else
+    uint32_t mask = 0;
+    for (uint32_t lane = 0; lane < SIMD_WIDTH_2D; ++lane)
+    {
+        mask |= lhs.Value[lane] <= rhs.Value[lane] ? (1U << lane) : 0U;
+    }
+    return mask;
+#endif
+}
+
+NAMESPACE_END() // namespace PHYE::Physics2D